@@ -0,0 +1,66 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal timing harness: a case runs its body repeatedly until MinTime
+// has been spent in the timed part, and the report is written as JSON by
+// main. The body times itself (with a Stopwatch) so per-iteration setup
+// such as refilling a pool is left out of the numbers.
+namespace Bench {
+
+    class Stopwatch {
+    public:
+        Stopwatch() : m_Start(std::chrono::steady_clock::now()) {}
+        double ElapsedMs() const {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Start).count();
+        }
+    private:
+        std::chrono::steady_clock::time_point m_Start;
+    };
+
+    struct Result {
+        std::string Name;      // "<suite>/<op>/<pool>/<pool size>", what --filter matches
+        std::string Op;
+        std::string Pool;      // "live-heavy" or "sparse"
+        size_t      PoolSize = 0;
+        size_t      Items = 0; // particles processed per iteration
+        uint32_t    Iterations = 0;
+        double      MeanMs = 0.0;
+        double      MinMs = 0.0;
+        // Items / MinMs: the fastest run is the least disturbed by the machine
+        double ItemsPerMs() const { return MinMs > 0.0 ? (double)Items / MinMs : 0.0; }
+    };
+
+    struct Options {
+        double MinTimeMs = 250.0;
+        uint32_t MinIterations = 3;
+        std::string Filter; // substring of Result::Name; empty runs everything
+    };
+
+    class Report {
+    public:
+        explicit Report(const Options& options) : m_Options(options) {}
+
+        bool Selected(const std::string& name) const {
+            return m_Options.Filter.empty() || name.find(m_Options.Filter) != std::string::npos;
+        }
+
+        // Calls `iteration` (returning its timed milliseconds) once to warm
+        // up, then until both minimums are met, and records the result.
+        void Run(Result result, const std::function<double()>& iteration);
+
+        const std::vector<Result>& Results() const { return m_Results; }
+        std::string ToJson() const;
+
+    private:
+        Options m_Options;
+        std::vector<Result> m_Results;
+    };
+
+    void RunFXSystemBenchmarks(Report& report);
+
+} // namespace Bench
@@ -0,0 +1,122 @@
+#include <glm/gtc/matrix_transform.hpp>
+#include "Benchmark.h"
+#include "Engine/Core/ThreadPool.h"
+#include "Engine/Renderer/FXSystem.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Platforms/Recording/RecordingLog.h"
+
+// FXSystem hot path: Spawn, Update and Render at 1k..1M particles. Each
+// size runs with a live-heavy pool (every slot live) and a sparse one
+// (one slot in ten), which shows whether a cost follows the live count or
+// the pool size. Render draws on the recording backend, so only the CPU
+// side (LUT reads, quad expansion, batch flushes) is measured.
+namespace {
+    using namespace Engine;
+
+    constexpr size_t kSizes[] = { 1000, 10000, 100000, 1000000 };
+    constexpr float kFrame = 1.0f / 60.0f;
+
+    struct PoolShape {
+        const char* Name;
+        size_t LiveDivisor;
+    };
+    constexpr PoolShape kShapes[] = { { "live-heavy", 1 }, { "sparse", 10 } };
+
+    FXSpec MakeSpec()
+    {
+        FXSpec spec;
+        spec.vel = { 1.0f, 0.5f };
+        spec.velJitter = { 2.0f, 2.0f };
+        spec.colorStart = { 1.0f, 0.6f, 0.2f, 1.0f };
+        spec.sizeStart = 0.1f;
+        spec.sizeJitter = 0.05f;
+        spec.life = 1.0e6f; // nothing expires while a case runs
+        return spec;
+    }
+
+    void Fill(FXSystem& fx, size_t pool, size_t live)
+    {
+        fx.Seed(1234);
+        fx.ResizePool(pool);
+        const FXSpec spec = MakeSpec();
+        for (size_t i = 0; i < live; ++i) fx.Spawn(spec);
+    }
+
+    Bench::Result Describe(const char* op, const PoolShape& shape, size_t pool)
+    {
+        Bench::Result r;
+        r.Name = std::string("FXSystem/") + op + "/" + shape.Name + "/" + std::to_string(pool);
+        r.Op = op;
+        r.Pool = shape.Name;
+        r.PoolSize = pool;
+        r.Items = pool / shape.LiveDivisor;
+        return r;
+    }
+}
+
+namespace Bench {
+
+    void RunFXSystemBenchmarks(Report& report)
+    {
+        ThreadPool serial(1);
+
+        for (const PoolShape& shape : kShapes) {
+            for (size_t pool : kSizes) {
+                const size_t live = pool / shape.LiveDivisor;
+                FXSystem fx;
+
+                // Into an empty pool; the refill is not timed
+                report.Run(Describe("Spawn", shape, pool), [&] {
+                    fx.Seed(1234);
+                    fx.ResizePool(pool);
+                    const FXSpec spec = MakeSpec();
+                    Stopwatch sw;
+                    for (size_t i = 0; i < live; ++i) fx.Spawn(spec);
+                    return sw.ElapsedMs();
+                });
+
+                Fill(fx, pool, live);
+                report.Run(Describe("Update", shape, pool), [&] {
+                    Stopwatch sw;
+                    fx.Update(Timestep(kFrame)); // ThreadPool::Global()
+                    return sw.ElapsedMs();
+                });
+                report.Run(Describe("UpdateSerial", shape, pool), [&] {
+                    Stopwatch sw;
+                    fx.Update(Timestep(kFrame), serial);
+                    return sw.ElapsedMs();
+                });
+            }
+        }
+
+        const RendererAPI::API previous = RendererAPI::GetAPI();
+        RendererAPI::SetAPI(RendererAPI::API::Recording);
+        RecordingLog& log = RecordingLog::Get();
+        log.Reset();
+        log.SetKeepCommands(false); // totals only; a command per batch flush piles up over thousands of frames
+        Renderer::Init();
+        const glm::mat4 viewProjection = glm::ortho(-16.0f, 16.0f, -9.0f, 9.0f);
+
+        for (const PoolShape& shape : kShapes) {
+            for (size_t pool : kSizes) {
+                FXSystem fx;
+                Fill(fx, pool, pool / shape.LiveDivisor);
+                fx.Update(Timestep(kFrame)); // spread the particles out
+                report.Run(Describe("Render", shape, pool), [&] {
+                    Stopwatch sw;
+                    Renderer2D::BeginScene(viewProjection);
+                    fx.Render();
+                    Renderer2D::EndScene();
+                    return sw.ElapsedMs();
+                });
+            }
+        }
+
+        Renderer::Shutdown();
+        log.Reset();
+        log.SetKeepCommands(true);
+        RendererAPI::SetAPI(previous);
+    }
+
+} // namespace Bench
@@ -0,0 +1,122 @@
+// Benchmarks/main.cpp
+// Usage: GameEngineBenchmarks [--out results.json] [--filter Update/] [--min-time ms]
+// Without --out the JSON goes to stdout; progress is always on stderr.
+#include <windows.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "Benchmark.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/ThreadPool.h"
+#include "Engine/Renderer/FXSystem.h"
+
+namespace Bench {
+
+    void Report::Run(Result result, const std::function<double()>& iteration)
+    {
+        if (!Selected(result.Name)) return;
+
+        iteration(); // warm-up: first touch of the pool, batch buffers, thread pool
+        double total = 0.0, best = std::numeric_limits<double>::max();
+        uint32_t n = 0;
+        while (n < m_Options.MinIterations || total < m_Options.MinTimeMs) {
+            const double ms = iteration();
+            total += ms;
+            best = std::min(best, ms);
+            ++n;
+        }
+        result.Iterations = n;
+        result.MeanMs = total / n;
+        result.MinMs = best;
+        std::fprintf(stderr, "%-40s %8u it  %10.4f ms  %12.1f particles/ms\n",
+            result.Name.c_str(), n, result.MinMs, result.ItemsPerMs());
+        m_Results.push_back(std::move(result));
+    }
+
+
+    std::string Report::ToJson() const
+    {
+#if defined(EG_DIST)
+        const char* build = "Dist";
+#elif defined(EG_RELEASE)
+        const char* build = "Release";
+#else
+        const char* build = "Debug";
+#endif
+        std::ostringstream out;
+        out.precision(6);
+        out << "{\n";
+        out << "  \"context\": {\n";
+        out << "    \"build\": \"" << build << "\",\n";
+        out << "    \"threads\": " << Engine::ThreadPool::Global().ThreadCount() << ",\n";
+        out << "    \"simd_lanes\": " << Engine::FXSystem::Lanes << ",\n";
+        out << "    \"min_time_ms\": " << m_Options.MinTimeMs << "\n";
+        out << "  },\n";
+        out << "  \"benchmarks\": [";
+        for (size_t i = 0; i < m_Results.size(); ++i) {
+            const Result& r = m_Results[i];
+            out << (i ? ",\n" : "\n");
+            out << "    { \"name\": \"" << r.Name << "\", \"op\": \"" << r.Op << "\", \"pool\": \"" << r.Pool << "\""
+                << ", \"pool_size\": " << r.PoolSize << ", \"particles\": " << r.Items
+                << ", \"iterations\": " << r.Iterations
+                << ", \"mean_ms\": " << r.MeanMs << ", \"min_ms\": " << r.MinMs
+                << ", \"particles_per_ms\": " << r.ItemsPerMs() << " }";
+        }
+        out << "\n  ]\n}\n";
+        return out.str();
+    }
+
+} // namespace Bench
+
+
+static void SetCwdToExeDir()
+{
+    wchar_t buf[MAX_PATH];
+    DWORD n = GetModuleFileNameW(nullptr, buf, MAX_PATH);
+    if (n == 0 || n == MAX_PATH) return;
+    for (int i = (int)wcslen(buf) - 1; i >= 0; --i) {
+        if (buf[i] == L'\\' || buf[i] == L'/') { buf[i] = L'\0'; break; }
+    }
+    SetCurrentDirectoryW(buf);
+}
+
+int main(int argc, char** argv)
+{
+    Bench::Options options;
+    std::filesystem::path outPath; // absolute: the working directory changes below
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--out") && hasValue) outPath = std::filesystem::absolute(argv[++i]);
+        else if (!std::strcmp(argv[i], "--filter") && hasValue) options.Filter = argv[++i];
+        else if (!std::strcmp(argv[i], "--min-time") && hasValue) options.MinTimeMs = std::atof(argv[++i]);
+        else {
+            std::fprintf(stderr, "usage: %s [--out file.json] [--filter substring] [--min-time ms]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    SetCwdToExeDir(); // assets/ is copied next to the exe
+    Engine::Log::Init();
+
+    Bench::Report report(options);
+    Bench::RunFXSystemBenchmarks(report);
+
+    const std::string json = report.ToJson();
+    if (outPath.empty()) {
+        std::fwrite(json.data(), 1, json.size(), stdout);
+        return 0;
+    }
+    std::ofstream file(outPath, std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "cannot write %s\n", outPath.string().c_str());
+        return 1;
+    }
+    file << json;
+    return 0;
+}
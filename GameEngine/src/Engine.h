@@ -8,6 +8,7 @@
 #include "Engine/Core/Log.h"
 
 #include "Engine/Core/Timestep.h"
+#include "Engine/Core/Random.h"
 
 #include "Engine/Core/Input.h"
 #include "Engine/Core/KeyCodes.h"
@@ -20,6 +21,17 @@
 #include "Engine/Renderer/Renderer.h"
 #include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Engine/Renderer/Tilemap.h"
+#include "Engine/Renderer/SpriteRegistry.h"
+#include "Engine/Renderer/Framebuffer.h"
+#include "Engine/Renderer/CachedLayer.h"
+#include "Engine/Renderer/LowResolutionPass.h"
+#include "Engine/Renderer/DynamicResolution.h"
+#include "Engine/Renderer/RenderGraph.h"
+#include "Engine/Renderer/FrameCapture.h"
+#include "Engine/Renderer/OverdrawView.h"
+#include "Engine/Renderer/ImageWriter.h"
 		  
 #include "Engine/Renderer/Buffer.h"
 #include "Engine/Renderer/Shader.h"
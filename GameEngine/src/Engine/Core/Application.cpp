@@ -2,6 +2,8 @@
 #include "Application.h"
 
 #include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/RenderThread.h"
+#include "Engine/Renderer/FrameCapture.h"
 #include "Engine/Core/Input.h"
 #include "../../Platforms/Windows/WindowsInput.h"
 #include "Log.h"
@@ -28,6 +30,7 @@ namespace Engine {
         }
 
         Renderer::Init();
+        m_FrameCapture = std::make_unique<FrameCapture>();
 
         // Setup ImGui overlay  w testach pomijamy
 #ifndef EG_TESTS
@@ -38,6 +41,7 @@ namespace Engine {
 
     Application::~Application()
     {
+        m_FrameCapture.reset(); // writes what is still in flight
         Renderer::Shutdown();
 
         if (Input::IsInitialized())
@@ -77,26 +81,111 @@ namespace Engine {
         }
     }
 
+    void Application::SetRenderThreadEnabled(bool enabled, uint32_t maxFramesInFlight)
+    {
+        EG_CORE_CHECK(!m_IsRunning, "Render thread mode can only change before Run");
+        m_UseRenderThread = enabled;
+        m_MaxFramesInFlight = maxFramesInFlight;
+    }
+
+    Timestep Application::NextTimestep()
+    {
+        const float currentTime = static_cast<float>(glfwGetTime());
+        Timestep deltaTime = currentTime - m_LastFrameTime;
+        m_LastFrameTime = currentTime;
+        return deltaTime;
+    }
+
     void Application::Run()
     {
         m_IsRunning = true;
 
+        if (m_UseRenderThread)
+        {
+            RunWithRenderThread();
+            return;
+        }
+
         while (m_IsRunning)
         {
-            const float currentTime = static_cast<float>(glfwGetTime());
-            Timestep deltaTime = currentTime - m_LastFrameTime;
-            m_LastFrameTime = currentTime;
+            Timestep deltaTime = NextTimestep();
 
             if (!m_Minimized)
             {
                 UpdateLayers(deltaTime);
                 RenderImGui();
+                m_FrameCapture->OnFrameEnd(m_Window->GetWidth(), m_Window->GetHeight());
             }
 
             m_Window->OnUpdate();
         }
     }
 
+    void Application::RunWithRenderThread()
+    {
+        EG_PROFILE_THREAD("Main");
+
+#ifndef EG_TESTS
+        if (m_ImGuiLayer)
+            m_ImGuiLayer->PrepareForRenderThread();
+#endif
+
+        // Hand the context over; everything GL from here on runs on the render thread
+        GraphicsContext& context = m_Window->GetContext();
+        context.ReleaseCurrent();
+
+        m_RenderThread = std::make_unique<RenderThread>();
+        m_RenderThread->Start(context, m_MaxFramesInFlight);
+
+        while (m_IsRunning)
+        {
+            FramePacket& packet = m_RenderThread->BeginFrame();
+            {
+                EG_PROFILE_SCOPE("Application::BuildFrame");
+                CommandList::RecordingScope recording(packet.Commands);
+
+                m_Window->PollEvents();
+                Timestep deltaTime = NextTimestep();
+
+                if (!m_Minimized)
+                {
+                    UpdateLayers(deltaTime);
+#ifndef EG_TESTS
+                    if (m_ImGuiLayer)
+                    {
+                        m_ImGuiLayer->Begin();
+                        for (auto& layer : m_LayerStack)
+                            if (layer->IsEnabled())
+                                layer->OnImGuiRender();
+                        packet.Overlay = m_ImGuiLayer->EndDeferred();
+                    }
+#endif
+                    // Read back on the render thread once the frame (and HUD) is drawn
+                    packet.Overlay = [overlay = std::move(packet.Overlay), capture = m_FrameCapture.get(),
+                        width = m_Window->GetWidth(), height = m_Window->GetHeight()] {
+                        if (overlay) overlay();
+                        capture->OnFrameEnd(width, height);
+                    };
+                }
+            }
+            m_RenderThread->EndFrame();
+        }
+
+        const auto stats = m_RenderThread->GetStats();
+        if (stats.FramesRendered > 0)
+        {
+            EG_CORE_INFO("Render thread: {} frames, main blocked {:.2f} ms/frame, render idle {:.2f} ms/frame, busy {:.2f} ms/frame",
+                stats.FramesRendered,
+                stats.MainBlockedMs / stats.FramesRendered,
+                stats.RenderIdleMs / stats.FramesRendered,
+                stats.RenderBusyMs / stats.FramesRendered);
+        }
+
+        m_RenderThread->Stop();
+        m_RenderThread.reset();
+        context.MakeCurrent();
+    }
+
     void Application::UpdateLayers(Timestep dt)
     {
         if (m_Minimized)
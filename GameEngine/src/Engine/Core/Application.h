@@ -13,6 +13,9 @@
 
 namespace Engine {
 
+    class RenderThread;
+    class FrameCapture;
+
     class Application
     {
     public:
@@ -21,12 +24,20 @@ namespace Engine {
 
         void Run();
 
+        // Moves GL submission to a dedicated render thread for the next Run:
+        // the main thread updates layers and records frame N+1 while frame N
+        // is drawn. GPU resources should be created/destroyed outside Run.
+        void SetRenderThreadEnabled(bool enabled, uint32_t maxFramesInFlight = 1);
+        bool IsRenderThreadEnabled() const { return m_UseRenderThread; }
+
         // Layer management
         void AddLayer(const std::shared_ptr<Layer>& layer);
         void AddOverlay(const std::shared_ptr<Layer>& overlay);
 
         // Accessors
         inline Window& GetWindow() { return *m_Window; }
+        // Screenshots / image sequences of the final frame (HUD included)
+        inline FrameCapture& GetFrameCapture() { return *m_FrameCapture; }
         inline static Application& Get() { return *s_Instance; }
 
     private:
@@ -38,6 +49,8 @@ namespace Engine {
         // Main loop helpers
         void UpdateLayers(Timestep dt);
         void RenderImGui();
+        void RunWithRenderThread();
+        Timestep NextTimestep();
 
 #ifdef EG_TESTS
         friend struct ApplicationTestAccess; // albo: friend struct ApplicationTestAccess;
@@ -52,6 +65,11 @@ namespace Engine {
         float  m_LastFrameTime = 0.0f;
         LayerStack m_LayerStack;
 
+        bool     m_UseRenderThread = false;
+        uint32_t m_MaxFramesInFlight = 1;
+        std::unique_ptr<RenderThread> m_RenderThread;
+        std::unique_ptr<FrameCapture> m_FrameCapture;
+
         static Application* s_Instance;
     };
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <exception>
 #include <cstdlib>
+#include <cstring>
 
 #include "Core.h"
 #include "Log.h"
@@ -14,8 +15,6 @@ extern Engine::Application* Engine::CreateApplication();
 
 int main(int argc, char** argv)
 {
-    (void)argc; (void)argv; // unused for now
-
     // Initialize logging
     Engine::Log::Init();
 
@@ -25,6 +24,13 @@ int main(int argc, char** argv)
     {
         // Create and run the application (RAII via unique_ptr)
         std::unique_ptr<Engine::Application> app{ Engine::CreateApplication() };
+
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--render-thread") == 0)
+                app->SetRenderThreadEnabled(true);
+        }
+
         app->Run(); // blocks until close
         // app is destroyed automatically here
     }
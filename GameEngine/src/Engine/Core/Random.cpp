@@ -0,0 +1,72 @@
+#include "enginepch.h"
+#include "Random.h"
+
+namespace Engine {
+
+    static constexpr uint64_t kMultiplier = 6364136223846793005ull;
+
+    struct BlockMultipliers {
+        uint64_t A[Random::Block + 1];
+        constexpr BlockMultipliers() : A() {
+            A[0] = 1;
+            for (size_t k = 1; k <= Random::Block; ++k) A[k] = A[k - 1] * kMultiplier;
+        }
+    };
+    static constexpr BlockMultipliers kBlock;
+
+    static uint32_t Output(uint64_t state) {
+        const uint32_t xorshifted = (uint32_t)(((state >> 18u) ^ state) >> 27u);
+        const uint32_t rot = (uint32_t)(state >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31u));
+    }
+
+    static uint64_t SplitMix64(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    Random::Random(uint64_t seed, uint64_t stream) {
+        Seed(seed, stream);
+    }
+
+    void Random::Seed(uint64_t seed, uint64_t stream) {
+        m_Seed = seed;
+        m_Stream = stream;
+        m_Inc = (stream << 1u) | 1u;
+        m_BlockInc[0] = 0;
+        for (size_t k = 1; k <= Block; ++k) m_BlockInc[k] = m_BlockInc[k - 1] * kMultiplier + m_Inc;
+
+        // Reference pcg32_srandom_r
+        m_State = 0;
+        NextU32();
+        m_State += seed;
+        NextU32();
+    }
+
+    uint32_t Random::NextU32() {
+        const uint64_t old = m_State;
+        m_State = old * kMultiplier + m_Inc;
+        return Output(old);
+    }
+
+    void Random::Fill01(float* out, size_t count) {
+        size_t i = 0;
+        for (; i + Block <= count; i += Block) {
+            const uint64_t s = m_State;
+            uint32_t bits[Block];
+            for (size_t k = 0; k < Block; ++k) bits[k] = Output(kBlock.A[k] * s + m_BlockInc[k]);
+            for (size_t k = 0; k < Block; ++k) out[i + k] = (float)(bits[k] >> 8) * (1.0f / 16777216.0f);
+            m_State = kBlock.A[Block] * s + m_BlockInc[Block];
+        }
+        for (; i < count; ++i) out[i] = Float01();
+    }
+
+    Random Random::Split(uint64_t index) const {
+        // Both seed and stream differ, so children do not share a state
+        // sequence offset with the parent or each other
+        return Random(SplitMix64(m_Seed ^ SplitMix64(index)), SplitMix64(m_Stream + index + 1));
+    }
+
+} // namespace Engine
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+
+    // PCG32 (XSH-RR): 64-bit LCG state, 32-bit output, one of 2^63 streams
+    // picked by `stream`. Small enough to keep one per system or per job;
+    // an instance is not thread-safe, so threads use their own (Split).
+    // Equal seed and stream give the same sequence on every platform.
+    class Random {
+    public:
+        explicit Random(uint64_t seed = 0x853c49e6748fea9bull, uint64_t stream = 0);
+
+        void Seed(uint64_t seed, uint64_t stream = 0);
+
+        uint32_t NextU32();
+        // [0, 1), 24-bit resolution
+        float Float01() { return (float)(NextU32() >> 8) * (1.0f / 16777216.0f); }
+        float Range(float lo, float hi) { return lo + (hi - lo) * Float01(); }
+        // [-0.5, 0.5)
+        float Centered() { return Float01() - 0.5f; }
+
+        // Same values as `count` calls to Float01. Whole blocks of Block
+        // outputs jump the state ahead per lane, so the multiplies are
+        // independent and the conversion vectorizes.
+        static constexpr size_t Block = 8;
+        void Fill01(float* out, size_t count);
+
+        // Generator for job `index` (0, 1, ...): reproducible from this
+        // one's seed and stream, independent of it and of other indices.
+        Random Split(uint64_t index) const;
+
+        uint64_t GetSeed() const { return m_Seed; }
+        uint64_t GetStream() const { return m_Stream; }
+
+    private:
+        uint64_t m_State = 0, m_Inc = 1;
+        uint64_t m_Seed = 0, m_Stream = 0;
+        uint64_t m_BlockInc[Block + 1]; // state after k steps = A[k] * state + m_BlockInc[k]
+    };
+
+} // namespace Engine
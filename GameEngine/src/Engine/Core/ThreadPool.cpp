@@ -0,0 +1,80 @@
+#include "enginepch.h"
+#include "ThreadPool.h"
+
+namespace Engine {
+
+    ThreadPool::ThreadPool(uint32_t threadCount) {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        m_Workers.reserve(threadCount - 1);
+        for (uint32_t i = 1; i < threadCount; ++i)
+            m_Workers.emplace_back([this] { WorkerMain(); });
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_WorkCV.notify_all();
+        for (auto& t : m_Workers) t.join();
+    }
+
+    ThreadPool& ThreadPool::Global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    void ThreadPool::RunJob() {
+        for (uint32_t i = m_Next.fetch_add(1); i < m_Count; i = m_Next.fetch_add(1))
+            (*m_Fn)(i);
+    }
+
+    void ThreadPool::WorkerMain() {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_WorkCV.wait(lock, [&] { return m_Quit || m_Generation != seen; });
+                if (m_Quit) return;
+                seen = m_Generation;
+                m_Busy++;
+            }
+
+            RunJob();
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Busy--;
+            }
+            m_DoneCV.notify_one();
+        }
+    }
+
+    void ThreadPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& fn) {
+        if (count == 0) return;
+        if (m_Workers.empty() || count == 1) {
+            for (uint32_t i = 0; i < count; ++i) fn(i);
+            return;
+        }
+
+        {
+            // A worker that woke too late for the previous job may still be
+            // leaving it; let it go before the job fields change.
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_DoneCV.wait(lock, [&] { return m_Busy == 0; });
+            m_Fn = &fn;
+            m_Count = count;
+            m_Next = 0;
+            m_Generation++;
+        }
+        m_WorkCV.notify_all();
+
+        RunJob();
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_DoneCV.wait(lock, [&] { return m_Busy == 0; });
+    }
+
+} // namespace Engine
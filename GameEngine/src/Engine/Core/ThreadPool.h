@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+    // Fixed set of worker threads for data-parallel loops. The calling thread
+    // takes part in the work, so a pool of N threads has N - 1 workers.
+    class ThreadPool {
+    public:
+        // threadCount = 0 uses std::thread::hardware_concurrency()
+        explicit ThreadPool(uint32_t threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        uint32_t ThreadCount() const { return (uint32_t)m_Workers.size() + 1; }
+
+        // Calls fn(i) for every i in [0, count) and returns when all are done.
+        // Indices are handed out dynamically; fn must be safe to run concurrently.
+        // Not reentrant: fn must not call ParallelFor on the same pool.
+        void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& fn);
+
+        // Engine-wide pool sized to the machine.
+        static ThreadPool& Global();
+
+    private:
+        void WorkerMain();
+        void RunJob();
+
+        std::vector<std::thread> m_Workers;
+
+        std::mutex              m_Mutex;
+        std::condition_variable m_WorkCV;
+        std::condition_variable m_DoneCV;
+        uint64_t m_Generation = 0;
+        bool     m_Quit = false;
+
+        // Current job
+        const std::function<void(uint32_t)>* m_Fn = nullptr;
+        uint32_t              m_Count = 0;
+        std::atomic<uint32_t> m_Next{ 0 };
+        uint32_t              m_Busy = 0; // workers inside the current job
+    };
+
+} // namespace Engine
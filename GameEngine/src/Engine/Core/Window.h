@@ -6,6 +6,7 @@
 
 #include "Engine/Core/Core.h"
 #include "Engine/Events/Event.h"
+#include "Engine/Renderer/GraphicsContext.h"
 
 namespace Engine {
 
@@ -32,6 +33,10 @@ namespace Engine {
         // Per-frame pump: usually polls events & swaps buffers.
         virtual void OnUpdate() = 0;
 
+        // Event polling alone; with a render thread the swap happens there.
+        virtual void PollEvents() = 0;
+        virtual GraphicsContext& GetContext() = 0;
+
         // Dimensions (window size in screen coordinates)
         virtual uint32_t GetWidth()  const = 0;
         virtual uint32_t GetHeight() const = 0;
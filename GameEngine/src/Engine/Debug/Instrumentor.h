@@ -81,6 +81,29 @@ namespace Engine {
 			m_Output.flush();
 		}
 
+		// Labels the calling thread in the trace viewer (metadata event).
+		void SetThreadName(const std::string& name) {
+			std::scoped_lock lock(m_Mutex);
+			if (!m_CurrentSession || !m_Output.is_open()) return;
+
+			if (m_ProfileCount++ > 0)
+				m_Output << ",";
+
+			m_Output << "{";
+			m_Output << R"("name":"thread_name",)";
+			m_Output << R"("ph":"M",)";
+			m_Output << R"("pid":0,)";
+			m_Output << R"("tid":)" << CurrentThreadID() << ",";
+			m_Output << R"("args":{"name":")" << name << R"("})";
+			m_Output << "}";
+
+			m_Output.flush();
+		}
+
+		static uint32_t CurrentThreadID() {
+			return static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+		}
+
 		// Global singleton accessor
 		static Instrumentor& Get() {
 			static Instrumentor s_Instance;
@@ -131,9 +154,7 @@ namespace Engine {
 
 			const auto startUs = std::chrono::time_point_cast<std::chrono::microseconds>(m_Start).time_since_epoch().count();
 			const auto endUs = std::chrono::time_point_cast<std::chrono::microseconds>(end).time_since_epoch().count();
-			const uint32_t tid = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
-
-			Instrumentor::Get().WriteProfile({ m_Name, startUs, endUs, tid });
+			Instrumentor::Get().WriteProfile({ m_Name, startUs, endUs, Instrumentor::CurrentThreadID() });
 			m_Stopped = true;
 		}
 
@@ -152,6 +173,7 @@ namespace Engine {
 #define EG_PROFILE_BEGIN_SESSION(name, filepath) ::Engine::Instrumentor::Get().BeginSession(name, filepath)
 #define EG_PROFILE_END_SESSION()                 ::Engine::Instrumentor::Get().EndSession()
 #define EG_PROFILE_SCOPE(name)                   ::Engine::InstrumentationTimer EG_CONCAT(_egProfileTimer_, __LINE__){ name }
+#define EG_PROFILE_THREAD(name)                  ::Engine::Instrumentor::Get().SetThreadName(name)
 #ifdef _MSC_VER
 #define EG_PROFILE_FUNCTION()                EG_PROFILE_SCOPE(__FUNCSIG__)
 #else
@@ -164,5 +186,6 @@ namespace Engine {
 #define EG_PROFILE_BEGIN_SESSION(name, filepath)
 #define EG_PROFILE_END_SESSION()
 #define EG_PROFILE_SCOPE(name)
+#define EG_PROFILE_THREAD(name)
 #define EG_PROFILE_FUNCTION()
 #endif
@@ -10,6 +10,7 @@
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
+#include <type_traits>
 
 namespace Engine {
 
@@ -129,6 +130,77 @@ namespace Engine {
         ImGui::NewFrame();
     }
 
+    // ImDrawData::CmdLists is a raw array in older ImGui and an ImVector in
+    // newer; `Data` is a template parameter so only the matching branch compiles.
+    template<typename Data>
+    static void AssignCmdLists(Data& dst, std::vector<ImDrawList*>& lists)
+    {
+        if constexpr (std::is_pointer_v<decltype(dst.CmdLists)>)
+            dst.CmdLists = lists.data();
+        else
+        {
+            dst.CmdLists.resize((int)lists.size());
+            for (int i = 0; i < (int)lists.size(); ++i)
+                dst.CmdLists[i] = lists[i];
+        }
+    }
+
+    // Deep copy of one frame's draw data; ImGui reuses its buffers next frame.
+    struct ImGuiDrawSnapshot
+    {
+        ImDrawData Data;
+        std::vector<ImDrawList*> Lists;
+
+        explicit ImGuiDrawSnapshot(const ImDrawData& src)
+            : Data(src)
+        {
+            Lists.reserve(src.CmdListsCount);
+            for (int i = 0; i < src.CmdListsCount; ++i)
+                Lists.push_back(src.CmdLists[i]->CloneOutput());
+            AssignCmdLists(Data, Lists);
+        }
+
+        ~ImGuiDrawSnapshot()
+        {
+            for (ImDrawList* l : Lists)
+                IM_DELETE(l);
+        }
+
+        ImGuiDrawSnapshot(const ImGuiDrawSnapshot&) = delete;
+        ImGuiDrawSnapshot& operator=(const ImGuiDrawSnapshot&) = delete;
+    };
+
+    void ImGuiLayer::PrepareForRenderThread()
+    {
+        if (!m_Initialized)
+            return;
+
+        ImGui_ImplOpenGL3_CreateDeviceObjects();
+        ImGui::GetIO().ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+        m_Opts.EnableViewports = false;
+    }
+
+    std::function<void()> ImGuiLayer::EndDeferred()
+    {
+        EG_PROFILE_FUNCTION();
+
+        if (!m_Initialized)
+            return nullptr;
+
+        uint32_t fbw = 0, fbh = 0;
+        Application::Get().GetWindow().GetFramebufferSize(fbw, fbh);
+        ImGui::GetIO().DisplaySize = ImVec2(static_cast<float>(fbw), static_cast<float>(fbh));
+
+        ImGui::Render();
+
+        auto snapshot = std::make_shared<ImGuiDrawSnapshot>(*ImGui::GetDrawData());
+        return [snapshot]()
+            {
+                EG_PROFILE_SCOPE("ImGui_ImplOpenGL3_RenderDrawData");
+                ImGui_ImplOpenGL3_RenderDrawData(&snapshot->Data);
+            };
+    }
+
     void ImGuiLayer::End()
     {
         EG_PROFILE_FUNCTION();
@@ -29,6 +29,14 @@ namespace Engine {
         // Per-frame
         void Begin();
         void End();
+        // Render-thread mode: finishes the frame on this thread and returns a
+        // task that draws a snapshot of it on the thread owning the context.
+        std::function<void()> EndDeferred();
+
+        // Call while the context is still current on this thread: creates the
+        // GL objects up front and turns off multi-viewports, whose platform
+        // windows need the context on the main thread.
+        void PrepareForRenderThread();
 
         // Configuration helpers
         void SetDockingEnabled(bool enable) { m_Opts.EnableDocking = enable; }
@@ -0,0 +1,127 @@
+#include "enginepch.h"
+#include "SpatialHash.h"
+#include <cmath>
+
+namespace Engine {
+
+    static CollisionShape MakeShape(const glm::vec2* points, uint32_t count)
+    {
+        EG_CORE_CHECK(count == 3 || count == 4, "CollisionShape needs 3 or 4 points");
+        CollisionShape s;
+        s.Count = count;
+        float area = 0.0f;
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec2& a = points[i];
+            const glm::vec2& b = points[(i + 1) % count];
+            area += a.x * b.y - a.y * b.x;
+        }
+        s.Min = s.Max = points[0];
+        for (uint32_t i = 0; i < count; ++i) {
+            s.Points[i] = area >= 0.0f ? points[i] : points[count - 1 - i];
+            s.Min = glm::min(s.Min, points[i]);
+            s.Max = glm::max(s.Max, points[i]);
+        }
+        return s;
+    }
+
+    SpatialHash::SpatialHash(float cellSize, uint32_t buckets)
+        : m_CellSize(cellSize), m_InvCellSize(1.0f / cellSize)
+    {
+        uint32_t n = 1;
+        while (n < buckets) n <<= 1;
+        m_Mask = n - 1;
+        m_Start.assign(n + 1, 0);
+    }
+
+    uint32_t SpatialHash::AddTriangle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c)
+    {
+        const glm::vec2 p[3] = { a, b, c };
+        return Add(p, 3);
+    }
+
+    uint32_t SpatialHash::AddBox(const glm::vec2& min, const glm::vec2& max)
+    {
+        const glm::vec2 p[4] = { min, { max.x, min.y }, max, { min.x, max.y } };
+        return Add(p, 4);
+    }
+
+    uint32_t SpatialHash::Add(const glm::vec2* points, uint32_t count)
+    {
+        m_Shapes.push_back(MakeShape(points, count));
+        m_Dirty = true;
+        return (uint32_t)m_Shapes.size() - 1;
+    }
+
+    void SpatialHash::Set(uint32_t id, const glm::vec2* points, uint32_t count)
+    {
+        m_Shapes[id] = MakeShape(points, count);
+        m_Dirty = true;
+    }
+
+    void SpatialHash::Clear()
+    {
+        m_Shapes.clear();
+        m_Dirty = true;
+    }
+
+    uint32_t SpatialHash::Bucket(int x, int y) const
+    {
+        return ((uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u) & m_Mask;
+    }
+
+    void SpatialHash::Update()
+    {
+        if (!m_Dirty) return;
+        m_Dirty = false;
+
+        // Counting sort of (bucket, shape): count, prefix sum, fill
+        auto forCells = [this](const CollisionShape& s, auto&& fn) {
+            const int x0 = (int)std::floor(s.Min.x * m_InvCellSize), x1 = (int)std::floor(s.Max.x * m_InvCellSize);
+            const int y0 = (int)std::floor(s.Min.y * m_InvCellSize), y1 = (int)std::floor(s.Max.y * m_InvCellSize);
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x) fn(Bucket(x, y));
+        };
+
+        std::fill(m_Start.begin(), m_Start.end(), 0);
+        for (const CollisionShape& s : m_Shapes) forCells(s, [this](uint32_t b) { m_Start[b + 1]++; });
+        for (size_t b = 1; b < m_Start.size(); ++b) m_Start[b] += m_Start[b - 1];
+
+        m_Entries.resize(m_Start.back());
+        std::vector<uint32_t> fill(m_Start.begin(), m_Start.end() - 1);
+        for (uint32_t id = 0; id < (uint32_t)m_Shapes.size(); ++id)
+            forCells(m_Shapes[id], [&](uint32_t b) { m_Entries[fill[b]++] = id; });
+    }
+
+    bool SpatialHash::Inside(const CollisionShape& s, const glm::vec2& p, Contact& contact)
+    {
+        if (p.x < s.Min.x || p.y < s.Min.y || p.x > s.Max.x || p.y > s.Max.y) return false;
+        float best = INFINITY;
+        for (uint32_t i = 0; i < s.Count; ++i) {
+            const glm::vec2& a = s.Points[i];
+            const glm::vec2 e = s.Points[(i + 1) % s.Count] - a;
+            const float len = glm::length(e);
+            if (len <= 0.0f) continue;
+            // Distance inside this edge; negative means outside the polygon
+            const float d = (e.x * (p.y - a.y) - e.y * (p.x - a.x)) / len;
+            if (d < 0.0f) return false;
+            if (d < best) {
+                best = d;
+                contact.Normal = { e.y / len, -e.x / len };
+            }
+        }
+        contact.Depth = best;
+        return true;
+    }
+
+    bool SpatialHash::Query(const glm::vec2& p, Contact& contact) const
+    {
+        EG_CORE_CHECK(!m_Dirty, "SpatialHash queried before Update");
+        const uint32_t b = Bucket((int)std::floor(p.x * m_InvCellSize), (int)std::floor(p.y * m_InvCellSize));
+        for (uint32_t i = m_Start[b], end = m_Start[b + 1]; i < end; ++i) {
+            const uint32_t id = m_Entries[i];
+            if (Inside(m_Shapes[id], p, contact)) { contact.Shape = id; return true; }
+        }
+        return false;
+    }
+
+} // namespace Engine
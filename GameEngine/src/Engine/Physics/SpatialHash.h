@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Engine
+{
+    // Convex polygon with 3 or 4 corners, stored counter-clockwise.
+    struct CollisionShape {
+        std::array<glm::vec2, 4> Points;
+        uint32_t  Count = 0;
+        glm::vec2 Min{ 0.0f }, Max{ 0.0f };
+    };
+
+    // Where a point is inside a shape: pushing it Depth along Normal
+    // (unit, outward) puts it back on the closest edge.
+    struct Contact {
+        glm::vec2 Normal{ 0.0f };
+        float     Depth = 0.0f;
+        uint32_t  Shape = 0;
+    };
+
+    // Static shapes bucketed on a uniform grid. Each shape is listed in
+    // every cell its bounds overlap, and cells hash into a fixed table of
+    // buckets, so the world needs no bounds and a point query only tests
+    // the shapes of one bucket.
+    //
+    // Changing shapes marks the table dirty; Update rebuilds it, once a
+    // frame at most. Query is const and safe from many threads between
+    // Updates.
+    class SpatialHash {
+    public:
+        // buckets is rounded up to a power of two
+        explicit SpatialHash(float cellSize = 4.0f, uint32_t buckets = 4096);
+
+        uint32_t AddTriangle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c);
+        uint32_t AddBox(const glm::vec2& min, const glm::vec2& max);
+        // 3 or 4 points of a convex polygon, either winding
+        uint32_t Add(const glm::vec2* points, uint32_t count);
+        void Set(uint32_t id, const glm::vec2* points, uint32_t count);
+        void Clear();
+
+        void Update();
+
+        // First shape containing p
+        bool Query(const glm::vec2& p, Contact& contact) const;
+        bool Contains(const glm::vec2& p) const { Contact c; return Query(p, c); }
+
+        size_t GetShapeCount() const { return m_Shapes.size(); }
+        const CollisionShape& GetShape(uint32_t id) const { return m_Shapes[id]; }
+        float GetCellSize() const { return m_CellSize; }
+        // Bucket entries after the last rebuild (a shape once per cell it overlaps)
+        size_t GetEntryCount() const { return m_Entries.size(); }
+
+        // Exact test against one shape, without the grid
+        static bool Inside(const CollisionShape& shape, const glm::vec2& p, Contact& contact);
+
+    private:
+        uint32_t Bucket(int x, int y) const;
+
+        float m_CellSize, m_InvCellSize;
+        uint32_t m_Mask;
+        std::vector<CollisionShape> m_Shapes;
+        std::vector<uint32_t> m_Start;   // bucket b holds m_Entries[m_Start[b], m_Start[b + 1])
+        std::vector<uint32_t> m_Entries; // shape ids
+        bool m_Dirty = false;
+    };
+} // namespace Engine
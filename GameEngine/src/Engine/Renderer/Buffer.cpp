@@ -11,6 +11,13 @@ namespace Engine {
         return fn(vertices, size);
     }
 
+    Shared<VertexBuffer> VertexBuffer::Create(uint32_t size) {
+        EG_PROFILE_FUNCTION();
+        auto fn = Detail::GetCreators().vbDynamic;
+        EG_CORE_CHECK(fn, "VertexBuffer (dynamic) creator not bound!");
+        return fn(size);
+    }
+
     Shared<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
         EG_PROFILE_FUNCTION();
         auto fn = Detail::GetCreators().ib;
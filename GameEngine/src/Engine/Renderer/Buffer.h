@@ -71,6 +71,25 @@ namespace Engine {
         const std::vector<BufferElement>& Elements() const { return m_Elements; }
         uint32_t Stride() const { return m_Stride; }
 
+        // Step rate of the stream: 0 = per vertex, N = advance every N instances.
+        uint32_t Divisor() const { return m_Divisor; }
+        void SetDivisor(uint32_t divisor) { m_Divisor = divisor; Recalculate(); }
+
+        // Identifies the vertex format (types, offsets, normalization, stride, divisor).
+        // Attribute names are not part of it: locations are assigned in order.
+        uint64_t Hash() const { return m_Hash; }
+        // Field-by-field check behind Hash, for callers that must not trust a collision.
+        bool SameFormat(const BufferLayout& other) const {
+            if (m_Stride != other.m_Stride || m_Divisor != other.m_Divisor
+                || m_Elements.size() != other.m_Elements.size()) return false;
+            for (size_t i = 0; i < m_Elements.size(); ++i) {
+                const BufferElement& a = m_Elements[i];
+                const BufferElement& b = other.m_Elements[i];
+                if (a.Type != b.Type || a.Offset != b.Offset || a.Normalized != b.Normalized) return false;
+            }
+            return true;
+        }
+
         auto begin() { return m_Elements.begin(); }
         auto end() { return m_Elements.end(); }
         auto begin() const { return m_Elements.begin(); }
@@ -85,9 +104,22 @@ namespace Engine {
                 offset += e.Size;
                 m_Stride += e.Size;
             }
+
+            // FNV-1a over the format-relevant fields
+            m_Hash = 1469598103934665603ull;
+            auto mix = [this](uint64_t v) { m_Hash = (m_Hash ^ v) * 1099511628211ull; };
+            for (const auto& e : m_Elements) {
+                mix((uint64_t)e.Type);
+                mix((uint64_t)e.Offset);
+                mix(e.Normalized ? 1ull : 0ull);
+            }
+            mix((uint64_t)m_Stride);
+            mix((uint64_t)m_Divisor);
         }
         std::vector<BufferElement> m_Elements;
         uint32_t m_Stride = 0;
+        uint32_t m_Divisor = 0;
+        uint64_t m_Hash = 0;
     };
 
     class ENGINE_API VertexBuffer {
@@ -98,7 +130,14 @@ namespace Engine {
         virtual const BufferLayout& GetLayout() const = 0;
         virtual void SetLayout(const BufferLayout& layout) = 0;
 
+        // Partial update of the buffer contents (offset/size in bytes).
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+        virtual uint32_t GetSize() const = 0;
+
+        // Static buffer initialized from `vertices`.
         static Shared<VertexBuffer> Create(float* vertices, uint32_t size);
+        // Dynamic buffer of `size` bytes, filled later through SetData.
+        static Shared<VertexBuffer> Create(uint32_t size);
     };
 
     class ENGINE_API IndexBuffer {
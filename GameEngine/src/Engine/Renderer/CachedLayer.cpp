@@ -0,0 +1,46 @@
+#include "enginepch.h"
+#include "CachedLayer.h"
+#include "RenderCommand.h"
+#include "Renderer2D.h"
+#include "CommandList.h"
+
+namespace Engine {
+
+    CachedLayer::CachedLayer(uint32_t width, uint32_t height, RenderFn render, const glm::vec4& clearColor)
+        : m_Framebuffer(Framebuffer::Create({ width, height, true })),
+          m_Render(std::move(render)), m_ClearColor(clearColor) {
+    }
+
+    void CachedLayer::Resize(uint32_t width, uint32_t height) {
+        const FramebufferSpec& spec = m_Framebuffer->GetSpec();
+        if (width == spec.Width && height == spec.Height) return;
+        m_Framebuffer->Resize(width, height);
+        m_Valid = false;
+    }
+
+    bool CachedLayer::Update() {
+        if (m_Valid) return false;
+        EG_PROFILE_FUNCTION();
+
+        CommandList* rec = CommandList::Recording();
+        if (rec) rec->BindFramebuffer(m_Framebuffer);
+        else m_Framebuffer->Bind();
+
+        RenderCommand::SetClearColor(m_ClearColor);
+        RenderCommand::Clear();
+        if (m_Render) m_Render();
+
+        if (rec) rec->UnbindFramebuffer();
+        else m_Framebuffer->Unbind();
+
+        m_Valid = true;
+        m_Stats.Renders++;
+        return true;
+    }
+
+    void CachedLayer::Composite(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& tint) const {
+        Renderer2D::DrawQuad(pos, size, GetTexture(), 1.0f, tint);
+        m_Stats.Composites++;
+    }
+
+} // namespace Engine
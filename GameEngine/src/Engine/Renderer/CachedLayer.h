@@ -0,0 +1,53 @@
+#pragma once
+#include <functional>
+#include <glm/glm.hpp>
+#include "Engine/Core/Core.h"
+#include "Framebuffer.h"
+
+namespace Engine {
+
+    // Render-to-texture cache for content that rarely changes (HUD, static
+    // backgrounds, menus). The render callback draws into an offscreen
+    // target only after Invalidate(); every other frame costs one quad.
+    class CachedLayer {
+    public:
+        using RenderFn = std::function<void()>;
+
+        // `render` issues ordinary draws (e.g. a Renderer2D scene) and sees a
+        // viewport of width x height. The target is cleared to `clearColor`
+        // first; keep it transparent to composite over other content.
+        CachedLayer(uint32_t width, uint32_t height, RenderFn render,
+            const glm::vec4& clearColor = glm::vec4(0.0f));
+
+        void Invalidate() { m_Valid = false; }
+        bool IsValid() const { return m_Valid; }
+
+        // Reallocates the target and invalidates.
+        void Resize(uint32_t width, uint32_t height);
+
+        // Re-renders if invalidated; returns true when it did. Call outside a
+        // Renderer2D scene. Leaves the clear color set to the layer's.
+        bool Update();
+
+        // One textured quad; call inside a Renderer2D scene.
+        void Composite(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& tint = glm::vec4(1.0f)) const;
+
+        const Shared<Texture2D>& GetTexture() const { return m_Framebuffer->GetColorAttachment(); }
+        const Shared<Framebuffer>& GetFramebuffer() const { return m_Framebuffer; }
+
+        struct Statistics {
+            uint32_t Renders = 0;
+            uint32_t Composites = 0;
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats = {}; }
+
+    private:
+        Shared<Framebuffer> m_Framebuffer;
+        RenderFn            m_Render;
+        glm::vec4           m_ClearColor;
+        bool                m_Valid = false;
+        mutable Statistics  m_Stats;
+    };
+
+} // namespace Engine
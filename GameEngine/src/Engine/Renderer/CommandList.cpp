@@ -0,0 +1,499 @@
+#include "enginepch.h"
+#include "CommandList.h"
+#include "RenderCommand.h"
+#include "Renderer2D.h"
+#include <cstring>
+
+namespace Engine {
+
+    // Payloads are plain data; resources are indices into the list's tables.
+    namespace Cmd {
+        struct Viewport      { uint32_t X, Y, W, H; };
+        struct ClearColor    { glm::vec4 Color; };
+        struct Blend         { uint32_t Mode; };
+        struct Empty         {};
+        struct BindShader    { uint32_t Shader; };
+        struct Uniform       { uint32_t NameLength, ValueSize; }; // + value + name
+        struct BindTexture   { uint32_t Texture, Slot; };
+        struct Upload        { uint32_t Buffer, Size, Offset; };  // + bytes
+        struct BindTarget    { uint32_t Framebuffer; };
+        struct Resize        { uint32_t Framebuffer, Width, Height; };
+        struct Draw          { uint32_t VertexArray, Count, BaseInstance; };
+        struct ViewProj      { glm::mat4 Matrix; };
+        struct Quad {
+            glm::vec4 Color;
+            glm::vec3 Position;
+            glm::vec2 Size;
+            float     Rotation;
+            float     Tiling;
+            int32_t   Texture; // -1 = untextured
+            int32_t   Source = -1; // framebuffer whose color attachment is the texture
+        };
+        struct Quads         { uint32_t Count; }; // + Count * 4 positions, then Count * 4 attributes
+    }
+
+    // Bounds one MapQuads command; callers loop like they do over batches
+    static constexpr uint32_t kMaxSpanQuads = 1u << 16;
+    static constexpr uint32_t kQuadVertexBytes = 4 * (uint32_t)(sizeof(glm::vec3) + sizeof(Renderer2D::QuadAttribVertex));
+
+    static constexpr uint32_t kCommandAlign = 8;
+
+    static uint32_t AlignUp(size_t n) {
+        return (uint32_t)((n + kCommandAlign - 1) & ~(size_t)(kCommandAlign - 1));
+    }
+
+    CommandList::CommandList(size_t reserveBytes) {
+        m_Buffer.reserve(reserveBytes);
+        m_Segments.push_back({ 0, 0, 0 });
+    }
+
+    void CommandList::Reset() {
+        m_Buffer.clear();
+        m_Segments.assign(1, { 0, 0, 0 });
+        m_CommandCount = 0;
+        m_MappedQuads = SIZE_MAX;
+        m_Shaders.clear();
+        m_Textures.clear();
+        m_VertexArrays.clear();
+        m_VertexBuffers.clear();
+        m_Framebuffers.clear();
+    }
+
+    static CommandList*& RecordingSlot() {
+        thread_local CommandList* list = nullptr;
+        return list;
+    }
+
+    CommandList* CommandList::Recording() {
+        return RecordingSlot();
+    }
+
+    void CommandList::SetRecording(CommandList* list) {
+        RecordingSlot() = list;
+    }
+
+    void CommandList::SetSortKey(uint64_t key) {
+        Segment& last = m_Segments.back();
+        if (last.Begin == last.End) { last.Key = key; return; } // nothing recorded under the old key
+        m_Segments.push_back({ key, (uint32_t)m_Buffer.size(), (uint32_t)m_Buffer.size() });
+    }
+
+    template<typename T>
+    T& CommandList::Push(CommandType type, uint32_t trailingBytes) {
+        const uint32_t size = AlignUp(sizeof(CommandHeader) + sizeof(T) + trailingBytes);
+        const size_t at = m_Buffer.size();
+        m_Buffer.resize(at + size);
+
+        auto* header = reinterpret_cast<CommandHeader*>(&m_Buffer[at]);
+        header->Type = type;
+        header->Reserved = 0;
+        header->Size = size;
+
+        m_Segments.back().End = (uint32_t)m_Buffer.size();
+        m_CommandCount++;
+        return *new (header + 1) T{};
+    }
+
+    uint8_t* CommandList::Trailing(const void* cmd, size_t payloadSize) {
+        return (uint8_t*)cmd + payloadSize;
+    }
+
+    template<typename T>
+    uint32_t CommandList::Ref(std::vector<Shared<T>>& table, const Shared<T>& res) {
+        // Lists usually reference the same few resources back to back
+        if (!table.empty() && table.back() == res) return (uint32_t)table.size() - 1;
+        table.push_back(res);
+        return (uint32_t)table.size() - 1;
+    }
+
+    void CommandList::SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+        Push<Cmd::Viewport>(CommandType::SetViewport) = { x, y, w, h };
+    }
+
+    void CommandList::SetClearColor(const glm::vec4& color) {
+        Push<Cmd::ClearColor>(CommandType::SetClearColor).Color = color;
+    }
+
+    void CommandList::Clear() {
+        Push<Cmd::Empty>(CommandType::Clear);
+    }
+
+    void CommandList::SetBlendMode(RendererAPI::BlendMode mode) {
+        Push<Cmd::Blend>(CommandType::SetBlendMode).Mode = (uint32_t)mode;
+    }
+
+    void CommandList::SetOverdrawCounting(bool enabled) {
+        Push<Cmd::Blend>(CommandType::SetOverdrawCounting).Mode = enabled ? 1u : 0u;
+    }
+
+    void CommandList::BindShader(const Shared<Shader>& shader) {
+        const uint32_t idx = Ref(m_Shaders, shader);
+        Push<Cmd::BindShader>(CommandType::BindShader).Shader = idx;
+    }
+
+    void CommandList::PushUniform(CommandType type, const std::string& name, const void* value, uint32_t valueSize) {
+        auto& u = Push<Cmd::Uniform>(type, valueSize + (uint32_t)name.size());
+        u.NameLength = (uint32_t)name.size();
+        u.ValueSize = valueSize;
+        uint8_t* extra = Trailing(&u, sizeof(Cmd::Uniform));
+        std::memcpy(extra, value, valueSize);
+        std::memcpy(extra + valueSize, name.data(), name.size());
+    }
+
+    void CommandList::SetInt(const std::string& name, int value) {
+        PushUniform(CommandType::SetInt, name, &value, sizeof(value));
+    }
+
+    void CommandList::SetFloat(const std::string& name, float value) {
+        PushUniform(CommandType::SetFloat, name, &value, sizeof(value));
+    }
+
+    void CommandList::SetFloat4(const std::string& name, const glm::vec4& value) {
+        PushUniform(CommandType::SetFloat4, name, &value, sizeof(value));
+    }
+
+    void CommandList::SetMat4(const std::string& name, const glm::mat4& value) {
+        PushUniform(CommandType::SetMat4, name, &value, sizeof(value));
+    }
+
+    void CommandList::BindTexture(const Shared<Texture2D>& texture, uint32_t slot) {
+        const uint32_t idx = Ref(m_Textures, texture);
+        Push<Cmd::BindTexture>(CommandType::BindTexture) = { idx, slot };
+    }
+
+    void CommandList::UploadVertices(const Shared<VertexBuffer>& vb, const void* data, uint32_t size, uint32_t offset) {
+        const uint32_t idx = Ref(m_VertexBuffers, vb);
+        auto& u = Push<Cmd::Upload>(CommandType::UploadVertices, size);
+        u = { idx, size, offset };
+        std::memcpy(Trailing(&u, sizeof(Cmd::Upload)), data, size);
+    }
+
+    void CommandList::BindFramebuffer(const Shared<Framebuffer>& framebuffer) {
+        const uint32_t idx = Ref(m_Framebuffers, framebuffer);
+        Push<Cmd::BindTarget>(CommandType::BindFramebuffer).Framebuffer = idx;
+    }
+
+    void CommandList::UnbindFramebuffer() {
+        Push<Cmd::Empty>(CommandType::UnbindFramebuffer);
+    }
+
+    void CommandList::ResizeFramebuffer(const Shared<Framebuffer>& framebuffer, uint32_t width, uint32_t height) {
+        const uint32_t idx = Ref(m_Framebuffers, framebuffer);
+        Push<Cmd::Resize>(CommandType::ResizeFramebuffer) = { idx, width, height };
+    }
+
+    void CommandList::DrawIndexed(const Shared<VertexArray>& va, uint32_t indexCount) {
+        const uint32_t idx = Ref(m_VertexArrays, va);
+        Push<Cmd::Draw>(CommandType::DrawIndexed) = { idx, indexCount, 0 };
+    }
+
+    void CommandList::DrawIndexedInstanced(const Shared<VertexArray>& va, uint32_t instanceCount, uint32_t baseInstance) {
+        const uint32_t idx = Ref(m_VertexArrays, va);
+        Push<Cmd::Draw>(CommandType::DrawIndexedInstanced) = { idx, instanceCount, baseInstance };
+    }
+
+    void CommandList::SetViewProjection(const glm::mat4& viewProjection) {
+        Push<Cmd::ViewProj>(CommandType::SetViewProjection).Matrix = viewProjection;
+    }
+
+    void CommandList::DrawQuad(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& color) {
+        Push<Cmd::Quad>(CommandType::Quad) = { color, pos, size, 0.0f, 1.0f, -1 };
+    }
+
+    void CommandList::DrawQuad(const glm::vec3& pos, const glm::vec2& size, const Shared<Texture2D>& texture,
+        float tiling, const glm::vec4& tint) {
+        DrawRotatedQuad(pos, size, 0.0f, texture, tiling, tint);
+    }
+
+    void CommandList::DrawRotatedQuad(const glm::vec3& pos, const glm::vec2& size, float rotation,
+        const glm::vec4& color) {
+        Push<Cmd::Quad>(CommandType::Quad) = { color, pos, size, rotation, 1.0f, -1 };
+    }
+
+    void CommandList::DrawRotatedQuad(const glm::vec3& pos, const glm::vec2& size, float rotation,
+        const Shared<Texture2D>& texture, float tiling, const glm::vec4& tint) {
+        const int32_t idx = (int32_t)Ref(m_Textures, texture);
+        Push<Cmd::Quad>(CommandType::Quad) = { tint, pos, size, rotation, tiling, idx };
+    }
+
+    void CommandList::DrawQuad(const glm::vec3& pos, const glm::vec2& size, const Shared<Framebuffer>& source,
+        float tiling, const glm::vec4& tint) {
+        const int32_t idx = (int32_t)Ref(m_Framebuffers, source);
+        Push<Cmd::Quad>(CommandType::Quad) = { tint, pos, size, 0.0f, tiling, -1, idx };
+    }
+
+    Renderer2D::QuadSpan CommandList::MapQuads(uint32_t count) {
+        EG_CORE_CHECK(m_MappedQuads == SIZE_MAX, "MapQuads before the previous span was committed");
+        count = std::min(count, kMaxSpanQuads);
+        if (count == 0) return {};
+
+        const size_t at = m_Buffer.size();
+        auto& q = Push<Cmd::Quads>(CommandType::Quads, count * kQuadVertexBytes);
+        q.Count = count;
+        m_MappedQuads = at;
+
+        uint8_t* vertices = Trailing(&q, sizeof(Cmd::Quads));
+        Renderer2D::QuadSpan span;
+        span.Positions = reinterpret_cast<glm::vec3*>(vertices);
+        span.Attribs = reinterpret_cast<Renderer2D::QuadAttribVertex*>(span.Positions + count * 4);
+        span.Count = count;
+        return span;
+    }
+
+    void CommandList::CommitQuads(uint32_t count) {
+        EG_CORE_CHECK(m_MappedQuads != SIZE_MAX, "CommitQuads without MapQuads");
+        if (m_MappedQuads == SIZE_MAX) return;
+        const size_t at = m_MappedQuads;
+        m_MappedQuads = SIZE_MAX;
+
+        auto* header = reinterpret_cast<CommandHeader*>(&m_Buffer[at]);
+        auto& q = *reinterpret_cast<Cmd::Quads*>(header + 1);
+        EG_CORE_CHECK(count <= q.Count, "CommitQuads past the mapped span");
+        count = std::min(count, q.Count);
+        if (count == 0) {
+            m_Buffer.resize(at);
+            m_CommandCount--;
+        }
+        else {
+            // Close the gap the unwritten positions leave before the attributes
+            uint8_t* vertices = Trailing(&q, sizeof(Cmd::Quads));
+            if (count < q.Count) {
+                std::memmove(vertices + count * 4 * sizeof(glm::vec3), vertices + q.Count * 4 * sizeof(glm::vec3),
+                    count * 4 * sizeof(Renderer2D::QuadAttribVertex));
+            }
+            q.Count = count;
+            header->Size = AlignUp(sizeof(CommandHeader) + sizeof(Cmd::Quads) + count * kQuadVertexBytes);
+            m_Buffer.resize(at + header->Size);
+        }
+        m_Segments.back().End = (uint32_t)m_Buffer.size();
+    }
+
+    // ---------------------------------------------------------------- replay
+
+    struct CommandList::ReplayState {
+        Shader*   BoundShader = nullptr;
+        std::vector<Framebuffer*> BoundFramebuffers; // innermost last
+        bool      In2DScene = false;
+        bool      QuadsPending = false;
+        glm::mat4 ViewProjection = glm::mat4(1.0f);
+        bool      ViewProjectionChanged = false;
+        CommandQueue::Stats* Stats = nullptr;
+
+        // Anything that is not a quad must see the quads recorded before it.
+        void FlushQuads() {
+            if (!QuadsPending) return;
+            Renderer2D::Flush();
+            QuadsPending = false;
+            BoundShader = nullptr; // Flush binds the quad shader
+        }
+    };
+
+    template<typename T>
+    static const T& Payload(const uint8_t* cmd) {
+        return *reinterpret_cast<const T*>(cmd);
+    }
+
+    void CommandList::Replay(uint32_t begin, uint32_t end, ReplayState& st) const {
+        for (uint32_t at = begin; at < end;) {
+            const auto* header = reinterpret_cast<const CommandHeader*>(&m_Buffer[at]);
+            const uint8_t* p = reinterpret_cast<const uint8_t*>(header + 1);
+            at += header->Size;
+            st.Stats->Commands++;
+
+            if (header->Type == CommandType::Quad || header->Type == CommandType::Quads) {
+                if (!st.In2DScene || st.ViewProjectionChanged) {
+                    if (st.In2DScene) Renderer2D::EndScene();
+                    Renderer2D::BeginScene(st.ViewProjection);
+                    st.In2DScene = true;
+                    st.ViewProjectionChanged = false;
+                    st.BoundShader = nullptr;
+                }
+                st.QuadsPending = true;
+
+                if (header->Type == CommandType::Quads) {
+                    const uint32_t count = Payload<Cmd::Quads>(p).Count;
+                    const auto* positions = reinterpret_cast<const glm::vec3*>(p + sizeof(Cmd::Quads));
+                    const auto* attribs = reinterpret_cast<const Renderer2D::QuadAttribVertex*>(positions + count * 4);
+                    for (uint32_t done = 0; done < count;) {
+                        const Renderer2D::QuadSpan span = Renderer2D::MapQuads(count - done);
+                        std::memcpy(span.Positions, positions + done * 4, span.Count * 4 * sizeof(glm::vec3));
+                        std::memcpy(span.Attribs, attribs + done * 4, span.Count * 4 * sizeof(Renderer2D::QuadAttribVertex));
+                        Renderer2D::CommitQuads(span.Count);
+                        done += span.Count;
+                    }
+                    continue;
+                }
+
+                const auto& q = Payload<Cmd::Quad>(p);
+                if (q.Source >= 0)
+                    Renderer2D::DrawRotatedQuad(q.Position, q.Size, q.Rotation, m_Framebuffers[q.Source]->GetColorAttachment(), q.Tiling, q.Color);
+                else if (q.Texture >= 0)
+                    Renderer2D::DrawRotatedQuad(q.Position, q.Size, q.Rotation, m_Textures[q.Texture], q.Tiling, q.Color);
+                else
+                    Renderer2D::DrawRotatedQuad(q.Position, q.Size, q.Rotation, q.Color);
+                continue;
+            }
+
+            if (header->Type == CommandType::SetViewProjection) {
+                const glm::mat4& m = Payload<Cmd::ViewProj>(p).Matrix;
+                if (m != st.ViewProjection) {
+                    st.FlushQuads();
+                    st.ViewProjection = m;
+                    st.ViewProjectionChanged = true;
+                }
+                continue;
+            }
+
+            st.FlushQuads();
+
+            switch (header->Type) {
+            case CommandType::SetViewport: {
+                const auto& v = Payload<Cmd::Viewport>(p);
+                RenderCommand::SetViewport(v.X, v.Y, v.W, v.H);
+            } break;
+            case CommandType::SetClearColor:
+                RenderCommand::SetClearColor(Payload<Cmd::ClearColor>(p).Color);
+                break;
+            case CommandType::Clear:
+                RenderCommand::Clear();
+                break;
+            case CommandType::SetBlendMode:
+                RenderCommand::SetBlendMode((RendererAPI::BlendMode)Payload<Cmd::Blend>(p).Mode);
+                break;
+            case CommandType::SetOverdrawCounting:
+                RenderCommand::SetOverdrawCounting(Payload<Cmd::Blend>(p).Mode != 0);
+                break;
+            case CommandType::BindShader: {
+                Shader* s = m_Shaders[Payload<Cmd::BindShader>(p).Shader].get();
+                if (s == st.BoundShader) { st.Stats->SkippedStateChanges++; break; }
+                s->Binding();
+                st.BoundShader = s;
+            } break;
+            case CommandType::SetInt:
+            case CommandType::SetFloat:
+            case CommandType::SetFloat4:
+            case CommandType::SetMat4: {
+                EG_CORE_CHECK(st.BoundShader, "Uniform recorded without a bound shader");
+                if (!st.BoundShader) break;
+                const auto& u = Payload<Cmd::Uniform>(p);
+                const uint8_t* value = p + sizeof(Cmd::Uniform);
+                const std::string name((const char*)value + u.ValueSize, u.NameLength);
+                if (header->Type == CommandType::SetInt) {
+                    int v; std::memcpy(&v, value, sizeof(v)); st.BoundShader->UploadInt(name, v);
+                } else if (header->Type == CommandType::SetFloat) {
+                    float v; std::memcpy(&v, value, sizeof(v)); st.BoundShader->UploadFloat(name, v);
+                } else if (header->Type == CommandType::SetFloat4) {
+                    glm::vec4 v; std::memcpy(&v, value, sizeof(v)); st.BoundShader->UploadFloat4(name, v);
+                } else {
+                    glm::mat4 v; std::memcpy(&v, value, sizeof(v)); st.BoundShader->UploadMat4(name, v);
+                }
+            } break;
+            case CommandType::BindTexture: {
+                const auto& t = Payload<Cmd::BindTexture>(p);
+                m_Textures[t.Texture]->Bind(t.Slot);
+            } break;
+            case CommandType::UploadVertices: {
+                const auto& u = Payload<Cmd::Upload>(p);
+                m_VertexBuffers[u.Buffer]->SetData(p + sizeof(Cmd::Upload), u.Size, u.Offset);
+            } break;
+            case CommandType::BindFramebuffer: {
+                Framebuffer* fb = m_Framebuffers[Payload<Cmd::BindTarget>(p).Framebuffer].get();
+                fb->Bind();
+                st.BoundFramebuffers.push_back(fb);
+            } break;
+            case CommandType::UnbindFramebuffer:
+                EG_CORE_CHECK(!st.BoundFramebuffers.empty(), "UnbindFramebuffer without a bound framebuffer");
+                if (st.BoundFramebuffers.empty()) break;
+                st.BoundFramebuffers.back()->Unbind();
+                st.BoundFramebuffers.pop_back();
+                break;
+            case CommandType::ResizeFramebuffer: {
+                const auto& r = Payload<Cmd::Resize>(p);
+                m_Framebuffers[r.Framebuffer]->Resize(r.Width, r.Height);
+            } break;
+            case CommandType::DrawIndexed: {
+                const auto& d = Payload<Cmd::Draw>(p);
+                const auto& va = m_VertexArrays[d.VertexArray];
+                va->Bind();
+                RenderCommand::DrawIndexed(va, d.Count);
+            } break;
+            case CommandType::DrawIndexedInstanced: {
+                const auto& d = Payload<Cmd::Draw>(p);
+                const auto& va = m_VertexArrays[d.VertexArray];
+                va->Bind();
+                RenderCommand::DrawIndexedInstanced(va, d.Count, d.BaseInstance);
+            } break;
+            default:
+                EG_CORE_CHECK(false, "Unknown command in CommandList");
+                break;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------- queue
+
+    void CommandQueue::Submit(CommandList&& list) {
+        if (list.Empty()) return;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Lists.push_back(std::move(list));
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> CommandQueue::SortSegments(const std::vector<const CommandList*>& lists) {
+        std::vector<std::pair<uint32_t, uint32_t>> order;
+        for (uint32_t l = 0; l < (uint32_t)lists.size(); ++l)
+            for (uint32_t s = 0; s < (uint32_t)lists[l]->m_Segments.size(); ++s)
+                if (lists[l]->m_Segments[s].Begin != lists[l]->m_Segments[s].End)
+                    order.emplace_back(l, s);
+
+        // Stable: equal keys replay in submission order
+        std::stable_sort(order.begin(), order.end(), [&lists](const auto& a, const auto& b) {
+            return lists[a.first]->m_Segments[a.second].Key < lists[b.first]->m_Segments[b.second].Key;
+        });
+        return order;
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> CommandQueue::SortedSegments() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::vector<const CommandList*> lists;
+        for (const auto& l : m_Lists) lists.push_back(&l);
+        return SortSegments(lists);
+    }
+
+    void CommandQueue::Execute() {
+        std::vector<CommandList> owned;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            owned.swap(m_Lists);
+        }
+
+        std::vector<const CommandList*> lists;
+        for (const auto& l : owned) lists.push_back(&l);
+        Replay(lists);
+    }
+
+    void CommandQueue::Replay(const std::vector<const CommandList*>& lists) {
+        EG_PROFILE_FUNCTION();
+        const auto order = SortSegments(lists);
+
+        m_Stats = {};
+        m_Stats.Lists = (uint32_t)lists.size();
+        m_Stats.Segments = (uint32_t)order.size();
+
+        // Replay must reach the GPU even if this thread is recording
+        CommandList* recording = CommandList::Recording();
+        CommandList::SetRecording(nullptr);
+
+        CommandList::ReplayState st;
+        st.Stats = &m_Stats;
+        for (const auto& [l, s] : order) {
+            const auto& seg = lists[l]->m_Segments[s];
+            lists[l]->Replay(seg.Begin, seg.End, st);
+        }
+        if (st.In2DScene) Renderer2D::EndScene();
+        for (auto it = st.BoundFramebuffers.rbegin(); it != st.BoundFramebuffers.rend(); ++it)
+            (*it)->Unbind();
+
+        CommandList::SetRecording(recording);
+    }
+
+} // namespace Engine
@@ -0,0 +1,175 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Core/Core.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "Framebuffer.h"
+#include "RendererAPI.h"
+#include "Renderer2D.h"
+#include "VertexArray.h"
+
+namespace Engine {
+
+    enum class CommandType : uint16_t {
+        SetViewport, SetClearColor, Clear, SetBlendMode, SetOverdrawCounting,
+        BindShader, SetInt, SetFloat, SetFloat4, SetMat4,
+        BindTexture, UploadVertices, BindFramebuffer, UnbindFramebuffer, ResizeFramebuffer,
+        DrawIndexed, DrawIndexedInstanced,
+        SetViewProjection, Quad, Quads
+    };
+
+    // Records draw/state commands into one linear block of memory. Recording
+    // never touches the graphics API, so a list can be built on any thread;
+    // the render thread replays it through a CommandQueue.
+    //
+    // Commands are grouped into segments by sort key (SetSortKey). The queue
+    // orders segments of all submitted lists by key; commands inside a
+    // segment keep their recorded order.
+    class CommandList {
+    public:
+        explicit CommandList(size_t reserveBytes = 64 * 1024);
+
+        // Starts a new segment; later segments with a lower key replay first.
+        void SetSortKey(uint64_t key);
+
+        void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+        void SetClearColor(const glm::vec4& color);
+        void Clear();
+        void SetBlendMode(RendererAPI::BlendMode mode);
+        void SetOverdrawCounting(bool enabled);
+
+        // Uniform setters apply to the shader of the last BindShader.
+        void BindShader(const Shared<Shader>& shader);
+        void SetInt(const std::string& name, int value);
+        void SetFloat(const std::string& name, float value);
+        void SetFloat4(const std::string& name, const glm::vec4& value);
+        void SetMat4(const std::string& name, const glm::mat4& value);
+
+        void BindTexture(const Shared<Texture2D>& texture, uint32_t slot = 0);
+        // `data` is copied into the list
+        void UploadVertices(const Shared<VertexBuffer>& vb, const void* data, uint32_t size, uint32_t offset = 0);
+        // Nest like Framebuffer::Bind/Unbind
+        void BindFramebuffer(const Shared<Framebuffer>& framebuffer);
+        void UnbindFramebuffer();
+        // Reallocates at replay, so commands recorded before it still see the old size
+        void ResizeFramebuffer(const Shared<Framebuffer>& framebuffer, uint32_t width, uint32_t height);
+
+        void DrawIndexed(const Shared<VertexArray>& va, uint32_t indexCount = 0);
+        void DrawIndexedInstanced(const Shared<VertexArray>& va, uint32_t instanceCount, uint32_t baseInstance = 0);
+
+        // 2D quads go through Renderer2D at replay; consecutive quads from any
+        // number of lists end up in the same batch.
+        void SetViewProjection(const glm::mat4& viewProjection);
+        void DrawQuad(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& color);
+        void DrawQuad(const glm::vec3& pos, const glm::vec2& size, const Shared<Texture2D>& texture,
+            float tiling = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
+        void DrawRotatedQuad(const glm::vec3& pos, const glm::vec2& size, float rotation,
+            const glm::vec4& color);
+        void DrawRotatedQuad(const glm::vec3& pos, const glm::vec2& size, float rotation,
+            const Shared<Texture2D>& texture, float tiling = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
+        // Textured with `source`'s color attachment as it is at replay: a
+        // resize replaces the attachment, so it cannot be looked up earlier.
+        void DrawQuad(const glm::vec3& pos, const glm::vec2& size, const Shared<Framebuffer>& source,
+            float tiling = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
+        // Quads whose vertices the caller writes into the list itself; what
+        // Renderer2D::MapQuads/CommitQuads forward to while recording. The
+        // span is valid until CommitQuads, with nothing recorded in between.
+        // Untextured only (TexIndex 0): batch slots are assigned at replay.
+        Renderer2D::QuadSpan MapQuads(uint32_t count);
+        void CommitQuads(uint32_t count);
+
+        // Keeps the memory, drops commands and resource references.
+        void Reset();
+
+        // While set, RenderCommand, Renderer and Renderer2D calls made on this
+        // thread are recorded into `list` instead of reaching the GPU.
+        static CommandList* Recording();
+        static void SetRecording(CommandList* list);
+
+        class RecordingScope {
+        public:
+            explicit RecordingScope(CommandList& list) : m_Previous(Recording()) { SetRecording(&list); }
+            ~RecordingScope() { SetRecording(m_Previous); }
+            RecordingScope(const RecordingScope&) = delete;
+            RecordingScope& operator=(const RecordingScope&) = delete;
+        private:
+            CommandList* m_Previous;
+        };
+
+        uint32_t CommandCount() const { return m_CommandCount; }
+        size_t   SizeBytes() const { return m_Buffer.size(); }
+        bool     Empty() const { return m_CommandCount == 0; }
+
+    private:
+        friend class CommandQueue;
+
+        struct CommandHeader {
+            CommandType Type;
+            uint16_t    Reserved;
+            uint32_t    Size; // header + payload + trailing bytes, aligned
+        };
+
+        struct Segment {
+            uint64_t Key;
+            uint32_t Begin, End; // byte range in m_Buffer
+        };
+
+        template<typename T>
+        T& Push(CommandType type, uint32_t trailingBytes = 0);
+        uint8_t* Trailing(const void* cmd, size_t payloadSize);
+        void PushUniform(CommandType type, const std::string& name, const void* value, uint32_t valueSize);
+
+        template<typename T>
+        static uint32_t Ref(std::vector<Shared<T>>& table, const Shared<T>& res);
+
+        struct ReplayState;
+        void Replay(uint32_t begin, uint32_t end, ReplayState& state) const;
+
+        std::vector<uint8_t> m_Buffer;
+        std::vector<Segment> m_Segments;
+        uint32_t m_CommandCount = 0;
+        size_t   m_MappedQuads = SIZE_MAX; // offset of the open MapQuads command
+
+        // Resources referenced by index from the command stream
+        std::vector<Shared<Shader>>       m_Shaders;
+        std::vector<Shared<Texture2D>>    m_Textures;
+        std::vector<Shared<VertexArray>>  m_VertexArrays;
+        std::vector<Shared<VertexBuffer>> m_VertexBuffers;
+        std::vector<Shared<Framebuffer>>  m_Framebuffers;
+    };
+
+    // Collects lists from any thread; Execute (render thread) sorts their
+    // segments by key and replays them, merging quad batches across lists.
+    class CommandQueue {
+    public:
+        void Submit(CommandList&& list);
+
+        void Execute();
+
+        // Sorts and replays `lists` without taking ownership (render thread).
+        void Replay(const std::vector<const CommandList*>& lists);
+
+        struct Stats {
+            uint32_t Lists = 0;
+            uint32_t Segments = 0;
+            uint32_t Commands = 0;
+            uint32_t SkippedStateChanges = 0; // redundant shader binds dropped at replay
+        };
+        const Stats& GetStats() const { return m_Stats; }
+
+        // Replay order as (submission index, segment index) pairs.
+        std::vector<std::pair<uint32_t, uint32_t>> SortedSegments() const;
+
+    private:
+        static std::vector<std::pair<uint32_t, uint32_t>> SortSegments(const std::vector<const CommandList*>& lists);
+
+        mutable std::mutex       m_Mutex;
+        std::vector<CommandList> m_Lists;
+        Stats                    m_Stats;
+    };
+
+} // namespace Engine
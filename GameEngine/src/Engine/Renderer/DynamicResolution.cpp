@@ -0,0 +1,102 @@
+#include "enginepch.h"
+#include "DynamicResolution.h"
+#include "RenderCommand.h"
+#include "Renderer2D.h"
+#include "CommandList.h"
+
+namespace Engine {
+
+    DynamicResolution::DynamicResolution(uint32_t width, uint32_t height)
+        : DynamicResolution(width, height, Settings()) {}
+
+    DynamicResolution::DynamicResolution(uint32_t width, uint32_t height, const Settings& settings)
+        : m_Settings(settings), m_Width(std::max(width, 1u)), m_Height(std::max(height, 1u)) {
+        m_Scale = m_Integral = m_Settings.MaxScale;
+        Allocate();
+    }
+
+    void DynamicResolution::SetSettings(const Settings& settings) {
+        const bool realloc = settings.MaxScale != m_Settings.MaxScale;
+        m_Settings = settings;
+        m_Integral = glm::clamp(m_Integral, m_Settings.MinScale, m_Settings.MaxScale);
+        m_Scale = glm::clamp(m_Scale, m_Settings.MinScale, m_Settings.MaxScale);
+        if (realloc) Allocate();
+    }
+
+    void DynamicResolution::SetEnabled(bool enabled) {
+        m_Enabled = enabled;
+        if (!enabled) m_Scale = m_Integral = m_Settings.MaxScale;
+    }
+
+    void DynamicResolution::OnResize(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0 || (width == m_Width && height == m_Height)) return;
+        m_Width = width;
+        m_Height = height;
+        Allocate();
+    }
+
+    void DynamicResolution::Allocate() {
+        const uint32_t w = std::max(1u, (uint32_t)std::lround(m_Width * m_Settings.MaxScale));
+        const uint32_t h = std::max(1u, (uint32_t)std::lround(m_Height * m_Settings.MaxScale));
+        if (!m_Target) m_Target = Framebuffer::Create({ w, h, true });
+        else if (w != m_TargetWidth || h != m_TargetHeight) RenderCommand::ResizeFramebuffer(m_Target, w, h);
+        m_TargetWidth = w;
+        m_TargetHeight = h;
+    }
+
+    void DynamicResolution::Update(Timestep frameTime) {
+        const float ms = frameTime.GetMilliseconds();
+        m_SmoothedMs = m_SmoothedMs > 0.0f ? glm::mix(m_SmoothedMs, ms, m_Settings.Smoothing) : ms;
+        m_Stats.SmoothedFrameMs = m_SmoothedMs;
+        if (!m_Enabled) return;
+
+        const Settings& s = m_Settings;
+        // > 0: headroom. Clamped so one hitch (loading, alt-tab) cannot slam the scale
+        const float error = glm::clamp((s.TargetFrameMs - m_SmoothedMs) / s.TargetFrameMs, -1.0f, 1.0f);
+
+        // PI with conditional integration: the integral only moves while the
+        // output is not pinned at a limit in the same direction (no windup)
+        const float integral = m_Integral + s.Ki * error;
+        const float output = s.Kp * error + integral;
+        const bool pinnedHigh = output >= s.MaxScale && error > 0.0f;
+        const bool pinnedLow = output <= s.MinScale && error < 0.0f;
+        if (!pinnedHigh && !pinnedLow) m_Integral = glm::clamp(integral, s.MinScale, s.MaxScale);
+
+        float scale = glm::clamp(s.Kp * error + m_Integral, s.MinScale, s.MaxScale);
+        if (s.Step > 0.0f) scale = glm::clamp(std::round(scale / s.Step) * s.Step, s.MinScale, s.MaxScale);
+        if (scale != m_Scale) m_Stats.ScaleChanges++;
+        m_Scale = scale;
+    }
+
+    void DynamicResolution::BeginFrame() {
+        EG_PROFILE_FUNCTION();
+        const float fraction = m_Scale / m_Settings.MaxScale;
+        m_RenderWidth = std::max(1u, (uint32_t)std::lround(m_TargetWidth * fraction));
+        m_RenderHeight = std::max(1u, (uint32_t)std::lround(m_TargetHeight * fraction));
+        m_Stats.Scale = m_Scale;
+        m_Stats.RenderWidth = m_RenderWidth;
+        m_Stats.RenderHeight = m_RenderHeight;
+
+        if (auto* rec = CommandList::Recording()) rec->BindFramebuffer(m_Target);
+        else m_Target->Bind();
+        RenderCommand::SetViewport(0, 0, m_RenderWidth, m_RenderHeight);
+    }
+
+    void DynamicResolution::EndFrame() {
+        EG_PROFILE_FUNCTION();
+        if (auto* rec = CommandList::Recording()) rec->UnbindFramebuffer();
+        else m_Target->Unbind();
+
+        // The rendered corner of the target, stretched over the backbuffer.
+        // Renderer2D's UVs are 0..1 times the tiling factor, which selects it.
+        // The attachment is looked up at replay, after any recorded resize.
+        const float fraction = m_Scale / m_Settings.MaxScale;
+        RenderCommand::Clear(); // depth: the quad must not fail against last frame
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Opaque);
+        Renderer2D::BeginScene(glm::mat4(1.0f));
+        Renderer2D::DrawQuad({ 0.0f, 0.0f, 0.0f }, { 2.0f, 2.0f }, m_Target, fraction);
+        Renderer2D::EndScene();
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Alpha);
+    }
+
+} // namespace Engine
@@ -0,0 +1,79 @@
+#pragma once
+#include <glm/glm.hpp>
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Timestep.h"
+#include "Framebuffer.h"
+
+namespace Engine {
+
+    // Renders the scene into an offscreen target at a fraction of the window
+    // size and upscales it to the backbuffer. The fraction follows measured
+    // frame times: a PI controller lowers it when frames run over budget and
+    // raises it again when there is headroom. Anything drawn after EndFrame
+    // (ImGui) stays at native resolution.
+    //
+    // The target is allocated once at MaxScale; smaller scales only shrink
+    // the viewport, so changing the scale costs nothing. Window resizes are
+    // applied through RenderCommand::ResizeFramebuffer, so while recording
+    // the reallocation happens when the frame is replayed.
+    class DynamicResolution {
+    public:
+        struct Settings {
+            float TargetFrameMs = 1000.0f / 60.0f;
+            float MinScale = 0.5f;
+            float MaxScale = 1.0f;
+            float Kp = 0.2f;         // scale per unit of relative frame-time error
+            float Ki = 0.02f;        // integral gain, per frame
+            float Smoothing = 0.1f;  // weight of a new sample in the frame-time average
+            float Step = 1.0f / 32.0f; // applied scale is a multiple of this
+        };
+
+        // width/height: window (native) size
+        DynamicResolution(uint32_t width, uint32_t height);
+        DynamicResolution(uint32_t width, uint32_t height, const Settings& settings);
+
+        void SetSettings(const Settings& settings);
+        const Settings& GetSettings() const { return m_Settings; }
+
+        // Disabled: renders at MaxScale and ignores frame times.
+        void SetEnabled(bool enabled);
+        bool IsEnabled() const { return m_Enabled; }
+
+        void OnResize(uint32_t width, uint32_t height);
+
+        // Feeds the duration of the last frame and updates the scale.
+        void Update(Timestep frameTime);
+
+        // Scene draws between these go to the scaled target. Call outside a
+        // Renderer2D scene; EndFrame leaves the backbuffer bound.
+        void BeginFrame();
+        void EndFrame();
+
+        float GetScale() const { return m_Scale; }
+
+        struct Statistics {
+            float    Scale = 1.0f;
+            uint32_t RenderWidth = 0, RenderHeight = 0;
+            float    SmoothedFrameMs = 0.0f;
+            uint32_t ScaleChanges = 0;
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+
+    private:
+        void Allocate();
+
+        Settings m_Settings;
+        bool     m_Enabled = true;
+        uint32_t m_Width, m_Height;
+
+        Shared<Framebuffer> m_Target;
+        uint32_t m_TargetWidth = 0, m_TargetHeight = 0; // as requested; the spec lags while recording
+        float m_Scale = 1.0f;      // applied (quantized)
+        float m_Integral = 1.0f;   // controller state; starts at full resolution
+        float m_SmoothedMs = 0.0f;
+        uint32_t m_RenderWidth = 0, m_RenderHeight = 0;
+
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
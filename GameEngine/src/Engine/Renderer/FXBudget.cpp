@@ -0,0 +1,83 @@
+#include "enginepch.h"
+#include "FXBudget.h"
+#include "FXSystem.h"
+#include <algorithm>
+
+namespace Engine {
+	static constexpr float kShare[] = { 0.5f, 0.8f, 1.0f };
+
+
+	FXBudget& FXBudget::Global()
+	{
+		static FXBudget s_Budget;
+		return s_Budget;
+	}
+
+
+	FXBudget::FXBudget(size_t maxParticles) : m_Max(maxParticles) {}
+
+
+	FXBudget::~FXBudget()
+	{
+		for (FXSystem* fx : m_Systems) fx->m_Budget = nullptr;
+	}
+
+
+	void FXBudget::Attach(FXSystem* system)
+	{
+		m_Systems.push_back(system);
+		m_Live += system->GetLiveCount();
+	}
+
+
+	void FXBudget::Detach(FXSystem* system)
+	{
+		m_Systems.erase(std::remove(m_Systems.begin(), m_Systems.end(), system), m_Systems.end());
+		m_Live -= std::min(m_Live, system->GetLiveCount());
+	}
+
+
+	void FXBudget::BeginFrame()
+	{
+		m_Live = 0;
+		for (const FXSystem* fx : m_Systems) m_Live += fx->GetLiveCount();
+
+		const float max = (float)std::max<size_t>(m_Max, 1);
+		m_Frame.Live = m_Live;
+		m_Frame.Pressure = (float)m_Live / max;
+		m_Frame.Demand = (float)(m_Live + m_Frame.Rejected + m_Frame.Throttled) / max;
+
+		m_Stats.Frames++;
+		m_Stats.Last = m_Frame;
+		m_Stats.PeakPressure = std::max(m_Stats.PeakPressure, m_Frame.Pressure);
+		m_Stats.PeakDemand = std::max(m_Stats.PeakDemand, m_Frame.Demand);
+		m_Frame = {};
+	}
+
+
+	bool FXBudget::Admit(FXPriority priority, float& credit, const glm::vec2& pos, float size)
+	{
+		m_Frame.Requested++;
+		if (size < MinWorldSize()) { m_Frame.SubPixel++; return false; }
+
+		const float distance = m_CullDistance > 0.0f ? glm::length(pos - m_Center) : 0.0f;
+		if (distance > m_CullDistance) { m_Frame.Culled++; return false; }
+
+		const float limit = (float)m_Max * kShare[(size_t)priority];
+		if ((float)m_Live >= limit) { m_Frame.Rejected++; return false; }
+
+		const float use = (float)m_Live / limit;
+		if (use > ThrottleStart) {
+			float keep = (1.0f - use) / (1.0f - ThrottleStart);
+			if (m_CullDistance > 0.0f) keep *= 1.0f - 0.5f * distance / m_CullDistance;
+			// Error diffusion instead of a coin flip: deterministic, and the
+			// kept fraction is exact over a run of spawns
+			credit += keep;
+			if (credit < 1.0f) { m_Frame.Throttled++; return false; }
+			credit -= 1.0f;
+		}
+
+		m_Frame.Admitted++;
+		return true;
+	}
+} // namespace Engine
@@ -0,0 +1,92 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Engine
+{
+	class FXSystem;
+
+
+	// Share of the budget a system may fill: Low 50%, Normal 80%, High 100%.
+	enum class FXPriority : uint8_t { Low, Normal, High };
+
+
+	// Particle limit shared by every system attached to it (FXSystem::SetBudget).
+	// Spawns are checked in order:
+	//  - smaller than MinPixelSize on screen: skipped (also at Render)
+	//  - farther than the cull distance from the view centre: culled
+	//  - the budget's live count at the priority's share: rejected
+	//  - past ThrottleStart of that share: thinned out, more so for low
+	//    remaining headroom and for distant spawns
+	// Not thread-safe; spawn and call BeginFrame from one thread.
+	class FXBudget {
+	public:
+		// Systems spawn only from the main thread, so one engine-wide budget
+		static FXBudget& Global();
+
+		explicit FXBudget(size_t maxParticles = 20000);
+		~FXBudget(); // detaches the systems still attached
+		FXBudget(const FXBudget&) = delete;
+		FXBudget& operator=(const FXBudget&) = delete;
+
+		void SetMaxParticles(size_t n) { m_Max = n; }
+		size_t GetMaxParticles() const { return m_Max; }
+
+		// What the camera looks at and how many render target pixels one
+		// world unit covers; pixelsPerUnit = 0 disables the size checks.
+		void SetView(const glm::vec2& center, float pixelsPerUnit) { m_Center = center; m_PixelsPerUnit = pixelsPerUnit; }
+		void SetCullDistance(float distance) { m_CullDistance = distance; } // 0 = never
+		void SetMinPixelSize(float pixels) { m_MinPixels = pixels; }
+
+		// Once per frame, after the systems' Update: recounts live particles
+		// and closes the frame's stats.
+		void BeginFrame();
+
+		struct FrameStats {
+			uint32_t Requested = 0;
+			uint32_t Admitted = 0;
+			uint32_t SubPixel = 0;       // spawns too small to see
+			uint32_t Culled = 0;         // beyond the cull distance
+			uint32_t Rejected = 0;       // priority share full
+			uint32_t Throttled = 0;      // thinned out near the share
+			uint32_t SubPixelDrawn = 0;  // live particles Render skipped
+			size_t   Live = 0;           // at the end of the frame
+			float    Pressure = 0.0f;    // Live / max
+			float    Demand = 0.0f;      // (Live + Rejected + Throttled) / max; > 1 means oversubscribed
+		};
+
+		struct Statistics {
+			uint64_t   Frames = 0;
+			FrameStats Last;
+			float      PeakPressure = 0.0f;
+			float      PeakDemand = 0.0f;
+		};
+		const Statistics& GetStats() const { return m_Stats; }
+
+		static constexpr float ThrottleStart = 0.75f;
+
+	private:
+		friend class FXSystem;
+		void Attach(FXSystem* system);
+		void Detach(FXSystem* system);
+
+		// `credit` carries the system's fractional share of thinned spawns.
+		// An admitted spawn is not counted live yet: the system may still
+		// drop it or overwrite a live particle with it (Added counts it).
+		bool Admit(FXPriority priority, float& credit, const glm::vec2& pos, float size);
+		void Added() { m_Live++; }
+		// Render-side smallest drawn size in world units; 0 = draw all
+		float MinWorldSize() const { return m_PixelsPerUnit > 0.0f ? m_MinPixels / m_PixelsPerUnit : 0.0f; }
+		void CountSubPixelDrawn(uint32_t n) { m_Frame.SubPixelDrawn += n; }
+
+		std::vector<FXSystem*> m_Systems;
+		size_t m_Max;
+		size_t m_Live = 0; // at BeginFrame plus added since
+		glm::vec2 m_Center{ 0.0f };
+		float m_PixelsPerUnit = 0.0f;
+		float m_CullDistance = 0.0f;
+		float m_MinPixels = 1.0f;
+		FrameStats m_Frame;
+		Statistics m_Stats;
+	};
+}
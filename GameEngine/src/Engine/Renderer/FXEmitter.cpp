@@ -0,0 +1,64 @@
+#include "enginepch.h"
+#include "FXEmitter.h"
+#include <cmath>
+
+namespace Engine {
+	FXEmitter::FXEmitter(FXSystem& system, const FXEmitterDesc& desc)
+		: m_System(&system), m_Desc(desc)
+	{
+		m_Curves = system.AddCurves(desc.Color, desc.Size, desc.Speed);
+	}
+
+
+	void FXEmitter::Restart()
+	{
+		m_Time = 0.0f;
+		m_Pending = 0.0f;
+		m_Finished = false;
+	}
+
+
+	void FXEmitter::Update(Timestep dt)
+	{
+		if (!m_Active || m_Finished) return;
+		float remaining = dt.GetSeconds();
+		const float duration = m_Desc.Duration;
+		while (remaining > 0.0f) {
+			const float end = duration > 0.0f ? std::min(m_Time + remaining, duration) : m_Time + remaining;
+			EmitWindow(m_Time, end);
+			remaining -= end - m_Time;
+			m_Time = end;
+			if (duration <= 0.0f || m_Time < duration) break;
+			if (!m_Desc.Loop) { m_Finished = true; break; }
+			m_Time = 0.0f;
+		}
+	}
+
+
+	void FXEmitter::EmitWindow(float from, float to)
+	{
+		m_Pending += m_Desc.Rate * (to - from);
+		const float whole = std::floor(m_Pending);
+		m_Pending -= whole;
+		Emit((uint32_t)whole);
+
+		for (const FXBurst& b : m_Desc.Bursts) {
+			// First repetition at or after `from`
+			uint32_t c = 0;
+			if (b.Interval > 0.0f && from > b.Time) c = (uint32_t)std::ceil((from - b.Time) / b.Interval);
+			for (; b.Cycles == 0 || c < b.Cycles; ++c) {
+				const float t = b.Time + (float)c * b.Interval;
+				if (t >= to) break;
+				if (t >= from) Emit(b.Count);
+				if (b.Interval <= 0.0f) break;
+			}
+		}
+	}
+
+
+	void FXEmitter::Emit(uint32_t count)
+	{
+		m_System->Spawn(m_Desc.Particle, m_Curves, count);
+		m_Spawned += count;
+	}
+} // namespace Engine
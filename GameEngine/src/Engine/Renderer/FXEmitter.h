@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Core/Timestep.h"
+#include "FXSystem.h"
+
+namespace Engine
+{
+	// `Count` particles at `Time` seconds into the emitter's cycle, then
+	// again every `Interval` seconds; Cycles = 0 repeats forever.
+	struct FXBurst {
+		float Time = 0.0f;
+		uint32_t Count = 1;
+		uint32_t Cycles = 1;
+		float Interval = 0.0f;
+	};
+
+
+	// Declarative emitter: what one particle looks like, how it changes over
+	// its lifetime and when particles are emitted.
+	struct FXEmitterDesc {
+		FXSpec Particle; // colorStart/colorEnd/sizeEnd are replaced by the curves
+
+		FXCurve<glm::vec4> Color{ glm::vec4(1.0f) };
+		FXCurve<float> Size{ 1.0f };  // times Particle.sizeStart
+		FXCurve<float> Speed{ 1.0f }; // times the spawn velocity
+
+		float Rate = 0.0f; // particles per second
+		std::vector<FXBurst> Bursts;
+
+		float Duration = 0.0f; // cycle length in seconds; 0 = one endless cycle
+		bool Loop = true;      // restart the cycle instead of finishing
+	};
+
+
+	// Emits into an FXSystem, which may be shared by several emitters. The
+	// curves are baked into the system's lookup tables on construction.
+	class FXEmitter {
+	public:
+		FXEmitter(FXSystem& system, const FXEmitterDesc& desc);
+
+		void SetPosition(const glm::vec2& pos) { m_Desc.Particle.pos = pos; }
+		// Per-frame changes to the spawned particle (velocity, life, ...)
+		FXSpec& Particle() { return m_Desc.Particle; }
+
+		// An inactive emitter neither emits nor advances its cycle
+		void SetActive(bool active) { m_Active = active; }
+		bool IsActive() const { return m_Active; }
+
+		void Update(Timestep dt);
+		void Restart();
+
+		bool IsFinished() const { return m_Finished; }
+		float GetTime() const { return m_Time; } // within the current cycle
+		uint64_t GetSpawnedCount() const { return m_Spawned; }
+
+	private:
+		// Spawns for the part of the cycle in [from, to)
+		void EmitWindow(float from, float to);
+		void Emit(uint32_t count);
+
+		FXSystem* m_System;
+		FXEmitterDesc m_Desc;
+		uint16_t m_Curves;
+		float m_Time = 0.0f;
+		float m_Pending = 0.0f; // fractional particles owed by Rate
+		bool m_Active = true;
+		bool m_Finished = false;
+		uint64_t m_Spawned = 0;
+	};
+}
@@ -1,68 +1,364 @@
 #include "enginepch.h"
 #include "FXSystem.h"
-#include <glm/gtc/constants.hpp> 
-#include <glm/common.hpp> 
-#include <cstdlib>
+#include "Engine/Core/ThreadPool.h"
+#include "Engine/Physics/SpatialHash.h"
+#include <glm/gtc/constants.hpp>
+#include <glm/common.hpp>
+#include <atomic>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EG_FX_SSE2 1
+#include <emmintrin.h>
+#else
+#define EG_FX_SSE2 0
+#endif
 
 namespace Engine {
-	FXSystem::FXSystem() { ResizePool(1000); }
+	// Advances [begin, end) by dt; both are multiples of FXSystem::Lanes.
+	// Particles whose time runs out this step stop in place with left = 0;
+	// dead ones are masked the same way instead of being skipped.
+	static void Integrate(FXStreams& p, size_t begin, size_t end, float dt)
+	{
+		float* x = p.x.data();
+		float* y = p.y.data();
+		const float* vx = p.vx.data();
+		const float* vy = p.vy.data();
+		const float* speed = p.speed.data();
+		float* rot = p.rot.data();
+		float* left = p.left.data();
+
+#if EG_FX_SSE2
+		const __m128 d = _mm_set1_ps(dt), spin = _mm_set1_ps(0.01f * dt), zero = _mm_setzero_ps();
+		for (size_t i = begin; i < end; i += 4) {
+			const __m128 l = _mm_sub_ps(_mm_loadu_ps(left + i), d);
+			const __m128 alive = _mm_cmpgt_ps(l, zero);
+			const __m128 da = _mm_mul_ps(_mm_loadu_ps(speed + i), _mm_and_ps(alive, d));
+			_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), da)));
+			_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), da)));
+			_mm_storeu_ps(rot + i, _mm_add_ps(_mm_loadu_ps(rot + i), _mm_and_ps(alive, spin)));
+			_mm_storeu_ps(left + i, _mm_max_ps(l, zero));
+		}
+#else
+		for (size_t i = begin; i < end; ++i) {
+			const float l = left[i] - dt;
+			const float da = speed[i] * (l > 0.0f ? dt : 0.0f);
+			x[i] += vx[i] * da;
+			y[i] += vy[i] * da;
+			rot[i] += 0.01f * (l > 0.0f ? dt : 0.0f);
+			left[i] = std::max(l, 0.0f);
+		}
+#endif
+	}
+
+
+	static uint64_t NextStream()
+	{
+		static std::atomic<uint64_t> next{ 0 };
+		return next.fetch_add(1, std::memory_order_relaxed);
+	}
+
+
+	FXSystem::FXSystem() : m_Rng(0x853c49e6748fea9bull, NextStream()) { ResizePool(1000); }
+
+
+	FXSystem::~FXSystem() { SetBudget(nullptr); }
+
+
+	void FXSystem::SetBudget(FXBudget* budget, FXPriority priority)
+	{
+		m_Priority = priority;
+		if (budget == m_Budget) return;
+		if (m_Budget) m_Budget->Detach(this);
+		m_Budget = budget;
+		m_BudgetCredit = 0.0f;
+		if (m_Budget) m_Budget->Attach(this);
+	}
 
 
 	void FXSystem::ResizePool(size_t n) {
-		m_Pool.clear();
-		m_Pool.resize(n);
+		const size_t padded = (n + Lanes - 1) / Lanes * Lanes;
+		FXStreams& p = m_Streams;
+		for (auto* s : { &p.x, &p.y, &p.vx, &p.vy, &p.rot, &p.size }) s->assign(padded, 0.0f);
+		p.left.assign(padded, 0.0f);
+		p.life.assign(padded, 1.0f); // never 0: Render divides by it
+		p.speed.assign(padded, 1.0f);
+		p.curves.assign(padded, 0);
+		m_Size = n;
+		m_Live = 0;
 		m_Head = 0;
 	}
 
 
+	void FXSystem::SetCollision(const SpatialHash* world, FXCollision response, float restitution)
+	{
+		m_World = world;
+		m_Collision = world ? response : FXCollision::None;
+		m_Restitution = restitution;
+	}
+
+
+	uint16_t FXSystem::AddCurves(const FXCurve<glm::vec4>& color, const FXCurve<float>& size, const FXCurve<float>& speed)
+	{
+		EG_CORE_CHECK(m_Curves.size() <= UINT16_MAX, "FXSystem: too many curve sets");
+		FXCurveLut& lut = m_Curves.emplace_back();
+		for (uint32_t k = 0; k < FXCurveLut::LutSize; ++k) {
+			const float age = (float)k / (float)(FXCurveLut::LutSize - 1);
+			lut.Color[k] = color.Evaluate(age);
+			lut.Size[k] = size.Evaluate(age);
+			lut.Speed[k] = speed.Evaluate(age);
+			lut.MaxSize = std::max(lut.MaxSize, lut.Size[k]);
+			lut.ConstantSpeed = lut.ConstantSpeed && lut.Speed[k] == lut.Speed[0];
+		}
+		// A constant speed is applied once at spawn, so Update can skip the lookup
+		m_SpeedCurves = m_SpeedCurves || !lut.ConstantSpeed;
+		return (uint16_t)(m_Curves.size() - 1);
+	}
+
+
+	void FXSystem::Spawn(const FXSpec& s, uint16_t curves)
+	{
+		Emit(s, curves, s.sizeStart);
+	}
+
+
+	void FXSystem::Spawn(const FXSpec& s, uint16_t curves, uint32_t count)
+	{
+		m_SpawnRandom.resize((size_t)count * 4);
+		m_Rng.Fill01(m_SpawnRandom.data(), m_SpawnRandom.size());
+		for (uint32_t k = 0; k < count; ++k) Emit(s, curves, s.sizeStart, &m_SpawnRandom[(size_t)k * 4]);
+	}
+
+
+	static uint32_t PackRGBA8(const glm::vec4& c)
+	{
+		const glm::uvec4 q = glm::uvec4(glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f);
+		return q.r | q.g << 8 | q.b << 16 | q.a << 24;
+	}
+
+
+	static glm::vec4 UnpackRGBA8(uint32_t c)
+	{
+		return glm::vec4(c & 0xff, c >> 8 & 0xff, c >> 16 & 0xff, c >> 24) / 255.0f;
+	}
+
+
 	void FXSystem::Spawn(const FXSpec& s)
 	{
-		Node& n = m_Pool[m_Head];
-		n.live = true;
-		n.pos = s.pos;
-		n.vel = s.vel;
-		n.vel.x += s.velJitter.x * ((rand() / (float)RAND_MAX) - 0.5f);
-		n.vel.y += s.velJitter.y * ((rand() / (float)RAND_MAX) - 0.5f);
-		n.rot = ((rand() / (float)RAND_MAX) * 2.0f - 1.0f) * glm::pi<float>();
+		// Size curve relative to sizeStart so the jitter still scales it;
+		// with sizeStart = 0 the curve carries absolute sizes instead
+		const float base = s.sizeStart != 0.0f ? s.sizeStart : 1.0f;
+		const float sizeEnd = glm::clamp(s.sizeEnd / base * 256.0f, -(float)INT32_MAX, (float)INT32_MAX);
+		const LinearKey key{ (uint64_t)PackRGBA8(s.colorStart) | (uint64_t)PackRGBA8(s.colorEnd) << 32,
+			(int32_t)std::lround(sizeEnd), s.sizeStart == 0.0f };
+
+		auto it = m_LinearCurves.find(key);
+		if (it == m_LinearCurves.end() && m_LinearCurves.size() >= MaxLinearCurves) {
+			// Full: the closest baked spec stands in
+			if (!m_ReportedLinearCurves) EG_CORE_WARN("FXSystem: more than {} linear specs; reusing the closest", MaxLinearCurves);
+			m_ReportedLinearCurves = true;
+			auto distance = [&key](const LinearKey& k) {
+				if (k.Absolute != key.Absolute) return std::numeric_limits<float>::max();
+				const glm::vec4 d0 = UnpackRGBA8((uint32_t)k.Colors) - UnpackRGBA8((uint32_t)key.Colors);
+				const glm::vec4 d1 = UnpackRGBA8((uint32_t)(k.Colors >> 32)) - UnpackRGBA8((uint32_t)(key.Colors >> 32));
+				return glm::dot(d0, d0) + glm::dot(d1, d1) + std::abs((float)k.SizeEnd - (float)key.SizeEnd) / 256.0f;
+			};
+			it = std::min_element(m_LinearCurves.begin(), m_LinearCurves.end(),
+				[&](const auto& a, const auto& b) { return distance(a.first) < distance(b.first); });
+		}
+		if (it == m_LinearCurves.end()) {
+			// Baked from the quantized values, so every spec sharing the key looks the same
+			const glm::vec4 c0 = UnpackRGBA8((uint32_t)key.Colors), c1 = UnpackRGBA8((uint32_t)(key.Colors >> 32));
+			FXCurve<glm::vec4> color;
+			for (uint32_t k = 0; k < FXCurveLut::LutSize; ++k) {
+				const float age = (float)k / (float)(FXCurveLut::LutSize - 1);
+				glm::vec4 c = glm::mix(c0, c1, age); c.a *= 1.0f - age;
+				color.Add(age, c);
+			}
+			const float start = key.Absolute ? 0.0f : 1.0f;
+			const uint16_t index = AddCurves(color, FXCurve<float>(start, (float)key.SizeEnd / 256.0f));
+			it = m_LinearCurves.emplace(key, index).first;
+		}
+		Emit(s, it->second, base);
+	}
+
+
+	void FXSystem::Emit(const FXSpec& s, uint16_t curves, float size, const float* r)
+	{
+		if (m_Size == 0 || s.life <= 0.0f) return;
+		// Largest size it reaches, jitter left out
+		if (m_Budget && !m_Budget->Admit(m_Priority, m_BudgetCredit, s.pos, size * m_Curves[curves].MaxSize)) return;
+		size_t i = m_Live;
+		if (m_Live == m_Size) {
+			if (m_Overflow == FXOverflow::Drop) { m_Dropped++; return; }
+			i = m_Head;
+			m_Head = (m_Head + 1) % m_Size;
+		}
+		else {
+			m_Live++;
+			if (m_Budget) m_Budget->Added();
+		}
+
+		float drawn[4];
+		if (!r) {
+			m_Rng.Fill01(drawn, 4);
+			r = drawn;
+		}
+
+		FXStreams& p = m_Streams;
+		p.x[i] = s.pos.x;
+		p.y[i] = s.pos.y;
+		p.vx[i] = s.vel.x + s.velJitter.x * (r[0] - 0.5f);
+		p.vy[i] = s.vel.y + s.velJitter.y * (r[1] - 0.5f);
+		p.rot[i] = (r[2] * 2.0f - 1.0f) * glm::pi<float>();
 
 
-		n.c0 = s.colorStart;
-		n.c1 = s.colorEnd;
+		p.size[i] = size + s.sizeJitter * (r[3] - 0.5f);
+		p.speed[i] = m_Curves[curves].Speed[0];
+		p.curves[i] = curves;
 
 
-		n.s0 = s.sizeStart + s.sizeJitter * ((rand() / (float)RAND_MAX) - 0.5f);
-		n.s1 = s.sizeEnd;
+		p.life[i] = s.life;
+		p.left[i] = s.life;
+	}
 
 
-		n.life = s.life;
-		n.left = s.life;
+	void FXSystem::Kill(size_t i)
+	{
+		FXStreams& p = m_Streams;
+		const size_t last = --m_Live;
+		if (i != last) {
+			p.x[i] = p.x[last]; p.y[i] = p.y[last];
+			p.vx[i] = p.vx[last]; p.vy[i] = p.vy[last];
+			p.rot[i] = p.rot[last];
+			p.left[i] = p.left[last]; p.life[i] = p.life[last];
+			p.size[i] = p.size[last]; p.speed[i] = p.speed[last];
+			p.curves[i] = p.curves[last];
+		}
+		p.left[last] = 0.0f; // keeps the SIMD tail masked
+	}
 
 
-		m_Head = (m_Head + 1) % m_Pool.size();
+	void FXSystem::IntegrateChunk(size_t chunk, float dt)
+	{
+		const size_t begin = chunk * ChunkSize;
+		const size_t end = std::min(begin + ChunkSize, (m_Live + Lanes - 1) / Lanes * Lanes);
+		if (m_SpeedCurves) {
+			FXStreams& p = m_Streams;
+			for (size_t i = begin, live = std::min(end, m_Live); i < live; ++i)
+				p.speed[i] = m_Curves[p.curves[i]].Speed[FXCurveLut::Index(p.left[i], p.life[i])];
+		}
+		Integrate(m_Streams, begin, end, dt);
+		if (m_Collision != FXCollision::None) Collide(begin, std::min(end, m_Live));
+	}
+
+
+	void FXSystem::Collide(size_t begin, size_t end)
+	{
+		FXStreams& p = m_Streams;
+		uint64_t hits = 0;
+		Contact c;
+		for (size_t i = begin; i < end; ++i) {
+			if (p.left[i] <= 0.0f || !m_World->Query({ p.x[i], p.y[i] }, c)) continue;
+			++hits;
+			if (m_Collision == FXCollision::Kill) { p.left[i] = 0.0f; continue; }
+
+			// Just outside the edge, so the next step does not hit it again
+			const float push = c.Depth + 1e-4f;
+			p.x[i] += c.Normal.x * push;
+			p.y[i] += c.Normal.y * push;
+			if (m_Collision == FXCollision::Stick) { p.vx[i] = 0.0f; p.vy[i] = 0.0f; continue; }
+
+			const float vn = p.vx[i] * c.Normal.x + p.vy[i] * c.Normal.y;
+			if (vn >= 0.0f) continue; // already leaving
+			p.vx[i] -= (1.0f + m_Restitution) * vn * c.Normal.x;
+			p.vy[i] -= (1.0f + m_Restitution) * vn * c.Normal.y;
+		}
+		if (hits) m_Collisions.fetch_add(hits, std::memory_order_relaxed);
 	}
 
 
 	void FXSystem::Update(Timestep dt)
 	{
+		Update(dt, ThreadPool::Global());
+	}
+
+
+	void FXSystem::Update(Timestep dt, ThreadPool& pool)
+	{
+		EG_PROFILE_FUNCTION();
 		const float d = dt.GetSeconds();
-		for (auto& it : m_Pool) {
-			if (!it.live) continue;
-			it.left -= d;
-			if (it.left <= 0.0f) { it.live = false; continue; }
-			it.pos += it.vel * d;
-			it.rot += 0.01f * d;
+		pool.ParallelFor((uint32_t)ChunkCount(), [this, d](uint32_t chunk) { IntegrateChunk(chunk, d); });
+		Compact();
+	}
+
+
+	void FXSystem::UpdateAll(const std::vector<FXSystem*>& systems, Timestep dt)
+	{
+		UpdateAll(systems, dt, ThreadPool::Global());
+	}
+
+
+	void FXSystem::UpdateAll(const std::vector<FXSystem*>& systems, Timestep dt, ThreadPool& pool)
+	{
+		EG_PROFILE_FUNCTION();
+		struct Job { FXSystem* System; uint32_t Chunk; };
+		static thread_local std::vector<Job> s_Jobs;
+		std::vector<Job>& jobs = s_Jobs; // the workers must see this thread's list
+		jobs.clear();
+		for (FXSystem* fx : systems)
+			for (size_t c = 0, n = fx->ChunkCount(); c < n; ++c) jobs.push_back({ fx, (uint32_t)c });
+
+		const float d = dt.GetSeconds();
+		pool.ParallelFor((uint32_t)jobs.size(), [&jobs, d](uint32_t i) { jobs[i].System->IntegrateChunk(jobs[i].Chunk, d); });
+		// Systems are independent; each one compacts serially
+		pool.ParallelFor((uint32_t)systems.size(), [&systems](uint32_t i) { systems[i]->Compact(); });
+	}
+
+
+	void FXSystem::Compact()
+	{
+		// The moved-in particle is checked again at the same index
+		const float* left = m_Streams.left.data();
+		for (size_t i = 0; i < m_Live;) {
+			if (left[i] > 0.0f) { ++i; continue; }
+			Kill(i);
 		}
+		if (m_Head >= m_Live) m_Head = 0;
 	}
 
 
 	void FXSystem::Render() const
 	{
-		for (const auto& it : m_Pool) {
-			if (!it.live) continue;
-			float t = it.left / it.life;
-			glm::vec4 col = glm::mix(it.c1, it.c0, t); col.a *= t;
-			float sz = glm::mix(it.s1, it.s0, t);
-			Renderer2D::DrawRotatedQuad(it.pos, { sz, sz }, it.rot, col);
+		EG_PROFILE_FUNCTION();
+		const FXStreams& p = m_Streams;
+		const float minSize = m_Budget ? m_Budget->MinWorldSize() : 0.0f;
+		uint32_t skipped = 0;
+
+		// Straight into the batch (or the recorded list): one pass looks up the curves
+		// and writes the corners, and the whole system lands in one draw (per 10k quads)
+		static const glm::vec2 kCorner[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+		static const glm::vec2 kUV[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+		for (size_t i = 0; i < m_Live;) {
+			const Renderer2D::QuadSpan span = Renderer2D::MapQuads((uint32_t)std::min<size_t>(m_Live - i, UINT32_MAX));
+			glm::vec3* pos = span.Positions;
+			Renderer2D::QuadAttribVertex* attr = span.Attribs;
+			uint32_t written = 0;
+			for (uint32_t q = 0; q < span.Count; ++q, ++i) {
+				const FXCurveLut& lut = m_Curves[p.curves[i]];
+				const uint32_t age = FXCurveLut::Index(p.left[i], p.life[i]);
+				const glm::vec4& col = lut.Color[age];
+				const float sz = p.size[i] * lut.Size[age];
+				if (sz < minSize) { ++skipped; continue; }
+				const float c = std::cos(p.rot[i]), s = std::sin(p.rot[i]);
+				for (int k = 0; k < 4; ++k) {
+					const glm::vec2 o = kCorner[k] * sz;
+					pos[k] = { p.x[i] + o.x * c - o.y * s, p.y[i] + o.x * s + o.y * c, 0.0f };
+					attr[k] = { col, kUV[k], 0.0f, 1.0f };
+				}
+				pos += 4; attr += 4; ++written;
+			}
+			Renderer2D::CommitQuads(written);
 		}
+		if (m_Budget) m_Budget->CountSubPixelDrawn(skipped);
 	}
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -1,11 +1,21 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <glm/glm.hpp>
 #include "Engine/Core/Timestep.h"
+#include "Engine/Core/Random.h"
 #include "Renderer2D.h"
+#include "FXBudget.h"
 
 namespace Engine
 {
+	class ThreadPool;
+	class SpatialHash;
+
+
 	struct FXSpec {
 		glm::vec2 pos{ 0 };
 		glm::vec2 vel{ 0 };
@@ -25,31 +35,194 @@ namespace Engine
 	};
 
 
+	// Piecewise-linear function of normalized age (0 = spawn, 1 = death)
+	// through keys sorted by time; constant before the first key and after
+	// the last. Only used when baking, never per particle.
+	template<typename T>
+	struct FXCurve {
+		std::vector<std::pair<float, T>> Keys;
+
+		FXCurve() = default;
+		FXCurve(const T& constant) : Keys{ { 0.0f, constant } } {}
+		FXCurve(const T& start, const T& end) : Keys{ { 0.0f, start }, { 1.0f, end } } {}
+
+		FXCurve& Add(float age, const T& value) { Keys.emplace_back(age, value); return *this; }
+
+		T Evaluate(float age) const {
+			if (Keys.empty()) return T(1.0f);
+			if (age <= Keys.front().first) return Keys.front().second;
+			for (size_t i = 1; i < Keys.size(); ++i) {
+				if (age > Keys[i].first) continue;
+				const auto& [t0, v0] = Keys[i - 1];
+				const auto& [t1, v1] = Keys[i];
+				return t1 > t0 ? glm::mix(v0, v1, (age - t0) / (t1 - t0)) : v1;
+			}
+			return Keys.back().second;
+		}
+	};
+
+
+	// Over-lifetime curves sampled at LutSize ages; a particle reads entry
+	// round(age * (LutSize - 1)).
+	struct FXCurveLut {
+		static constexpr uint32_t LutSize = 64;
+		static uint32_t Index(float left, float life) {
+			const float u = 1.0f - left / life;
+			return std::min((uint32_t)(u * (LutSize - 1) + 0.5f), LutSize - 1);
+		}
+
+		glm::vec4 Color[LutSize];
+		float     Size[LutSize];  // times the particle's spawn size
+		float     Speed[LutSize]; // times its spawn velocity
+		float     MaxSize = 0.0f;
+		bool      ConstantSpeed = true;
+	};
+
+
+	// Particle pool as one stream per attribute. Live particles are packed
+	// at the front, [0, live count); everything after holds left = 0, so the
+	// update can round the live range up to whole SIMD registers.
+	struct FXStreams {
+		std::vector<float> x, y, vx, vy, rot;
+		std::vector<float> left, life;
+		std::vector<float> size;      // at spawn, jitter included
+		std::vector<float> speed;     // velocity scale from the speed curve, refreshed by Update
+		std::vector<uint16_t> curves; // index of the system's FXCurveLut
+	};
+
+
+	// What Spawn does when every slot is live.
+	enum class FXOverflow {
+		Drop,      // the new particle is discarded
+		Overwrite, // replaces live particles in round-robin order
+	};
+
+
+	// What happens to a particle that ends a step inside a collision shape.
+	enum class FXCollision {
+		None,
+		Bounce, // pushed out to the nearest edge, velocity reflected and scaled by the restitution
+		Kill,
+		Stick,  // pushed out to the nearest edge and stopped
+	};
+
+
 	class FXSystem {
 	public:
+		// Update processes this many particles per step (SSE2; the scalar fallback needs no padding)
+		static constexpr size_t Lanes = 4;
+		// Unit of parallel work: Update integrates chunks of this many particles as separate jobs
+		static constexpr size_t ChunkSize = 8192;
+
+		// Each system gets its own RNG stream, numbered in construction order
 		FXSystem();
+		~FXSystem();
+		FXSystem(const FXSystem&) = delete;
+		FXSystem& operator=(const FXSystem&) = delete;
 		void ResizePool(size_t n);
 
-
+		// Jitter and rotation of spawned particles; fix it for reproducible runs.
+		void Seed(uint64_t seed, uint64_t stream = 0) { m_Rng.Seed(seed, stream); }
+
+
+		// Bakes the curves once; spawns refer to the returned index.
+		uint16_t AddCurves(const FXCurve<glm::vec4>& color, const FXCurve<float>& size,
+			const FXCurve<float>& speed = FXCurve<float>(1.0f));
+		const FXCurveLut& GetCurves(uint16_t index) const { return m_Curves[index]; }
+
+		// Color comes from the curves; s.colorStart/colorEnd are not used.
+		// Size is s.sizeStart (plus jitter) times the size curve.
+		void Spawn(const FXSpec& s, uint16_t curves);
+		// `count` of the above. Their random values are drawn in one
+		// Random::Fill01 call up front, so whole blocks vectorize.
+		void Spawn(const FXSpec& s, uint16_t curves, uint32_t count);
+		// Linear start->end color and size with alpha fading out, baked on
+		// first use of each distinct spec. Specs are told apart at 8 bits per
+		// color channel (clamped to 0..1) and 1/256 of the size ratio; once
+		// MaxLinearCurves have been baked, a new one reuses the closest.
 		void Spawn(const FXSpec& s);
-		void Update(Timestep dt);
+		static constexpr size_t MaxLinearCurves = 256;
+		size_t GetCurveCount() const { return m_Curves.size(); }
+
+		// Both cost O(live particles), not O(pool size)
+		void Update(Timestep dt); // on ThreadPool::Global()
 		void Render() const;
 
+		// Chunks are integrated in parallel, then dead particles are removed
+		// serially in index order, so the resulting order (and Render) is the
+		// same for any thread count. Not from inside a job on the same pool.
+		void Update(Timestep dt, ThreadPool& pool);
 
-	private:
-		struct Node {
-			bool live = false;
-			glm::vec2 pos{ 0 }, vel{ 0 };
-			float rot = 0.0f;
+		// Every chunk of every system is one job on the pool.
+		static void UpdateAll(const std::vector<FXSystem*>& systems, Timestep dt);
+		static void UpdateAll(const std::vector<FXSystem*>& systems, Timestep dt, ThreadPool& pool);
 
 
-			glm::vec4 c0{ 1 }, c1{ 0 };
-			float s0 = 1.0f, s1 = 0.0f;
-			float life = 1.0f, left = 0.0f;
-		};
+		// Spawns go through the budget's checks and Render skips particles it
+		// calls sub-pixel; nullptr (the default) means unlimited.
+		void SetBudget(FXBudget* budget, FXPriority priority = FXPriority::Normal);
+		FXBudget* GetBudget() const { return m_Budget; }
+		FXPriority GetPriority() const { return m_Priority; }
+
+
+		// Particles are tested against `world` after every step, each against
+		// the shapes of the one grid bucket it is in. The world must be
+		// Updated before this system's Update and outlive the setting.
+		void SetCollision(const SpatialHash* world, FXCollision response, float restitution = 0.5f);
+		FXCollision GetCollision() const { return m_Collision; }
+		uint64_t GetCollisionCount() const { return m_Collisions.load(std::memory_order_relaxed); } // since creation
 
 
-		std::vector<Node> m_Pool;
-		size_t m_Head = 0; // ring buffer
+		void SetOverflow(FXOverflow policy) { m_Overflow = policy; }
+		FXOverflow GetOverflow() const { return m_Overflow; }
+
+
+		size_t GetPoolSize() const { return m_Size; }
+		size_t GetLiveCount() const { return m_Live; }
+		uint64_t GetDroppedCount() const { return m_Dropped; } // spawns lost to a full pool
+		const FXStreams& GetStreams() const { return m_Streams; }
+
+
+	private:
+		size_t ChunkCount() const { return (m_Live + ChunkSize - 1) / ChunkSize; }
+		void IntegrateChunk(size_t chunk, float dt);
+		void Compact();
+		void Collide(size_t begin, size_t end);
+		void Kill(size_t i); // swap-and-pop
+		// r: 4 values in [0, 1) for the jitter, or nullptr to draw them here
+		void Emit(const FXSpec& s, uint16_t curves, float size, const float* r = nullptr);
+
+		FXStreams m_Streams; // padded to a multiple of Lanes
+		Random m_Rng;
+		std::vector<float> m_SpawnRandom; // Spawn(count) scratch, 4 per particle
+		std::vector<FXCurveLut> m_Curves;
+		bool m_SpeedCurves = false; // any LUT with a non-constant speed
+		struct LinearKey {
+			uint64_t Colors;  // start and end, RGBA8 each
+			int32_t  SizeEnd; // end over start size (absolute when the start is 0), in 1/256
+			bool     Absolute;
+			bool operator==(const LinearKey& o) const { return Colors == o.Colors && SizeEnd == o.SizeEnd && Absolute == o.Absolute; }
+		};
+		struct LinearKeyHash {
+			size_t operator()(const LinearKey& k) const {
+				return std::hash<uint64_t>()(k.Colors ^ (((uint64_t)(uint32_t)k.SizeEnd << 1 | k.Absolute) * 0x9e3779b97f4a7c15ull));
+			}
+		};
+		std::unordered_map<LinearKey, uint16_t, LinearKeyHash> m_LinearCurves; // what Spawn(FXSpec) has baked
+		bool m_ReportedLinearCurves = false;
+		size_t m_Size = 0;
+		size_t m_Live = 0;
+		size_t m_Head = 0; // next slot to overwrite when full
+		FXOverflow m_Overflow = FXOverflow::Drop;
+		uint64_t m_Dropped = 0;
+		FXBudget* m_Budget = nullptr;
+		FXPriority m_Priority = FXPriority::Normal;
+		float m_BudgetCredit = 0.0f;
+		const SpatialHash* m_World = nullptr;
+		FXCollision m_Collision = FXCollision::None;
+		float m_Restitution = 0.5f;
+		std::atomic<uint64_t> m_Collisions{ 0 };
+
+		friend class FXBudget;
 	};
-}
\ No newline at end of file
+}
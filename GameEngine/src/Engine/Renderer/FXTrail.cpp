@@ -0,0 +1,87 @@
+#include "enginepch.h"
+#include "FXTrail.h"
+
+namespace Engine {
+	FXTrail::FXTrail(const FXTrailDesc& desc)
+		: m_Desc(desc), m_Points(std::max<uint32_t>(desc.MaxPoints, 2))
+	{
+		for (uint32_t k = 0; k < FXCurveLut::LutSize; ++k) {
+			const float age = (float)k / (float)(FXCurveLut::LutSize - 1);
+			m_Width[k] = desc.Width.Evaluate(age);
+			m_Color[k] = desc.Color.Evaluate(age);
+		}
+	}
+
+
+	void FXTrail::Clear()
+	{
+		m_First = 0;
+		m_Count = 0;
+	}
+
+
+	void FXTrail::Push(const glm::vec2& pos)
+	{
+		if (m_Count == m_Points.size()) { m_First = (m_First + 1) % m_Points.size(); --m_Count; }
+		At(m_Count++) = { pos, m_Time };
+	}
+
+
+	void FXTrail::Update(Timestep dt, const glm::vec2& head)
+	{
+		m_Time += dt.GetSeconds();
+		while (m_Count > 1 && m_Time - At(0).Time > m_Desc.Lifetime) { m_First = (m_First + 1) % m_Points.size(); --m_Count; }
+
+		// The last point follows the head until it is MinDistance past the
+		// one before, then stays and a new head point starts
+		if (m_Count < 2) { Clear(); Push(head); Push(head); return; }
+		Point& last = At(m_Count - 1);
+		last = { head, m_Time };
+		if (glm::distance(At(m_Count - 2).Pos, head) >= m_Desc.MinDistance) Push(head);
+	}
+
+
+	void FXTrail::Render() const
+	{
+		EG_PROFILE_FUNCTION();
+		if (m_Count < 2) return;
+		const uint32_t segments = (uint32_t)m_Count - 1;
+
+		// Per point: half-width offset across the trail and color. The
+		// direction at a point is the average of its two segments, so
+		// neighbouring quads meet on the same edge.
+		auto edge = [this](size_t i, glm::vec2& side, glm::vec4& color) {
+			const glm::vec2 d = At(std::min(i + 1, m_Count - 1)).Pos - At(i > 0 ? i - 1 : 0).Pos;
+			const float len = glm::length(d);
+			const glm::vec2 n = len > 0.0f ? glm::vec2(-d.y, d.x) / len : glm::vec2(0.0f, 1.0f);
+			const Point& p = At(i);
+			const float age = std::min((m_Time - p.Time) / std::max(m_Desc.Lifetime, 1e-6f), 1.0f);
+			const uint32_t k = (uint32_t)(age * (FXCurveLut::LutSize - 1) + 0.5f);
+			side = n * (0.5f * m_Width[k]);
+			color = m_Color[k];
+		};
+
+		static const glm::vec2 kUV[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+		glm::vec2 sideA, sideB; glm::vec4 colorA, colorB;
+		edge(0, sideA, colorA);
+		for (uint32_t s = 0; s < segments;) {
+			const Renderer2D::QuadSpan span = Renderer2D::MapQuads(segments - s);
+			for (uint32_t q = 0; q < span.Count; ++q, ++s) {
+				edge(s + 1, sideB, colorB);
+				const glm::vec2 a = At(s).Pos, b = At(s + 1).Pos;
+				glm::vec3* pos = span.Positions + q * 4;
+				Renderer2D::QuadAttribVertex* attr = span.Attribs + q * 4;
+				pos[0] = { a - sideA, m_Desc.Depth };
+				pos[1] = { b - sideB, m_Desc.Depth };
+				pos[2] = { b + sideB, m_Desc.Depth };
+				pos[3] = { a + sideA, m_Desc.Depth };
+				attr[0] = { colorA, kUV[0], 0.0f, 1.0f };
+				attr[1] = { colorB, kUV[1], 0.0f, 1.0f };
+				attr[2] = { colorB, kUV[2], 0.0f, 1.0f };
+				attr[3] = { colorA, kUV[3], 0.0f, 1.0f };
+				sideA = sideB; colorA = colorB;
+			}
+			Renderer2D::CommitQuads(span.Count);
+		}
+	}
+} // namespace Engine
@@ -0,0 +1,56 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Core/Timestep.h"
+#include "FXSystem.h"
+
+namespace Engine
+{
+	struct FXTrailDesc {
+		// Over a point's age: 0 = the head, 1 = Lifetime seconds old
+		FXCurve<float> Width{ 0.3f, 0.0f };
+		FXCurve<glm::vec4> Color{ glm::vec4(1.0f), glm::vec4(1.0f, 1.0f, 1.0f, 0.0f) };
+
+		float Lifetime = 2.0f;    // points older than this are dropped
+		float MinDistance = 0.2f; // the head is fixed as a point after moving this far
+		uint32_t MaxPoints = 128; // oldest points go first when full
+		float Depth = 0.0f;       // z of the ribbon
+	};
+
+
+	// Ribbon through the recent positions of something moving: a ring of
+	// sampled points drawn as one strip, each segment a quad sharing its
+	// edge vertices with the next, so the whole trail is one batch. Width
+	// and color are baked into lookup tables like particle curves.
+	class FXTrail {
+	public:
+		explicit FXTrail(const FXTrailDesc& desc = {});
+
+		// Ages the points and moves the head to `head`
+		void Update(Timestep dt, const glm::vec2& head);
+		void Clear();
+
+		// One quad per segment, written into the open Renderer2D batch
+		// (or the recording CommandList).
+		void Render() const;
+
+		size_t GetPointCount() const { return m_Count; }
+		glm::vec2 GetPoint(size_t i) const { return At(i).Pos; } // 0 = oldest
+
+	private:
+		struct Point {
+			glm::vec2 Pos;
+			float Time; // when it was fixed
+		};
+		const Point& At(size_t i) const { return m_Points[(m_First + i) % m_Points.size()]; }
+		Point& At(size_t i) { return m_Points[(m_First + i) % m_Points.size()]; }
+		void Push(const glm::vec2& pos);
+
+		FXTrailDesc m_Desc;
+		std::vector<Point> m_Points; // ring of MaxPoints
+		size_t m_First = 0, m_Count = 0;
+		float m_Time = 0.0f;
+		float m_Width[FXCurveLut::LutSize];
+		glm::vec4 m_Color[FXCurveLut::LutSize];
+	};
+}
@@ -0,0 +1,150 @@
+#include "enginepch.h"
+#include "FrameCapture.h"
+#include "ImageWriter.h"
+#include <filesystem>
+
+namespace Engine {
+
+    FrameCapture::FrameCapture(uint32_t readbackSlots, uint32_t maxQueued)
+        : m_Slots(std::max(readbackSlots, 1u)), m_MaxQueued(std::max(maxQueued, 1u)) {
+        m_Encoder = std::thread([this] { EncoderMain(); });
+    }
+
+    FrameCapture::~FrameCapture() {
+        if (m_Readback) Flush();
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Quit = true;
+        }
+        m_QueueCV.notify_one();
+        m_Encoder.join();
+    }
+
+    void FrameCapture::CaptureNextFrame(const std::string& path) {
+        std::lock_guard<std::mutex> lock(m_RequestMutex);
+        m_Shots.push_back(path);
+    }
+
+    void FrameCapture::StartSequence(const std::string& directory, const std::string& extension) {
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+        std::lock_guard<std::mutex> lock(m_RequestMutex);
+        m_SequenceDir = directory;
+        m_SequenceExt = extension;
+        m_SequenceIndex = 0;
+        m_Sequence = true;
+    }
+
+    void FrameCapture::StopSequence() {
+        std::lock_guard<std::mutex> lock(m_RequestMutex);
+        m_Sequence = false;
+    }
+
+    bool FrameCapture::IsRecordingSequence() const {
+        std::lock_guard<std::mutex> lock(m_RequestMutex);
+        return m_Sequence;
+    }
+
+    void FrameCapture::OnFrameEnd(uint32_t width, uint32_t height) {
+        EG_PROFILE_FUNCTION();
+        const uint64_t frame = m_Frame++;
+        if (m_Readback) Collect(false);
+
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(m_RequestMutex);
+            if (!m_Shots.empty()) {
+                path = std::move(m_Shots.front());
+                m_Shots.pop_front();
+            }
+            else if (m_Sequence) {
+                char name[32];
+                std::snprintf(name, sizeof(name), "frame_%06llu", (unsigned long long)m_SequenceIndex++);
+                path = (std::filesystem::path(m_SequenceDir) / (name + m_SequenceExt)).string();
+            }
+        }
+        if (path.empty()) return;
+
+        if (!m_Readback) m_Readback = FrameReadback::Create(m_Slots);
+        if (m_Readback->Request(width, height, frame)) {
+            m_InFlight.push_back(std::move(path));
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Stats.Requested++;
+        }
+        else {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Stats.Dropped++;
+        }
+    }
+
+    void FrameCapture::Collect(bool wait) {
+        while (!m_InFlight.empty()) {
+            Job job;
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                if (!m_Spare.empty()) {
+                    job.Image = std::move(m_Spare.back());
+                    m_Spare.pop_back();
+                }
+            }
+            if (!m_Readback->Poll(job.Image, wait)) {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                m_Spare.push_back(std::move(job.Image));
+                return;
+            }
+            job.Path = std::move(m_InFlight.front());
+            m_InFlight.pop_front();
+            m_LatencySum += m_Frame - job.Image.Tag;
+            m_Delivered++;
+
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                m_Stats.LatencyFrames = (double)m_LatencySum / (double)m_Delivered;
+                if (m_Queue.size() >= m_MaxQueued) {
+                    m_Stats.Dropped++;
+                    m_Spare.push_back(std::move(job.Image));
+                    continue;
+                }
+                m_Queue.push_back(std::move(job));
+            }
+            m_QueueCV.notify_one();
+        }
+    }
+
+    void FrameCapture::Flush() {
+        EG_PROFILE_FUNCTION();
+        if (m_Readback) Collect(true);
+        std::unique_lock<std::mutex> lock(m_QueueMutex);
+        m_IdleCV.wait(lock, [this] { return m_Queue.empty() && !m_Encoding; });
+    }
+
+    FrameCapture::Statistics FrameCapture::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        return m_Stats;
+    }
+
+    void FrameCapture::EncoderMain() {
+        EG_PROFILE_THREAD("FrameCapture");
+        std::unique_lock<std::mutex> lock(m_QueueMutex);
+        for (;;) {
+            m_QueueCV.wait(lock, [this] { return !m_Queue.empty() || m_Quit; });
+            if (m_Queue.empty()) break; // quitting and drained
+
+            Job job = std::move(m_Queue.front());
+            m_Queue.pop_front();
+            m_Encoding = true;
+            lock.unlock();
+
+            const ReadbackImage& img = job.Image;
+            const bool ok = ImageWriter::Write(job.Path, img.Width, img.Height, img.Pixels.data(), true);
+
+            lock.lock();
+            m_Encoding = false;
+            if (ok) m_Stats.Written++;
+            else m_Stats.Failed++;
+            m_Spare.push_back(std::move(job.Image));
+            if (m_Queue.empty()) m_IdleCV.notify_all();
+        }
+    }
+
+} // namespace Engine
@@ -0,0 +1,87 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "FrameReadback.h"
+
+namespace Engine {
+
+    // Screenshots and image sequences without stalling the frame. The
+    // backbuffer is copied through a FrameReadback ring and reaches the CPU
+    // a few frames later; encoding (PNG, QOI or TGA, by extension) and file
+    // writes happen on a background thread.
+    //
+    // Capture requests come from the main thread; OnFrameEnd runs where the
+    // frame is drawn (the render thread when one is used).
+    class FrameCapture {
+    public:
+        // readbackSlots: copies in flight; maxQueued: images waiting for the
+        // encoder. When either is full, frames are dropped instead of waited on.
+        explicit FrameCapture(uint32_t readbackSlots = 3, uint32_t maxQueued = 8);
+        ~FrameCapture(); // flushes outstanding work
+
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        // One image of the next frame.
+        void CaptureNextFrame(const std::string& path);
+
+        // Every frame until StopSequence, as directory/frame_000000<extension>.
+        void StartSequence(const std::string& directory, const std::string& extension = ".qoi");
+        void StopSequence();
+        bool IsRecordingSequence() const;
+
+        // After the frame is drawn, before the swap: collects finished
+        // readbacks and starts the one for this frame if it is wanted.
+        void OnFrameEnd(uint32_t width, uint32_t height);
+
+        // Waits for every requested frame to be written. Same thread as OnFrameEnd.
+        void Flush();
+
+        struct Statistics {
+            uint64_t Requested = 0;     // readbacks started
+            uint64_t Written = 0;       // files written
+            uint64_t Dropped = 0;       // ring or encoder queue full
+            uint64_t Failed = 0;        // could not write the file
+            double   LatencyFrames = 0; // average, request to delivery
+        };
+        Statistics GetStats() const;
+
+    private:
+        struct Job {
+            std::string   Path;
+            ReadbackImage Image;
+        };
+
+        void Collect(bool wait);
+        void EncoderMain();
+
+        uint32_t m_Slots, m_MaxQueued;
+        Shared<FrameReadback> m_Readback; // created on first use, on the drawing thread
+
+        // Render thread
+        std::deque<std::string> m_InFlight; // paths, in readback order
+        uint64_t m_Frame = 0;
+        uint64_t m_LatencySum = 0, m_Delivered = 0;
+
+        // Requests (main thread)
+        mutable std::mutex      m_RequestMutex;
+        std::deque<std::string> m_Shots;
+        std::string m_SequenceDir, m_SequenceExt;
+        bool        m_Sequence = false;
+        uint64_t    m_SequenceIndex = 0;
+
+        // Encoder thread
+        std::thread             m_Encoder;
+        mutable std::mutex      m_QueueMutex;
+        std::condition_variable m_QueueCV, m_IdleCV;
+        std::deque<Job>         m_Queue;
+        std::vector<ReadbackImage> m_Spare; // pixel storage to reuse
+        bool m_Encoding = false, m_Quit = false;
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
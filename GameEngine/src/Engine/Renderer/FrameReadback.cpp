@@ -0,0 +1,14 @@
+#include "enginepch.h"
+#include "FrameReadback.h"
+#include "RendererBackend.h"
+
+namespace Engine {
+
+    Shared<FrameReadback> FrameReadback::Create(uint32_t slots) {
+        EG_PROFILE_FUNCTION();
+        auto fn = Detail::GetCreators().readback;
+        EG_CORE_CHECK(fn, "Readback creator not bound!");
+        return fn(std::max(slots, 1u));
+    }
+
+}
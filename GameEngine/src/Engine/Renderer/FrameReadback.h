@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Engine/Core/Core.h"
+
+namespace Engine {
+
+    // Color reads RGBA8; Stencil reads the 8-bit stencil (overdraw counts).
+    enum class ReadbackSource : uint8_t { Color, Stencil };
+
+    // Pixels copied back from a render target, rows bottom-up.
+    struct ReadbackImage {
+        uint32_t Width = 0, Height = 0;
+        uint64_t Tag = 0; // caller's frame number
+        ReadbackSource Source = ReadbackSource::Color;
+        std::vector<uint8_t> Pixels;
+
+        uint32_t BytesPerPixel() const { return Source == ReadbackSource::Color ? 4u : 1u; }
+    };
+
+    // Ring of in-flight copies of the bound render target. Request starts a
+    // copy without waiting for the GPU; Poll hands back the oldest one once
+    // it has landed, typically a couple of frames later. Render thread only.
+    class FrameReadback {
+    public:
+        virtual ~FrameReadback() = default;
+
+        // Copies (0, 0, width, height) of the bound target. False when every
+        // slot is still in flight: the caller skips the frame rather than stall.
+        virtual bool Request(uint32_t width, uint32_t height, uint64_t tag,
+            ReadbackSource source = ReadbackSource::Color) = 0;
+
+        // Oldest finished copy. With wait, blocks for it (shutdown, tests).
+        // `out.Pixels` is reused, so passing the same image avoids allocations.
+        virtual bool Poll(ReadbackImage& out, bool wait = false) = 0;
+
+        virtual uint32_t InFlight() const = 0;
+
+        static Shared<FrameReadback> Create(uint32_t slots = 3);
+    };
+
+} // namespace Engine
@@ -0,0 +1,14 @@
+#include "enginepch.h"
+#include "Framebuffer.h"
+#include "RendererBackend.h"
+
+namespace Engine {
+
+    Shared<Framebuffer> Framebuffer::Create(const FramebufferSpec& spec) {
+        EG_PROFILE_FUNCTION();
+        auto fn = Detail::GetCreators().framebuffer;
+        EG_CORE_CHECK(fn, "Framebuffer creator not bound!");
+        return fn(spec);
+    }
+
+}
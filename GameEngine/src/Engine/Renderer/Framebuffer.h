@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include "Engine/Core/Core.h"
+#include "Texture.h"
+
+namespace Engine {
+
+    struct FramebufferSpec {
+        uint32_t Width = 0, Height = 0;
+        bool     Depth = true; // depth attachment (always present on the software backend)
+    };
+
+    // Offscreen render target with an RGBA8 color attachment that can be
+    // sampled like any Texture2D. Rows are bottom-up, so a quad with the
+    // usual 0..1 UVs shows the image upright.
+    class Framebuffer {
+    public:
+        virtual ~Framebuffer() = default;
+
+        // Redirects drawing into this target and sets the viewport to its
+        // size. Flush any pending Renderer2D batch first.
+        virtual void Bind() = 0;
+        // Back to the target and viewport active at Bind, so binds nest.
+        virtual void Unbind() = 0;
+
+        // Reallocates the attachments; their content is undefined afterwards.
+        virtual void Resize(uint32_t width, uint32_t height) = 0;
+
+        virtual const FramebufferSpec& GetSpec() const = 0;
+        virtual const Shared<Texture2D>& GetColorAttachment() const = 0;
+
+        static Shared<Framebuffer> Create(const FramebufferSpec& spec);
+    };
+
+} // namespace Engine
@@ -8,6 +8,10 @@ namespace Engine {
         virtual ~GraphicsContext() = default;
         virtual void Init() = 0;
         virtual void SwapBuffers() = 0;
+
+        // Binds/unbinds the context to the calling thread (render-thread mode).
+        virtual void MakeCurrent() = 0;
+        virtual void ReleaseCurrent() = 0;
     };
 
 } // namespace Engine
@@ -0,0 +1,199 @@
+#include "enginepch.h"
+#include "ImageWriter.h"
+#include <array>
+#include <filesystem>
+#include <fstream>
+
+namespace Engine {
+
+    static bool WriteFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) {
+            EG_CORE_ERROR("Could not open '{}' for writing", path);
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+        return (bool)out;
+    }
+
+    static void PutBE32(std::vector<uint8_t>& out, uint32_t v) {
+        out.push_back((uint8_t)(v >> 24));
+        out.push_back((uint8_t)(v >> 16));
+        out.push_back((uint8_t)(v >> 8));
+        out.push_back((uint8_t)v);
+    }
+
+    // Row `y` counted from the top of the image
+    static const uint8_t* TopDownRow(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t y, bool bottomUp) {
+        return rgba + (size_t)(bottomUp ? height - 1 - y : y) * width * 4;
+    }
+
+    static uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+        static const std::array<uint32_t, 256> table = [] {
+            std::array<uint32_t, 256> t{};
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+                t[n] = c;
+            }
+            return t;
+        }();
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i) crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    bool ImageWriter::WriteTGA(const std::string& path, uint32_t width, uint32_t height,
+        const uint8_t* rgba, bool bottomUp) {
+        EG_PROFILE_FUNCTION();
+        std::ofstream out(path, std::ios::binary);
+        if (!out) {
+            EG_CORE_ERROR("Could not open '{}' for writing", path);
+            return false;
+        }
+
+        // Uncompressed true-color, 32 bpp, 8 alpha bits
+        uint8_t header[18] = {};
+        header[2] = 2;
+        header[12] = (uint8_t)(width & 0xff);
+        header[13] = (uint8_t)(width >> 8);
+        header[14] = (uint8_t)(height & 0xff);
+        header[15] = (uint8_t)(height >> 8);
+        header[16] = 32;
+        // TGA rows are bottom-up by default; bit 5 marks top-down storage
+        header[17] = 8 | (bottomUp ? 0 : 0x20);
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        std::vector<uint8_t> row((size_t)width * 4);
+        for (uint32_t y = 0; y < height; ++y) {
+            const uint8_t* src = rgba + (size_t)y * width * 4;
+            for (uint32_t x = 0; x < width; ++x) {
+                // TGA stores BGRA
+                row[x * 4 + 0] = src[x * 4 + 2];
+                row[x * 4 + 1] = src[x * 4 + 1];
+                row[x * 4 + 2] = src[x * 4 + 0];
+                row[x * 4 + 3] = src[x * 4 + 3];
+            }
+            out.write(reinterpret_cast<const char*>(row.data()), (std::streamsize)row.size());
+        }
+        return (bool)out;
+    }
+
+    bool ImageWriter::WritePNG(const std::string& path, uint32_t width, uint32_t height,
+        const uint8_t* rgba, bool bottomUp) {
+        EG_PROFILE_FUNCTION();
+        // Scanlines: filter type 0 + RGBA row, top-down
+        const size_t stride = (size_t)width * 4 + 1;
+        std::vector<uint8_t> raw(stride * height);
+        for (uint32_t y = 0; y < height; ++y) {
+            raw[y * stride] = 0;
+            std::memcpy(&raw[y * stride + 1], TopDownRow(rgba, width, height, y, bottomUp), stride - 1);
+        }
+
+        std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+        auto chunk = [&png](const char* type, const std::vector<uint8_t>& data) {
+            PutBE32(png, (uint32_t)data.size());
+            const size_t start = png.size();
+            png.insert(png.end(), type, type + 4);
+            png.insert(png.end(), data.begin(), data.end());
+            PutBE32(png, Crc32(&png[start], png.size() - start));
+        };
+
+        std::vector<uint8_t> ihdr;
+        PutBE32(ihdr, width);
+        PutBE32(ihdr, height);
+        ihdr.insert(ihdr.end(), { 8, 6, 0, 0, 0 }); // 8-bit RGBA, no interlace
+        chunk("IHDR", ihdr);
+
+        // Zlib header, stored deflate blocks of at most 65535 bytes, Adler-32
+        std::vector<uint8_t> z = { 0x78, 0x01 };
+        z.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+        size_t pos = 0;
+        do {
+            const uint16_t len = (uint16_t)std::min<size_t>(raw.size() - pos, 65535);
+            z.push_back(pos + len == raw.size() ? 1 : 0);
+            z.insert(z.end(), { (uint8_t)len, (uint8_t)(len >> 8), (uint8_t)~len, (uint8_t)(~len >> 8) });
+            z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+            pos += len;
+        } while (pos < raw.size());
+        uint32_t a = 1, b = 0;
+        for (size_t i = 0; i < raw.size(); ) {
+            // 5552 bytes is the most that cannot overflow before the modulo
+            const size_t end = std::min(raw.size(), i + 5552);
+            for (; i < end; ++i) { a += raw[i]; b += a; }
+            a %= 65521;
+            b %= 65521;
+        }
+        PutBE32(z, (b << 16) | a);
+        chunk("IDAT", z);
+        chunk("IEND", {});
+
+        return WriteFile(path, png);
+    }
+
+    bool ImageWriter::WriteQOI(const std::string& path, uint32_t width, uint32_t height,
+        const uint8_t* rgba, bool bottomUp) {
+        EG_PROFILE_FUNCTION();
+        struct Px { uint8_t r, g, b, a; };
+        auto same = [](Px x, Px y) { return x.r == y.r && x.g == y.g && x.b == y.b && x.a == y.a; };
+        auto hash = [](Px p) { return (p.r * 3 + p.g * 5 + p.b * 7 + p.a * 11) % 64; };
+
+        std::vector<uint8_t> out = { 'q', 'o', 'i', 'f' };
+        out.reserve(14 + (size_t)width * height * 5 + 8);
+        PutBE32(out, width);
+        PutBE32(out, height);
+        out.push_back(4); // RGBA
+        out.push_back(0); // sRGB with linear alpha
+
+        Px index[64] = {};
+        Px prev{ 0, 0, 0, 255 };
+        uint32_t run = 0;
+        for (uint32_t y = 0; y < height; ++y) {
+            const uint8_t* row = TopDownRow(rgba, width, height, y, bottomUp);
+            for (uint32_t x = 0; x < width; ++x) {
+                const Px px{ row[x * 4 + 0], row[x * 4 + 1], row[x * 4 + 2], row[x * 4 + 3] };
+                if (same(px, prev)) {
+                    if (++run == 62) { out.push_back(0xc0 | 61); run = 0; }
+                    continue;
+                }
+                if (run) { out.push_back((uint8_t)(0xc0 | (run - 1))); run = 0; }
+
+                const int h = hash(px);
+                if (same(index[h], px)) {
+                    out.push_back((uint8_t)h);
+                }
+                else if (px.a == prev.a) {
+                    index[h] = px;
+                    const int8_t dr = (int8_t)(px.r - prev.r), dg = (int8_t)(px.g - prev.g), db = (int8_t)(px.b - prev.b);
+                    const int8_t drg = (int8_t)(dr - dg), dbg = (int8_t)(db - dg);
+                    if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1)
+                        out.push_back((uint8_t)(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                    else if (dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7) {
+                        out.push_back((uint8_t)(0x80 | (dg + 32)));
+                        out.push_back((uint8_t)((drg + 8) << 4 | (dbg + 8)));
+                    }
+                    else out.insert(out.end(), { 0xfe, px.r, px.g, px.b });
+                }
+                else {
+                    index[h] = px;
+                    out.insert(out.end(), { 0xff, px.r, px.g, px.b, px.a });
+                }
+                prev = px;
+            }
+        }
+        if (run) out.push_back((uint8_t)(0xc0 | (run - 1)));
+        out.insert(out.end(), { 0, 0, 0, 0, 0, 0, 0, 1 });
+
+        return WriteFile(path, out);
+    }
+
+    bool ImageWriter::Write(const std::string& path, uint32_t width, uint32_t height,
+        const uint8_t* rgba, bool bottomUp) {
+        std::string ext = std::filesystem::path(path).extension().string();
+        for (char& c : ext) c = (char)std::tolower((unsigned char)c);
+        if (ext == ".png") return WritePNG(path, width, height, rgba, bottomUp);
+        if (ext == ".qoi") return WriteQOI(path, width, height, rgba, bottomUp);
+        return WriteTGA(path, width, height, rgba, bottomUp);
+    }
+
+} // namespace Engine
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace Engine {
+
+    // Minimal image output for captures and headless runs.
+    class ImageWriter {
+    public:
+        // `rgba` is width*height RGBA8 pixels, first row at the top unless
+        // bottomUp is set (GL-style buffers).
+        static bool WriteTGA(const std::string& path, uint32_t width, uint32_t height,
+            const uint8_t* rgba, bool bottomUp = false);
+
+        // Zlib stream of stored (uncompressed) blocks: cheap to write, any
+        // viewer opens it. Prefer QOI for sequences.
+        static bool WritePNG(const std::string& path, uint32_t width, uint32_t height,
+            const uint8_t* rgba, bool bottomUp = false);
+
+        // "Quite OK Image" format: lossless, single pass, several times
+        // faster than deflate at a similar size for rendered frames.
+        static bool WriteQOI(const std::string& path, uint32_t width, uint32_t height,
+            const uint8_t* rgba, bool bottomUp = false);
+
+        // Picks the format from the extension (.png, .qoi, anything else TGA).
+        static bool Write(const std::string& path, uint32_t width, uint32_t height,
+            const uint8_t* rgba, bool bottomUp = false);
+    };
+
+} // namespace Engine
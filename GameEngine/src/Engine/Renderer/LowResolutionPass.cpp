@@ -0,0 +1,96 @@
+#include "enginepch.h"
+#include "LowResolutionPass.h"
+#include "RenderCommand.h"
+#include "Renderer2D.h"
+#include "CommandList.h"
+
+namespace Engine {
+
+    // Non-depth-aware composite: in front of everything the scene drew
+    static constexpr float kNearestDepth = -0.999f;
+
+    static float MillisecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    LowResolutionPass::LowResolutionPass(uint32_t width, uint32_t height, float scale)
+        : m_FullWidth(std::max(width, 1u)), m_FullHeight(std::max(height, 1u)),
+          m_Scale(glm::clamp(scale, MinScale, 1.0f)) {
+        ApplySize();
+    }
+
+    void LowResolutionPass::SetScale(float scale) {
+        m_Scale = glm::clamp(scale, MinScale, 1.0f);
+    }
+
+    void LowResolutionPass::OnResize(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0) return;
+        m_FullWidth = width;
+        m_FullHeight = height;
+    }
+
+    void LowResolutionPass::ApplySize() {
+        const uint32_t w = std::max(1u, (uint32_t)std::lround(m_FullWidth * m_Scale));
+        const uint32_t h = std::max(1u, (uint32_t)std::lround(m_FullHeight * m_Scale));
+        // Later resizes are recorded with the frame, so they reach the GPU on
+        // the render thread; the target's own spec lags until then.
+        if (!m_Target) m_Target = Framebuffer::Create({ w, h, true });
+        else if (w != m_Stats.Width || h != m_Stats.Height) RenderCommand::ResizeFramebuffer(m_Target, w, h);
+
+        m_Stats.Width = w;
+        m_Stats.Height = h;
+        m_Stats.FullWidth = m_FullWidth;
+        m_Stats.FullHeight = m_FullHeight;
+    }
+
+    void LowResolutionPass::Begin(const OrthographicCamera& camera) {
+        EG_PROFILE_FUNCTION();
+        if (m_Direct) {
+            Renderer2D::BeginScene(camera);
+            return;
+        }
+        ApplySize();
+
+        const glm::vec4 clip = camera.GetViewProjectionMatrix() * glm::vec4(0.0f, 0.0f, m_FXPlaneZ, 1.0f);
+        m_CompositeZ = m_DepthAware ? clip.z / clip.w : kNearestDepth;
+
+        if (auto* rec = CommandList::Recording()) rec->BindFramebuffer(m_Target);
+        else m_Target->Bind();
+        // After Bind: on the software backend it finishes the scene's work
+        m_Start = std::chrono::steady_clock::now();
+        RenderCommand::SetClearColor(glm::vec4(0.0f));
+        RenderCommand::Clear();
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::AlphaAccumulate);
+        Renderer2D::BeginScene(camera);
+    }
+
+    void LowResolutionPass::End() {
+        EG_PROFILE_FUNCTION();
+        Renderer2D::EndScene();
+        if (m_Direct) return;
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Alpha);
+        if (auto* rec = CommandList::Recording()) rec->UnbindFramebuffer();
+        else m_Target->Unbind();
+    }
+
+    void LowResolutionPass::Composite() {
+        EG_PROFILE_FUNCTION();
+        if (m_Direct) return;
+        // Full-screen quad in NDC; the color is already premultiplied
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Premultiplied);
+        Renderer2D::BeginScene(glm::mat4(1.0f));
+        Renderer2D::DrawQuad({ 0.0f, 0.0f, m_CompositeZ }, { 2.0f, 2.0f }, m_Target);
+        Renderer2D::EndScene();
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Alpha);
+
+        m_Stats.PassMs = MillisecondsSince(m_Start);
+        auto it = std::find_if(m_Timings.begin(), m_Timings.end(), [&](const Timing& t) { return t.Scale == m_Scale; });
+        if (it == m_Timings.end()) {
+            m_Timings.push_back({ m_Scale, m_Stats.PassMs, 1 });
+            return;
+        }
+        it->Samples++;
+        it->AverageMs += (m_Stats.PassMs - it->AverageMs) / (float)std::min(it->Samples, 64u);
+    }
+
+} // namespace Engine
@@ -0,0 +1,84 @@
+#pragma once
+#include <chrono>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Core/Core.h"
+#include "Framebuffer.h"
+#include "OrthographicCamera.h"
+
+namespace Engine {
+
+    // Renders fill-heavy translucent content (particles, smoke) into a
+    // target at a fraction of the screen resolution, then upsamples it
+    // bilinearly and blends it over the scene with one quad.
+    //
+    // Draws between Begin and End accumulate premultiplied color, so the
+    // composite matches drawing them directly except for resolution. With
+    // depth awareness the composite quad sits at the FX plane's depth and the
+    // full-resolution depth buffer clips it against nearer scene geometry,
+    // which keeps those edges sharp; otherwise it is drawn over everything.
+    class LowResolutionPass {
+    public:
+        static constexpr float MinScale = 0.125f;
+
+        // width/height: full (screen) resolution
+        LowResolutionPass(uint32_t width, uint32_t height, float scale = 0.5f);
+
+        // Clamped to [MinScale, 1]; takes effect at the next Begin.
+        void SetScale(float scale);
+        float GetScale() const { return m_Scale; }
+
+        void SetDepthAware(bool enabled, float fxPlaneZ = 0.0f) { m_DepthAware = enabled; m_FXPlaneZ = fxPlaneZ; }
+        bool IsDepthAware() const { return m_DepthAware; }
+
+        // Direct: Begin/End only open and close the Renderer2D scene on the
+        // current target and Composite does nothing, so the draws land at
+        // full resolution where an OverdrawView can count them.
+        void SetDirect(bool direct) { m_Direct = direct; }
+        bool IsDirect() const { return m_Direct; }
+
+        void OnResize(uint32_t width, uint32_t height);
+
+        // Begin binds the target and opens a Renderer2D scene; End closes
+        // both. Call outside any other Renderer2D scene.
+        void Begin(const OrthographicCamera& camera);
+        void End();
+        // Blends the result over the current target (after End). The quad
+        // writes depth across the screen, so composite after the scene.
+        void Composite();
+
+        struct Statistics {
+            uint32_t Width = 0, Height = 0;         // offscreen target
+            uint32_t FullWidth = 0, FullHeight = 0;
+            float    PassMs = 0.0f;                  // last Begin..Composite, CPU side
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+
+        // Running average of PassMs for every scale used so far, to compare
+        // the cost of the settings. On the software backend this includes
+        // rasterizing the particles; on a GPU it is submission cost only.
+        struct Timing {
+            float    Scale;
+            float    AverageMs;
+            uint32_t Samples;
+        };
+        const std::vector<Timing>& GetTimings() const { return m_Timings; }
+
+    private:
+        void ApplySize();
+
+        Shared<Framebuffer> m_Target;
+        uint32_t m_FullWidth, m_FullHeight;
+        float    m_Scale;
+        bool     m_DepthAware = false;
+        bool     m_Direct = false;
+        float    m_FXPlaneZ = 0.0f;
+        float    m_CompositeZ = 0.0f; // NDC depth of the composite quad
+
+        std::chrono::steady_clock::time_point m_Start;
+
+        Statistics          m_Stats;
+        std::vector<Timing> m_Timings;
+    };
+
+} // namespace Engine
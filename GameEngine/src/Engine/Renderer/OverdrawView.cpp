@@ -0,0 +1,152 @@
+#include "enginepch.h"
+#include "OverdrawView.h"
+#include <fstream>
+#include "RenderCommand.h"
+#include "Renderer2D.h"
+#include "CommandList.h"
+
+namespace Engine {
+
+    OverdrawView::OverdrawView(uint32_t width, uint32_t height)
+        : m_Width(std::max(width, 1u)), m_Height(std::max(height, 1u)) {
+        SetMaxCount(m_MaxCount);
+    }
+
+    void OverdrawView::OnResize(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0) return;
+        m_Width = width;
+        m_Height = height;
+    }
+
+    void OverdrawView::SetMaxCount(uint32_t count) {
+        m_MaxCount = std::clamp(count, 1u, 255u);
+        static const glm::vec3 kStops[] = {
+            { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f },
+            { 1.0f, 1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f },
+        };
+        constexpr uint32_t segments = (uint32_t)std::size(kStops) - 1;
+        for (uint32_t c = 0; c < 256; ++c) {
+            const float t = std::min((float)c / (float)m_MaxCount, 1.0f) * segments;
+            const uint32_t i = std::min((uint32_t)t, segments - 1);
+            const glm::vec3 rgb = glm::mix(kStops[i], kStops[i + 1], t - (float)i);
+            m_Ramp[c] = (uint32_t)(rgb.r * 255.0f + 0.5f) | ((uint32_t)(rgb.g * 255.0f + 0.5f) << 8)
+                | ((uint32_t)(rgb.b * 255.0f + 0.5f) << 16) | 0xff000000u;
+        }
+    }
+
+    void OverdrawView::Begin() {
+        EG_PROFILE_FUNCTION();
+        if (CommandList::Recording()) {
+            static bool warned = false;
+            if (!warned) EG_CORE_WARN("Overdraw view needs immediate rendering; disabled on the render thread");
+            warned = true;
+            return;
+        }
+        if (!m_Readback) m_Readback = FrameReadback::Create();
+        if (!m_Target) m_Target = Framebuffer::Create({ m_Width, m_Height, true });
+        else m_Target->Resize(m_Width, m_Height);
+
+        m_Target->Bind();
+        RenderCommand::Clear();
+        RenderCommand::SetOverdrawCounting(true);
+        m_Active = true;
+    }
+
+    void OverdrawView::End() {
+        EG_PROFILE_FUNCTION();
+        if (!m_Active) return;
+        m_Active = false;
+
+        RenderCommand::SetOverdrawCounting(false);
+        // Ring full: skip this frame rather than wait for the GPU
+        const FramebufferSpec& spec = m_Target->GetSpec();
+        m_Readback->Request(spec.Width, spec.Height, ++m_Frame, ReadbackSource::Stencil);
+        m_Target->Unbind();
+        Collect(false);
+    }
+
+    void OverdrawView::Flush() {
+        if (m_Readback) Collect(true);
+    }
+
+    void OverdrawView::Collect(bool wait) {
+        bool landed = false;
+        while (m_Readback->Poll(m_Counts, wait)) {
+            Analyze(m_Counts);
+            landed = true;
+        }
+        if (!landed) return;
+
+        // Heatmap from the newest counts only
+        const ReadbackImage& img = m_Counts;
+        if (!m_Heatmap || m_Heatmap->GetWidth() != img.Width || m_Heatmap->GetHeight() != img.Height)
+            m_Heatmap = Texture2D::Create(img.Width, img.Height);
+        m_HeatmapPixels.resize((size_t)img.Width * img.Height);
+        for (size_t i = 0; i < m_HeatmapPixels.size(); ++i) m_HeatmapPixels[i] = m_Ramp[img.Pixels[i]];
+        m_Heatmap->SetData(m_HeatmapPixels.data(), (uint32_t)(m_HeatmapPixels.size() * sizeof(uint32_t)));
+    }
+
+    void OverdrawView::Analyze(const ReadbackImage& counts) {
+        EG_PROFILE_FUNCTION();
+        uint64_t sum = 0, covered = 0;
+        uint32_t max = 0;
+        for (uint8_t c : counts.Pixels) {
+            sum += c;
+            covered += c != 0;
+            max = std::max(max, (uint32_t)c);
+        }
+        const double pixels = (double)std::max<size_t>(counts.Pixels.size(), 1);
+
+        FrameStats f;
+        f.Frame = counts.Tag;
+        f.Average = (float)(sum / pixels);
+        f.Max = max;
+        f.Coverage = (float)(covered / pixels);
+
+        m_History.push_back(f);
+        if (m_History.size() > HistorySize) m_History.pop_front();
+
+        m_Stats.Frames++;
+        m_Stats.Last = f;
+        m_AverageSum += f.Average;
+        m_Stats.MeanAverage = (float)(m_AverageSum / m_Stats.Frames);
+        m_Stats.PeakAverage = std::max(m_Stats.PeakAverage, f.Average);
+        m_Stats.PeakMax = std::max(m_Stats.PeakMax, f.Max);
+    }
+
+    void OverdrawView::Composite() {
+        EG_PROFILE_FUNCTION();
+        if (!m_Heatmap) return;
+        RenderCommand::Clear();
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Opaque);
+        Renderer2D::BeginScene(glm::mat4(1.0f));
+        Renderer2D::DrawQuad({ 0.0f, 0.0f, 0.0f }, { 2.0f, 2.0f }, m_Heatmap);
+        Renderer2D::EndScene();
+        RenderCommand::SetBlendMode(RendererAPI::BlendMode::Alpha);
+    }
+
+    bool OverdrawView::WriteReport(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out) {
+            EG_CORE_ERROR("Could not write overdraw report '{}'", path);
+            return false;
+        }
+        out << "{\n"
+            << "  \"width\": " << m_Width << ",\n"
+            << "  \"height\": " << m_Height << ",\n"
+            << "  \"frames\": " << m_Stats.Frames << ",\n"
+            << "  \"mean_average_overdraw\": " << m_Stats.MeanAverage << ",\n"
+            << "  \"peak_average_overdraw\": " << m_Stats.PeakAverage << ",\n"
+            << "  \"peak_max_overdraw\": " << m_Stats.PeakMax << ",\n"
+            << "  \"history\": [";
+        const char* sep = "\n";
+        for (const FrameStats& f : m_History) {
+            out << sep << "    { \"frame\": " << f.Frame << ", \"average\": " << f.Average
+                << ", \"max\": " << f.Max << ", \"coverage\": " << f.Coverage << " }";
+            sep = ",\n";
+        }
+        out << "\n  ]\n}\n";
+        return (bool)out;
+    }
+
+} // namespace Engine
@@ -0,0 +1,83 @@
+#pragma once
+#include <deque>
+#include <string>
+#include "Engine/Core/Core.h"
+#include "Framebuffer.h"
+#include "FrameReadback.h"
+#include "Texture.h"
+
+namespace Engine {
+
+    // Debug view of fill rate. Draws between Begin and End go to an
+    // offscreen target where every fragment that passes the depth test
+    // also increments the pixel's stencil (RendererAPI::SetOverdrawCounting).
+    // The counts come back through a FrameReadback a few frames later and
+    // are turned into per-frame numbers and a heatmap texture:
+    // black = untouched, then blue, green, yellow, red, white at MaxCount.
+    //
+    // Needs immediate rendering: under CommandList recording (render
+    // thread) Begin/End do nothing. The target is allocated and resized by
+    // Begin, so creating the view or resizing it never touches the GPU.
+    class OverdrawView {
+    public:
+        OverdrawView(uint32_t width, uint32_t height);
+
+        void OnResize(uint32_t width, uint32_t height);
+
+        // Counts above this are drawn white in the heatmap.
+        void SetMaxCount(uint32_t count);
+
+        void Begin();
+        void End();
+
+        // Heatmap of the newest finished readback over the whole viewport.
+        void Composite();
+        const Shared<Texture2D>& GetHeatmap() const { return m_Heatmap; }
+
+        // Waits for every requested readback (tests, before WriteReport).
+        void Flush();
+
+        struct FrameStats {
+            uint64_t Frame = 0;
+            float    Average = 0.0f;  // fragments per pixel of the target
+            uint32_t Max = 0;         // worst pixel (saturates at 255)
+            float    Coverage = 0.0f; // fraction of pixels drawn at least once
+        };
+
+        struct Statistics {
+            uint64_t   Frames = 0;          // measured so far
+            FrameStats Last;
+            float      MeanAverage = 0.0f;  // of Last.Average over all frames
+            float      PeakAverage = 0.0f;
+            uint32_t   PeakMax = 0;
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+
+        // Newest last; keeps the most recent HistorySize frames.
+        static constexpr size_t HistorySize = 600;
+        const std::deque<FrameStats>& GetHistory() const { return m_History; }
+
+        // Summary and history as JSON, for tracking overdraw across builds.
+        bool WriteReport(const std::string& path) const;
+
+    private:
+        void Collect(bool wait);
+        void Analyze(const ReadbackImage& counts);
+
+        Shared<Framebuffer>   m_Target; // created by the first Begin
+        uint32_t m_Width, m_Height;
+        Shared<FrameReadback> m_Readback;
+        Shared<Texture2D>     m_Heatmap;
+        ReadbackImage         m_Counts;
+        std::vector<uint32_t> m_HeatmapPixels;
+        uint32_t m_Ramp[256];
+        uint32_t m_MaxCount = 8;
+        uint64_t m_Frame = 0;
+        bool     m_Active = false; // between a Begin that bound the target and End
+
+        std::deque<FrameStats> m_History;
+        double     m_AverageSum = 0.0;
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
@@ -1,14 +1,27 @@
 #include "enginepch.h"
 #include "RenderCommand.h"
 #include "Platforms/OpenGL/OpenGLRendererAPI.h"
+#include "Platforms/Software/SoftwareRendererAPI.h"
+#include "Platforms/Recording/RecordingRendererAPI.h"
 
 namespace Engine {
 
     std::unique_ptr<RendererAPI>& RenderCommand::API() {
         static std::unique_ptr<RendererAPI> sApi;
-        if (!sApi) {
-            // one simple switch here if more APIs appear in future
-            sApi = std::make_unique<OpenGLRendererAPI>();
+        static RendererAPI::API sCreatedFor = RendererAPI::API::None;
+        if (!sApi || sCreatedFor != RendererAPI::GetAPI()) {
+            sCreatedFor = RendererAPI::GetAPI();
+            switch (sCreatedFor) {
+            case RendererAPI::API::Software:
+                sApi = std::make_unique<SoftwareRendererAPI>();
+                break;
+            case RendererAPI::API::Recording:
+                sApi = std::make_unique<RecordingRendererAPI>();
+                break;
+            default:
+                sApi = std::make_unique<OpenGLRendererAPI>();
+                break;
+            }
         }
         return sApi;
     }
@@ -1,15 +1,49 @@
 #pragma once
 #include "RendererAPI.h"
+#include "CommandList.h"
 
 namespace Engine {
 
+    // Static entry points for GPU commands. While a CommandList is recording
+    // on the calling thread (see CommandList::RecordingScope), the commands
+    // are appended to it instead of being issued.
     class RenderCommand {
     public:
         static void Init() { API()->Init(); }
-        static void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) { API()->SetViewport(x, y, w, h); }
-        static void SetClearColor(const glm::vec4& c) { API()->SetClearColor(c); }
-        static void Clear() { API()->Clear(); }
-        static void DrawIndexed(const Shared<VertexArray>& va) { API()->DrawIndexed(va); }
+        static void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+            if (auto* rec = CommandList::Recording()) { rec->SetViewport(x, y, w, h); return; }
+            API()->SetViewport(x, y, w, h);
+        }
+        static void SetClearColor(const glm::vec4& c) {
+            if (auto* rec = CommandList::Recording()) { rec->SetClearColor(c); return; }
+            API()->SetClearColor(c);
+        }
+        static void Clear() {
+            if (auto* rec = CommandList::Recording()) { rec->Clear(); return; }
+            API()->Clear();
+        }
+        static void SetBlendMode(RendererAPI::BlendMode mode) {
+            if (auto* rec = CommandList::Recording()) { rec->SetBlendMode(mode); return; }
+            API()->SetBlendMode(mode);
+        }
+        static void SetOverdrawCounting(bool enabled) {
+            if (auto* rec = CommandList::Recording()) { rec->SetOverdrawCounting(enabled); return; }
+            API()->SetOverdrawCounting(enabled);
+        }
+        static void DrawIndexed(const Shared<VertexArray>& va, uint32_t indexCount = 0) {
+            if (auto* rec = CommandList::Recording()) { rec->DrawIndexed(va, indexCount); return; }
+            API()->DrawIndexed(va, indexCount);
+        }
+        static void DrawIndexedInstanced(const Shared<VertexArray>& va, uint32_t instanceCount, uint32_t baseInstance = 0) {
+            if (auto* rec = CommandList::Recording()) { rec->DrawIndexedInstanced(va, instanceCount, baseInstance); return; }
+            API()->DrawIndexedInstanced(va, instanceCount, baseInstance);
+        }
+        // Recorded like the draws that use the target, so it is reallocated
+        // on the thread that owns the context.
+        static void ResizeFramebuffer(const Shared<Framebuffer>& framebuffer, uint32_t width, uint32_t height) {
+            if (auto* rec = CommandList::Recording()) { rec->ResizeFramebuffer(framebuffer, width, height); return; }
+            framebuffer->Resize(width, height);
+        }
 
     private:
         static std::unique_ptr<RendererAPI>& API();
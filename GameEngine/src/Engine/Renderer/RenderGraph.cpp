@@ -0,0 +1,361 @@
+#include "enginepch.h"
+#include "RenderGraph.h"
+#include "CommandList.h"
+#include "RenderCommand.h"
+#include <queue>
+
+namespace Engine {
+
+    static uint64_t BytesOf(const FramebufferSpec& spec) {
+        return (uint64_t)spec.Width * spec.Height * (spec.Depth ? 8 : 4);
+    }
+
+    static bool SameSpec(const FramebufferSpec& a, const FramebufferSpec& b) {
+        return a.Width == b.Width && a.Height == b.Height && a.Depth == b.Depth;
+    }
+
+    // The writer whose version of a resource pass `p` reads, given the
+    // resource's writers in declaration order: the nearest one declared
+    // before `p`. A resource only written later (passes declared out of
+    // order) is read in its final version, except by a pass that blends onto
+    // it, which has nothing to blend onto. -1 if there is no such writer.
+    static int ProducerOf(uint32_t p, bool blendsOnto, const std::vector<uint32_t>& writers) {
+        auto it = std::lower_bound(writers.begin(), writers.end(), p);
+        if (it != writers.begin()) return (int)*(it - 1);
+        if (blendsOnto || writers.empty()) return -1;
+        return (int)writers.back();
+    }
+
+    // ---- Builder / Context ----
+
+    void RenderGraph::Builder::Read(Resource r) {
+        EG_CORE_CHECK(r < m_Graph.m_Resources.size(), "Unknown render graph resource");
+        auto& reads = m_Graph.m_Passes[m_Pass].Reads;
+        if (std::find(reads.begin(), reads.end(), r) == reads.end()) reads.push_back(r);
+    }
+
+    void RenderGraph::Builder::Write(Resource r) {
+        EG_CORE_CHECK(r < m_Graph.m_Resources.size(), "Unknown render graph resource");
+        PassNode& pass = m_Graph.m_Passes[m_Pass];
+        EG_CORE_CHECK(pass.Write == InvalidResource || pass.Write == r, "A pass writes one render target");
+        pass.Write = r;
+    }
+
+    void RenderGraph::Builder::SideEffect() {
+        m_Graph.m_Passes[m_Pass].SideEffect = true;
+    }
+
+    const Shared<Texture2D>& RenderGraph::Context::GetTexture(Resource r) const {
+        const Shared<Framebuffer>& fb = m_Graph.TargetOf(r);
+        EG_CORE_CHECK(fb, "Resource has no texture (the backbuffer cannot be sampled)");
+        return fb->GetColorAttachment();
+    }
+
+    const Shared<Framebuffer>& RenderGraph::Context::GetTarget(Resource r) const {
+        const Shared<Framebuffer>& fb = m_Graph.TargetOf(r);
+        EG_CORE_CHECK(fb, "Resource has no target of its own (the backbuffer)");
+        return fb;
+    }
+
+    // ---- Declaration ----
+
+    RenderGraph::Resource RenderGraph::CreateTransient(const std::string& name, const FramebufferSpec& spec) {
+        ResourceNode node;
+        node.Name = name;
+        node.Spec = spec;
+        m_Resources.push_back(std::move(node));
+        m_Dirty = true;
+        return (Resource)m_Resources.size() - 1;
+    }
+
+    RenderGraph::Resource RenderGraph::Import(const std::string& name, Shared<Framebuffer> target) {
+        ResourceNode node;
+        node.Name = name;
+        node.Imported = true;
+        if (target) node.Spec = target->GetSpec();
+        node.External = std::move(target);
+        m_Resources.push_back(std::move(node));
+        m_Dirty = true;
+        return (Resource)m_Resources.size() - 1;
+    }
+
+    void RenderGraph::SetSpec(Resource r, const FramebufferSpec& spec) {
+        EG_CORE_CHECK(r < m_Resources.size() && !m_Resources[r].Imported, "Only transients can be resized");
+        if (SameSpec(m_Resources[r].Spec, spec)) return;
+        m_Resources[r].Spec = spec;
+        m_Dirty = true;
+    }
+
+    void RenderGraph::AddPass(const std::string& name, const SetupFn& setup, ExecuteFn execute) {
+        PassNode pass;
+        pass.Name = name;
+        pass.Execute = std::move(execute);
+        m_Passes.push_back(std::move(pass));
+        Builder builder(*this, (uint32_t)m_Passes.size() - 1);
+        if (setup) setup(builder);
+        m_Dirty = true;
+    }
+
+    // ---- Compile ----
+
+    void RenderGraph::Compile() {
+        EG_PROFILE_FUNCTION();
+        Cull();
+        Sort();
+        AssignTargets();
+        m_Dirty = false;
+    }
+
+    void RenderGraph::Cull() {
+        // Writers per resource, in declaration order
+        std::vector<std::vector<uint32_t>> writers(m_Resources.size());
+        for (uint32_t p = 0; p < (uint32_t)m_Passes.size(); ++p)
+            if (m_Passes[p].Write != InvalidResource) writers[m_Passes[p].Write].push_back(p);
+
+        // Walk back from the outputs; a reader needs the writer of the
+        // version it reads.
+        std::vector<uint32_t> stack;
+        for (uint32_t p = 0; p < (uint32_t)m_Passes.size(); ++p) {
+            PassNode& pass = m_Passes[p];
+            pass.Culled = !(pass.SideEffect || (pass.Write != InvalidResource && m_Resources[pass.Write].Imported));
+            if (!pass.Culled) stack.push_back(p);
+        }
+        auto need = [&](uint32_t p) {
+            if (m_Passes[p].Culled) {
+                m_Passes[p].Culled = false;
+                stack.push_back(p);
+            }
+        };
+        while (!stack.empty()) {
+            const uint32_t p = stack.back();
+            stack.pop_back();
+            for (Resource r : m_Passes[p].Reads) {
+                const int producer = ProducerOf(p, m_Passes[p].Write == r, writers[r]);
+                if (producer >= 0) need((uint32_t)producer);
+            }
+        }
+    }
+
+    void RenderGraph::Sort() {
+        // Edges: writers of a resource keep their declaration order, a reader
+        // comes after the writer of the version it reads and before the
+        // writer of the next one
+        const uint32_t n = (uint32_t)m_Passes.size();
+        std::vector<std::vector<uint32_t>> edges(n);
+        std::vector<uint32_t> inDegree(n, 0);
+        auto edge = [&](uint32_t from, uint32_t to) {
+            if (from == to || m_Passes[from].Culled || m_Passes[to].Culled) return;
+            edges[from].push_back(to);
+            inDegree[to]++;
+        };
+        std::vector<std::vector<uint32_t>> writers(m_Resources.size());
+        for (uint32_t p = 0; p < n; ++p)
+            if (!m_Passes[p].Culled && m_Passes[p].Write != InvalidResource) writers[m_Passes[p].Write].push_back(p);
+        for (const auto& w : writers)
+            for (size_t i = 1; i < w.size(); ++i) edge(w[i - 1], w[i]);
+
+        for (uint32_t p = 0; p < n; ++p) {
+            if (m_Passes[p].Culled) continue;
+            for (Resource r : m_Passes[p].Reads) {
+                const auto& w = writers[r];
+                const int producer = ProducerOf(p, m_Passes[p].Write == r, w);
+                if (producer < 0) continue;
+                edge((uint32_t)producer, p);
+                auto next = std::upper_bound(w.begin(), w.end(), (uint32_t)producer);
+                if (next != w.end()) edge(p, *next); // a no-op when that is p itself
+            }
+        }
+
+        // Kahn; the smallest declaration index goes first among ready passes
+        std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ready;
+        uint32_t live = 0;
+        for (uint32_t p = 0; p < n; ++p) {
+            if (m_Passes[p].Culled) continue;
+            live++;
+            if (inDegree[p] == 0) ready.push(p);
+        }
+        m_Order.clear();
+        while (!ready.empty()) {
+            const uint32_t p = ready.top();
+            ready.pop();
+            m_Order.push_back(p);
+            for (uint32_t next : edges[p])
+                if (--inDegree[next] == 0) ready.push(next);
+        }
+
+        EG_CORE_CHECK(m_Order.size() == live, "Render graph has a cycle");
+        if (m_Order.size() != live) {
+            // Declaration order still gives a frame
+            m_Order.clear();
+            for (uint32_t p = 0; p < n; ++p)
+                if (!m_Passes[p].Culled) m_Order.push_back(p);
+        }
+    }
+
+    void RenderGraph::AssignTargets() {
+        for (ResourceNode& r : m_Resources) {
+            r.First = r.Last = -1;
+            r.Physical = UINT32_MAX;
+        }
+        for (int i = 0; i < (int)m_Order.size(); ++i) {
+            const PassNode& pass = m_Passes[m_Order[i]];
+            auto touch = [&](Resource r) {
+                ResourceNode& node = m_Resources[r];
+                if (node.First < 0) node.First = i;
+                node.Last = i;
+            };
+            for (Resource r : pass.Reads) touch(r);
+            if (pass.Write != InvalidResource) touch(pass.Write);
+        }
+
+        // Greedy interval assignment, by first use: take a free slot of the
+        // same spec, else open a new one
+        std::vector<Resource> transients;
+        for (Resource r = 0; r < (Resource)m_Resources.size(); ++r)
+            if (!m_Resources[r].Imported && m_Resources[r].First >= 0) transients.push_back(r);
+        std::sort(transients.begin(), transients.end(),
+            [this](Resource a, Resource b) { return m_Resources[a].First < m_Resources[b].First; });
+
+        std::vector<FramebufferSpec> slotSpec;
+        std::vector<int> slotFreeAfter; // last position using the slot
+        m_Stats.TransientBytes = 0;
+        for (Resource r : transients) {
+            ResourceNode& node = m_Resources[r];
+            m_Stats.TransientBytes += BytesOf(node.Spec);
+            for (uint32_t s = 0; s < (uint32_t)slotSpec.size(); ++s) {
+                if (slotFreeAfter[s] < node.First && SameSpec(slotSpec[s], node.Spec)) {
+                    node.Physical = s;
+                    break;
+                }
+            }
+            if (node.Physical == UINT32_MAX) {
+                node.Physical = (uint32_t)slotSpec.size();
+                slotSpec.push_back(node.Spec);
+                slotFreeAfter.push_back(-1);
+            }
+            slotFreeAfter[node.Physical] = node.Last;
+        }
+
+        // Keep the Framebuffers from the last compile where they fit
+        m_Physical.resize(slotSpec.size());
+        m_Stats.PhysicalBytes = 0;
+        for (uint32_t s = 0; s < (uint32_t)slotSpec.size(); ++s) {
+            Physical& ph = m_Physical[s];
+            if (!ph.Target || ph.Spec.Depth != slotSpec[s].Depth) {
+                EG_CORE_CHECK(!CommandList::Recording(), "RenderGraph needs a new target while recording; Compile before the frame");
+                ph.Target = Framebuffer::Create(slotSpec[s]);
+            }
+            else if (!SameSpec(ph.Spec, slotSpec[s])) {
+                RenderCommand::ResizeFramebuffer(ph.Target, slotSpec[s].Width, slotSpec[s].Height);
+            }
+            ph.Spec = slotSpec[s];
+            m_Stats.PhysicalBytes += BytesOf(ph.Spec);
+        }
+
+        m_Stats.Passes = (uint32_t)m_Order.size();
+        m_Stats.CulledPasses = (uint32_t)(m_Passes.size() - m_Order.size());
+        m_Stats.Transients = (uint32_t)transients.size();
+        m_Stats.PhysicalTargets = (uint32_t)m_Physical.size();
+    }
+
+    const Shared<Framebuffer>& RenderGraph::TargetOf(Resource r) const {
+        static const Shared<Framebuffer> none;
+        const ResourceNode& node = m_Resources[r];
+        if (node.Imported) return node.External;
+        return node.Physical < m_Physical.size() ? m_Physical[node.Physical].Target : none;
+    }
+
+    // ---- Execute ----
+
+    void RenderGraph::Execute() {
+        EG_PROFILE_FUNCTION();
+        if (m_Dirty) Compile();
+
+        CommandList* rec = CommandList::Recording();
+        Shared<Framebuffer> bound; // empty: the target active at entry
+        auto bind = [&](const Shared<Framebuffer>& target) {
+            if (target == bound) return;
+            if (bound) {
+                if (rec) rec->UnbindFramebuffer();
+                else bound->Unbind();
+            }
+            if (target) {
+                if (rec) rec->BindFramebuffer(target);
+                else target->Bind();
+            }
+            bound = target;
+            m_Stats.TargetSwitches++;
+        };
+
+        m_Stats.TargetSwitches = 0;
+        const Context context(*this);
+        for (uint32_t p : m_Order) {
+            const PassNode& pass = m_Passes[p];
+            bind(pass.Write != InvalidResource ? TargetOf(pass.Write) : Shared<Framebuffer>());
+            EG_PROFILE_SCOPE(pass.Name.c_str());
+            if (pass.Execute) pass.Execute(context);
+        }
+        bind(nullptr);
+    }
+
+    // ---- Debug ----
+
+    std::string RenderGraph::Dump() const {
+        std::ostringstream out;
+        out << "RenderGraph: " << m_Order.size() << " passes, " << (m_Passes.size() - m_Order.size()) << " culled, "
+            << m_Stats.Transients << " transients in " << m_Physical.size() << " targets ("
+            << m_Stats.PhysicalBytes / 1024 << " KiB of " << m_Stats.TransientBytes / 1024 << " KiB)\n";
+
+        out << "Passes:\n";
+        auto listPass = [&](const PassNode& pass) {
+            if (!pass.Reads.empty()) {
+                out << "  reads";
+                for (Resource r : pass.Reads) out << ' ' << m_Resources[r].Name;
+            }
+            if (pass.Write != InvalidResource) out << "  writes " << m_Resources[pass.Write].Name;
+            if (pass.SideEffect) out << "  (side effect)";
+            out << '\n';
+        };
+        for (uint32_t i = 0; i < (uint32_t)m_Order.size(); ++i) {
+            out << "  " << i << ' ' << m_Passes[m_Order[i]].Name;
+            listPass(m_Passes[m_Order[i]]);
+        }
+        for (const PassNode& pass : m_Passes) {
+            if (!pass.Culled) continue;
+            out << "  - " << pass.Name << " [culled]";
+            listPass(pass);
+        }
+
+        out << "Resources:\n";
+        for (const ResourceNode& r : m_Resources) {
+            out << "  " << r.Name;
+            if (r.Imported) out << " imported";
+            else out << ' ' << r.Spec.Width << 'x' << r.Spec.Height << (r.Spec.Depth ? "+depth" : "");
+            if (r.First < 0) out << " unused";
+            else out << " live " << r.First << ".." << r.Last;
+            if (r.Physical != UINT32_MAX) out << " -> target " << r.Physical;
+            out << '\n';
+        }
+        return out.str();
+    }
+
+    std::string RenderGraph::DumpGraphviz() const {
+        std::ostringstream out;
+        out << "digraph RenderGraph {\n  rankdir=LR;\n";
+        for (uint32_t p = 0; p < (uint32_t)m_Passes.size(); ++p) {
+            const PassNode& pass = m_Passes[p];
+            out << "  p" << p << " [shape=box, label=\"" << pass.Name << "\"" << (pass.Culled ? ", style=dashed" : "") << "];\n";
+            for (Resource r : pass.Reads) out << "  r" << r << " -> p" << p << ";\n";
+            if (pass.Write != InvalidResource) out << "  p" << p << " -> r" << pass.Write << ";\n";
+        }
+        for (Resource r = 0; r < (Resource)m_Resources.size(); ++r) {
+            const ResourceNode& node = m_Resources[r];
+            out << "  r" << r << " [shape=ellipse, label=\"" << node.Name;
+            if (node.Physical != UINT32_MAX) out << "\\ntarget " << node.Physical;
+            out << "\"" << (node.Imported ? ", style=bold" : "") << "];\n";
+        }
+        out << "}\n";
+        return out.str();
+    }
+
+} // namespace Engine
@@ -0,0 +1,135 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+#include "Engine/Core/Core.h"
+#include "Framebuffer.h"
+
+namespace Engine {
+
+    // Frame described as passes that declare the render targets they read
+    // and write. Compile derives what the hand-wired version had to get
+    // right by hand:
+    //  - passes whose output nobody uses are culled;
+    //  - passes run in dependency order (declaration order breaks ties);
+    //  - transient targets whose lifetimes do not overlap share one
+    //    Framebuffer, and consecutive passes on the same target bind it once.
+    //
+    // Write alone means the previous content is not needed (the pass clears
+    // or covers it); a pass that blends onto a target must Read and Write
+    // it. Writes to imported resources are the graph's outputs.
+    //
+    // Each write makes a new version of its resource. A Read sees the
+    // version of the nearest write declared before it (the last one if all
+    // writes come later), and the next write waits until it is done.
+    class RenderGraph {
+    public:
+        using Resource = uint32_t;
+        static constexpr Resource InvalidResource = UINT32_MAX;
+
+        class Builder {
+        public:
+            void Read(Resource r);
+            // One render target per pass; it is bound while the pass runs.
+            void Write(Resource r);
+            // Run even if nothing reads the output (readbacks, stats).
+            void SideEffect();
+
+        private:
+            friend class RenderGraph;
+            Builder(RenderGraph& graph, uint32_t pass) : m_Graph(graph), m_Pass(pass) {}
+            RenderGraph& m_Graph;
+            uint32_t     m_Pass;
+        };
+
+        class Context {
+        public:
+            // Color attachment of a resource the pass declared as read.
+            const Shared<Texture2D>& GetTexture(Resource r) const;
+            // Its target; while recording, sample it with the framebuffer
+            // overload of Renderer2D::DrawQuad, which resolves the attachment
+            // after any resize recorded in the same frame.
+            const Shared<Framebuffer>& GetTarget(Resource r) const;
+
+        private:
+            friend class RenderGraph;
+            explicit Context(const RenderGraph& graph) : m_Graph(graph) {}
+            const RenderGraph& m_Graph;
+        };
+
+        using SetupFn = std::function<void(Builder&)>;
+        using ExecuteFn = std::function<void(const Context&)>;
+
+        // Owned by the graph; content is undefined when a pass first writes it.
+        Resource CreateTransient(const std::string& name, const FramebufferSpec& spec);
+        // Lives outside the graph. nullptr stands for whatever target is bound
+        // when Execute starts (normally the backbuffer).
+        Resource Import(const std::string& name, Shared<Framebuffer> target = nullptr);
+        // New size for a transient (window resize); recompiles on next Execute.
+        void SetSpec(Resource r, const FramebufferSpec& spec);
+
+        // Execute runs outside the pass's own Renderer2D scene: a pass
+        // begins and ends its scenes itself.
+        void AddPass(const std::string& name, const SetupFn& setup, ExecuteFn execute);
+
+        // Creating targets needs the graphics context, so compile outside a
+        // recorded frame after adding resources or passes. Recompiling for
+        // SetSpec only resizes, which is recorded like any other command.
+        void Compile();
+        // Compiles first if the graph changed.
+        void Execute();
+
+        // Compiled order, culled passes, lifetimes and target assignment.
+        std::string Dump() const;
+        // Same graph in Graphviz dot syntax.
+        std::string DumpGraphviz() const;
+
+        struct Statistics {
+            uint32_t Passes = 0, CulledPasses = 0;
+            uint32_t Transients = 0, PhysicalTargets = 0;
+            uint64_t TransientBytes = 0, PhysicalBytes = 0; // color + depth, 4 bytes each
+            uint32_t TargetSwitches = 0; // last Execute
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+
+    private:
+        struct ResourceNode {
+            std::string         Name;
+            FramebufferSpec     Spec;
+            bool                Imported = false;
+            Shared<Framebuffer> External;
+            // Compiled
+            int      First = -1, Last = -1; // positions in m_Order
+            uint32_t Physical = UINT32_MAX;
+        };
+
+        struct PassNode {
+            std::string           Name;
+            ExecuteFn             Execute;
+            std::vector<Resource> Reads;
+            Resource              Write = InvalidResource;
+            bool                  SideEffect = false;
+            bool                  Culled = false;
+        };
+
+        // Empty for the backbuffer import
+        const Shared<Framebuffer>& TargetOf(Resource r) const;
+        void Cull();
+        void Sort();
+        void AssignTargets();
+
+        std::vector<ResourceNode> m_Resources;
+        std::vector<PassNode>     m_Passes;
+        std::vector<uint32_t>     m_Order; // pass indices, culled ones left out
+        bool m_Dirty = true;
+
+        struct Physical {
+            FramebufferSpec     Spec;
+            Shared<Framebuffer> Target;
+        };
+        std::vector<Physical> m_Physical;
+
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
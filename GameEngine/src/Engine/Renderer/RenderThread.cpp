@@ -0,0 +1,120 @@
+#include "enginepch.h"
+#include "RenderThread.h"
+#include <chrono>
+
+namespace Engine {
+
+    using Clock = std::chrono::steady_clock;
+
+    static double MillisecondsSince(Clock::time_point t) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - t).count();
+    }
+
+    void RenderThread::Start(GraphicsContext& context, uint32_t maxFramesInFlight) {
+        EG_CORE_CHECK(!IsRunning(), "Render thread already running");
+        EG_CORE_CHECK(maxFramesInFlight > 0, "Need at least one frame in flight");
+
+        m_Context = &context;
+        m_Stopping = false;
+        m_Stats = {};
+
+        // One packet being recorded + the ones in flight
+        m_Packets = std::vector<FramePacket>(maxFramesInFlight + 1);
+        m_Free.clear();
+        m_Ready.clear();
+        for (uint32_t i = 0; i < (uint32_t)m_Packets.size(); ++i) m_Free.push_back(i);
+        m_Recording = UINT32_MAX;
+
+        m_Thread = std::thread([this] { ThreadMain(); });
+    }
+
+    void RenderThread::Stop() {
+        if (!IsRunning()) return;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_ReadyCV.notify_one();
+        m_Thread.join();
+        m_Packets.clear();
+    }
+
+    FramePacket& RenderThread::BeginFrame() {
+        EG_PROFILE_FUNCTION();
+        EG_CORE_CHECK(m_Recording == UINT32_MAX, "BeginFrame called twice");
+
+        const auto waitStart = Clock::now();
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        if (m_Free.empty()) {
+            EG_PROFILE_SCOPE("RenderThread::WaitForFreePacket");
+            m_FreeCV.wait(lock, [this] { return !m_Free.empty(); });
+        }
+        m_Stats.MainBlockedMs += MillisecondsSince(waitStart);
+
+        m_Recording = m_Free.back();
+        m_Free.pop_back();
+
+        FramePacket& packet = m_Packets[m_Recording];
+        packet.FrameIndex = m_NextFrame++;
+        packet.Commands.Reset();
+        packet.Overlay = nullptr;
+        return packet;
+    }
+
+    void RenderThread::EndFrame() {
+        EG_CORE_CHECK(m_Recording != UINT32_MAX, "EndFrame without BeginFrame");
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Ready.push_back(m_Recording);
+            m_Recording = UINT32_MAX;
+        }
+        m_ReadyCV.notify_one();
+    }
+
+    RenderThread::Statistics RenderThread::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Stats;
+    }
+
+    void RenderThread::ThreadMain() {
+        EG_PROFILE_THREAD("Render");
+        m_Context->MakeCurrent();
+
+        CommandQueue queue;
+        for (;;) {
+            uint32_t index;
+            {
+                const auto waitStart = Clock::now();
+                EG_PROFILE_SCOPE("RenderThread::WaitForFrame");
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_ReadyCV.wait(lock, [this] { return !m_Ready.empty() || m_Stopping; });
+                m_Stats.RenderIdleMs += MillisecondsSince(waitStart);
+                if (m_Ready.empty()) break; // stopping and drained
+                index = m_Ready.front();
+                m_Ready.pop_front();
+            }
+
+            const auto busyStart = Clock::now();
+            {
+                EG_PROFILE_SCOPE("RenderThread::Frame");
+                FramePacket& packet = m_Packets[index];
+                queue.Replay({ &packet.Commands });
+                if (packet.Overlay) packet.Overlay();
+
+                EG_PROFILE_SCOPE("RenderThread::SwapBuffers");
+                m_Context->SwapBuffers();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Stats.RenderBusyMs += MillisecondsSince(busyStart);
+                m_Stats.FramesRendered++;
+                m_Free.push_back(index);
+            }
+            m_FreeCV.notify_one();
+        }
+
+        m_Context->ReleaseCurrent();
+    }
+
+} // namespace Engine
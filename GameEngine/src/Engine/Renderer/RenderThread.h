@@ -0,0 +1,72 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CommandList.h"
+#include "GraphicsContext.h"
+
+namespace Engine {
+
+    // Everything the render thread needs to draw one frame. Camera and
+    // uniform data travel inside the recorded commands.
+    struct FramePacket {
+        uint64_t    FrameIndex = 0;
+        CommandList Commands;
+        // Runs after the commands, before the swap (e.g. the ImGui draw data).
+        std::function<void()> Overlay;
+    };
+
+    // Owns the graphics context on a dedicated thread. The main thread fills
+    // frame N+1 while frame N is replayed and swapped; at most
+    // `maxFramesInFlight` packets wait for the render thread, after which
+    // BeginFrame blocks (backpressure).
+    class RenderThread {
+    public:
+        RenderThread() = default;
+        ~RenderThread() { Stop(); }
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        // The context must not be current on the calling thread.
+        void Start(GraphicsContext& context, uint32_t maxFramesInFlight = 1);
+        // Renders the frames already handed over, then releases the context.
+        void Stop();
+        bool IsRunning() const { return m_Thread.joinable(); }
+
+        // Main thread. Returns an empty packet to record into.
+        FramePacket& BeginFrame();
+        void EndFrame();
+
+        struct Statistics {
+            uint64_t FramesRendered = 0;
+            double   MainBlockedMs = 0.0;  // main thread waiting for a free packet
+            double   RenderIdleMs = 0.0;   // render thread waiting for work
+            double   RenderBusyMs = 0.0;   // replay + swap
+        };
+        Statistics GetStats() const;
+
+    private:
+        void ThreadMain();
+
+        GraphicsContext* m_Context = nullptr;
+        std::thread      m_Thread;
+
+        std::vector<FramePacket> m_Packets;
+        std::vector<uint32_t>    m_Free;  // packets the main thread may fill
+        std::deque<uint32_t>     m_Ready; // packets waiting for the render thread
+        uint32_t m_Recording = UINT32_MAX;
+        uint64_t m_NextFrame = 0;
+        bool     m_Stopping = false;
+
+        mutable std::mutex      m_Mutex;
+        std::condition_variable m_ReadyCV;
+        std::condition_variable m_FreeCV;
+
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
@@ -5,6 +5,44 @@
 
 namespace Engine {
 
+    // One queued Submit call.
+    struct RenderPacket {
+        Shared<Shader>             Program;
+        Shared<VertexArray>        Mesh;
+        glm::mat4                  Transform;
+        Shared<const UniformBlock> Uniforms; // the shader's uniforms as of Submit
+    };
+
+    struct RenderQueue {
+        static constexpr uint32_t MaxInstances = 10000;
+
+        std::vector<RenderPacket> Packets;
+        std::vector<glm::mat4>    InstanceTransforms; // one upload per EndScene
+
+        // Per-instance stream shared by every instanced mesh
+        Shared<VertexBuffer> InstanceVB;
+
+        // Source mesh -> same buffers plus the instance stream. The weak_ptr
+        // lets entries for destroyed meshes be dropped.
+        struct InstancedMesh {
+            std::weak_ptr<VertexArray> Source;
+            Shared<VertexArray>        Instanced;
+        };
+        std::unordered_map<const VertexArray*, InstancedMesh> InstancedMeshes;
+
+        // Shader sort ID -> `a_Transform` location (-1: no instance input)
+        std::unordered_map<uint32_t, int> TransformLocations;
+        // (shader sort ID, mesh slots) pairs already reported as misplaced
+        std::unordered_set<uint64_t> ReportedMismatches;
+
+        Renderer::Statistics Stats;
+    };
+
+    static RenderQueue& Queue() {
+        static RenderQueue q;
+        return q;
+    }
+
     Renderer::SceneData& Renderer::Scene() {
         static SceneData s;
         return s;
@@ -19,18 +57,37 @@ namespace Engine {
         case RendererAPI::API::OpenGL:
             Detail::UseOpenGLCreators();
             break;
+        case RendererAPI::API::Software:
+            Detail::UseSoftwareCreators();
+            break;
+        case RendererAPI::API::Recording:
+            Detail::UseRecordingCreators();
+            break;
         case RendererAPI::API::None:
         default:
             EG_CORE_CHECK(false, "Unsupported Renderer API!");
             break;
         }
 
+        auto& q = Queue();
+        q.InstanceVB = VertexBuffer::Create(RenderQueue::MaxInstances * (uint32_t)sizeof(glm::mat4));
+        BufferLayout instanceLayout = { { ShaderDataType::Mat4, "a_Transform" } };
+        instanceLayout.SetDivisor(1);
+        q.InstanceVB->SetLayout(instanceLayout);
+
         Renderer2D::Init();
     }
 
     void Renderer::Shutdown() {
         EG_PROFILE_FUNCTION();
         Renderer2D::Shutdown();
+
+        auto& q = Queue();
+        q.Packets.clear();
+        q.InstancedMeshes.clear();
+        q.TransformLocations.clear();
+        q.ReportedMismatches.clear();
+        q.InstanceVB.reset();
     }
 
     void Renderer::OnWindowResize(uint32_t width, uint32_t height) {
@@ -39,21 +96,211 @@ namespace Engine {
 
     void Renderer::BeginScene(OrthographicCamera& camera) {
         Scene().ViewProjectionMatrix = camera.GetViewProjectionMatrix();
-    }
-
-    void Renderer::EndScene() {
-        // place for future flush/batch
+        Queue().Packets.clear();
     }
 
     void Renderer::Submit(const Shared<Shader>& shader,
         const Shared<VertexArray>& vertexArray,
         const glm::mat4& transform) {
+        Queue().Packets.push_back({ shader, vertexArray, transform, shader->GetUniforms() });
+        Queue().Stats.Submissions++;
+    }
+
+    // Number of attribute locations a mesh occupies (matrices take one per column).
+    static uint32_t AttributeSlots(const VertexArray& va) {
+        uint32_t slots = 0;
+        for (const auto& vb : va.GetVertexBuffers()) {
+            for (const auto& e : vb->GetLayout()) {
+                if (e.Type == ShaderDataType::Mat3) slots += 3;
+                else if (e.Type == ShaderDataType::Mat4) slots += 4;
+                else slots += 1;
+            }
+        }
+        return slots;
+    }
+
+    // Attribute locations are assigned in stream order, so the instance stream
+    // lands right after the mesh's own attributes (see Renderer::Submit). A
+    // shader that declares `a_Transform` anywhere else cannot be drawn right
+    // either way, so that is reported rather than quietly drawn per packet.
+    static bool CanInstance(const Shader& shader, const VertexArray& mesh) {
+        auto& q = Queue();
+        auto it = q.TransformLocations.find(shader.GetSortID());
+        if (it == q.TransformLocations.end())
+            it = q.TransformLocations.emplace(shader.GetSortID(), shader.GetAttributeLocation("a_Transform")).first;
+        if (it->second < 0) return false;
+
+        const uint32_t slots = AttributeSlots(mesh);
+        if ((uint32_t)it->second == slots) return true;
+        if (q.ReportedMismatches.insert(((uint64_t)shader.GetSortID() << 32) | slots).second) {
+            EG_CORE_ERROR("Shader '{}' declares a_Transform at location {}, but the mesh uses {} attribute slots",
+                shader.GetName(), it->second, slots);
+        }
+        EG_CORE_CHECK(false, "a_Transform must follow the mesh's own attributes");
+        return false;
+    }
+
+    static const Shared<VertexArray>& InstancedMeshFor(const Shared<VertexArray>& mesh) {
+        auto& q = Queue();
+        auto& entry = q.InstancedMeshes[mesh.get()];
+        if (entry.Source.lock() != mesh) {
+            entry.Source = mesh;
+            entry.Instanced = VertexArray::Create();
+            for (const auto& vb : mesh->GetVertexBuffers())
+                entry.Instanced->AddVertexBuffer(vb);
+            entry.Instanced->AddVertexBuffer(q.InstanceVB);
+            entry.Instanced->SetIndexBuffer(mesh->GetIndexBuffer());
+        }
+        return entry.Instanced;
+    }
+
+    static void PruneInstancedMeshes() {
+        auto& meshes = Queue().InstancedMeshes;
+        for (auto it = meshes.begin(); it != meshes.end();) {
+            if (it->second.Source.expired()) it = meshes.erase(it);
+            else ++it;
+        }
+    }
+
+    // Records the values of a packet's uniform block.
+    static void RecordUniforms(CommandList& list, const UniformBlock& block) {
+        for (const auto& [name, v] : block) {
+            switch (v.Type) {
+            case UniformValue::Kind::Int:    list.SetInt(name, v.Ints[0]); break;
+            case UniformValue::Kind::Float:  list.SetFloat(name, v.Data[0].x); break;
+            case UniformValue::Kind::Float4: list.SetFloat4(name, v.Data[0]); break;
+            case UniformValue::Kind::Mat4:   list.SetMat4(name, v.Data); break;
+            default:
+                EG_CORE_ERROR("Uniform '{}' has a type command lists cannot record", name);
+                EG_CORE_CHECK(false, "Unrecordable uniform type");
+                break;
+            }
+        }
+    }
+
+    // Recording variant of EndScene: the instanced path needs GPU-side setup
+    // (mesh/instance-stream vertex arrays), so recorded scenes use plain draws.
+    static void RecordScene(CommandList& list, const glm::mat4& viewProjection) {
+        auto& q = Queue();
+        const Shader* bound = nullptr;
+        const UniformBlock* applied = nullptr;
+        for (const RenderPacket& p : q.Packets) {
+            if (bound != p.Program.get()) {
+                list.BindShader(p.Program);
+                bound = p.Program.get();
+                applied = nullptr;
+            }
+            if (applied != p.Uniforms.get()) {
+                RecordUniforms(list, *p.Uniforms);
+                list.SetMat4("u_ViewProjection", viewProjection);
+                applied = p.Uniforms.get();
+            }
+            list.SetMat4("u_Transform", p.Transform);
+            list.DrawIndexed(p.Mesh);
+            q.Stats.DrawCalls++;
+        }
+        q.Packets.clear();
+    }
+
+    void Renderer::EndScene() {
         EG_PROFILE_FUNCTION();
-        shader->Binding();
-        shader->SetMat4("u_ViewProjection", Scene().ViewProjectionMatrix);
-        shader->SetMat4("u_Transform", transform);
-        vertexArray->Bind();
-        RenderCommand::DrawIndexed(vertexArray);
+        auto& q = Queue();
+        if (q.Packets.empty()) return;
+
+        // Stable: equal keys keep submission order (matters for blending).
+        // Creation IDs rather than addresses, so the order repeats run to run.
+        std::stable_sort(q.Packets.begin(), q.Packets.end(),
+            [](const RenderPacket& a, const RenderPacket& b) {
+                if (a.Program->GetSortID() != b.Program->GetSortID())
+                    return a.Program->GetSortID() < b.Program->GetSortID();
+                return a.Mesh->GetSortID() < b.Mesh->GetSortID();
+            });
+
+        if (auto* rec = CommandList::Recording()) {
+            RecordScene(*rec, Scene().ViewProjectionMatrix);
+            return;
+        }
+
+        // Runs of identical shader+mesh+uniforms. A shader that reads
+        // `a_Transform` always goes through the instance stream, a run of one
+        // included.
+        struct Run { size_t First, Count; uint32_t BaseInstance; bool Instanced; };
+        std::vector<Run> runs;
+        const Shader* bound = nullptr;
+        const UniformBlock* applied = nullptr;
+        for (size_t i = 0; i < q.Packets.size();) {
+            // Gather runs until the instance stream is full, upload once, draw
+            runs.clear();
+            q.InstanceTransforms.clear();
+            while (i < q.Packets.size()) {
+                size_t j = i + 1;
+                while (j < q.Packets.size()
+                    && q.Packets[j].Program == q.Packets[i].Program
+                    && q.Packets[j].Mesh == q.Packets[i].Mesh
+                    && q.Packets[j].Uniforms == q.Packets[i].Uniforms) ++j;
+
+                Run run{ i, j - i, 0, false };
+                if (CanInstance(*q.Packets[i].Program, *q.Packets[i].Mesh)) {
+                    const size_t room = RenderQueue::MaxInstances - q.InstanceTransforms.size();
+                    if (room == 0) break; // the rest of the run starts the next batch
+                    run.Count = std::min(run.Count, room);
+                    run.Instanced = true;
+                    run.BaseInstance = (uint32_t)q.InstanceTransforms.size();
+                    for (size_t k = i; k < i + run.Count; ++k)
+                        q.InstanceTransforms.push_back(q.Packets[k].Transform);
+                }
+                runs.push_back(run);
+                i += run.Count;
+            }
+
+            if (!q.InstanceTransforms.empty()) {
+                q.InstanceVB->SetData(q.InstanceTransforms.data(),
+                    (uint32_t)(q.InstanceTransforms.size() * sizeof(glm::mat4)));
+            }
+
+            for (const Run& run : runs) {
+                const RenderPacket& first = q.Packets[run.First];
+                if (bound != first.Program.get()) {
+                    first.Program->Binding();
+                    bound = first.Program.get();
+                    applied = nullptr;
+                }
+                // Upload, not Set*: the renderer's own values stay out of the
+                // shader's remembered block.
+                if (applied != first.Uniforms.get()) {
+                    first.Program->ApplyUniforms(*first.Uniforms);
+                    first.Program->UploadMat4("u_ViewProjection", Scene().ViewProjectionMatrix);
+                    applied = first.Uniforms.get();
+                }
+
+                if (run.Instanced) {
+                    const auto& mesh = InstancedMeshFor(first.Mesh);
+                    mesh->Bind();
+                    RenderCommand::DrawIndexedInstanced(mesh, (uint32_t)run.Count, run.BaseInstance);
+                    q.Stats.DrawCalls++;
+                    q.Stats.InstancedDraws++;
+                    continue;
+                }
+
+                first.Mesh->Bind();
+                for (size_t k = run.First; k < run.First + run.Count; ++k) {
+                    first.Program->UploadMat4("u_Transform", q.Packets[k].Transform);
+                    RenderCommand::DrawIndexed(first.Mesh);
+                    q.Stats.DrawCalls++;
+                }
+            }
+        }
+
+        q.Packets.clear();
+        PruneInstancedMeshes();
+    }
+
+    const Renderer::Statistics& Renderer::GetStats() {
+        return Queue().Stats;
+    }
+
+    void Renderer::ResetStats() {
+        Queue().Stats = {};
     }
 
 } // namespace Engine
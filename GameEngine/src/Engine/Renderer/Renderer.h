@@ -14,14 +14,32 @@ namespace Engine {
         static void OnWindowResize(uint32_t width, uint32_t height);
 
         static void BeginScene(OrthographicCamera& camera);
+        // Sorts the queued submissions (shader -> mesh) and draws them; runs of
+        // the same mesh and uniforms collapse into one instanced draw when the
+        // shader reads its transform from an `a_Transform` instance attribute.
+        // That attribute must sit right after the mesh's own: its location is
+        // the number of slots the mesh's layouts take (Mat3/Mat4 count 3/4).
+        // A shader that declares it elsewhere is reported, not instanced.
         static void EndScene();
 
+        // Queues a draw; nothing reaches the GPU before EndScene. The shader's
+        // uniforms (Shader::Set*) are captured here, so each draw keeps the
+        // values set before its own Submit. u_ViewProjection and u_Transform
+        // are the renderer's.
         static void Submit(const Shared<Shader>& shader,
             const Shared<VertexArray>& vertexArray,
             const glm::mat4& transform = glm::mat4(1.0f));
 
         static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
 
+        struct Statistics {
+            uint32_t Submissions = 0;
+            uint32_t DrawCalls = 0;
+            uint32_t InstancedDraws = 0; // subset of DrawCalls
+        };
+        static const Statistics& GetStats();
+        static void ResetStats();
+
     private:
         struct SceneData { glm::mat4 ViewProjectionMatrix; };
         static SceneData& Scene(); // lazy local static
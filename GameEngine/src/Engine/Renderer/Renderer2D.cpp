@@ -3,14 +3,39 @@
 #include "VertexArray.h"
 #include "Shader.h"
 #include "RenderCommand.h"
-#include <glm/gtc/matrix_transform.hpp>
+#include "CommandList.h"
+#include <cstring>
+#include <cmath>
 
 namespace Engine {
 
+    using QuadAttribVertex = Renderer2D::QuadAttribVertex;
+
     struct Renderer2DStorage {
-        Shared<VertexArray> QuadVA;
-        Shared<Shader>      TextureShader;
-        Shared<Texture2D>   WhiteTexture;
+        static constexpr uint32_t MaxQuads = 10000;
+        static constexpr uint32_t MaxVertices = MaxQuads * 4;
+        static constexpr uint32_t MaxIndices = MaxQuads * 6;
+        static constexpr uint32_t MaxTextureSlots = 16;
+
+        Shared<VertexArray>  QuadVA;
+        Shared<VertexBuffer> PositionVB;
+        Shared<VertexBuffer> AttribVB;
+        Shared<Shader>       QuadShader;
+        Shared<Texture2D>    WhiteTexture;
+
+        // Current batch (CPU side)
+        std::vector<glm::vec3>        Positions;
+        std::vector<QuadAttribVertex> Attribs;
+        uint32_t QuadCount = 0;
+
+        // Mirror of what AttribVB holds, to upload only changed quads
+        std::vector<QuadAttribVertex> GPUAttribs;
+        uint32_t GPUValidQuads = 0;
+
+        std::array<Shared<Texture2D>, MaxTextureSlots> TextureSlots;
+        uint32_t TextureSlotCount = 1; // slot 0 = white
+
+        Renderer2D::Statistics Stats;
     };
 
     static Renderer2DStorage& Data() {
@@ -23,6 +48,9 @@ namespace Engine {
         return init;
     }
 
+    static const glm::vec2 kQuadUV[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+    static const glm::vec2 kQuadCorner[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+
     void Renderer2D::Init() {
         EG_PROFILE_FUNCTION();
         if (Initialized()) return;
@@ -30,28 +58,41 @@ namespace Engine {
         auto& d = Data();
         d.QuadVA = VertexArray::Create();
 
-        const float verts[5 * 4] = {
-            -0.5f,-0.5f,0.0f, 0.0f,0.0f,
-             0.5f,-0.5f,0.0f, 1.0f,0.0f,
-             0.5f, 0.5f,0.0f, 1.0f,1.0f,
-            -0.5f, 0.5f,0.0f, 0.0f,1.0f
-        };
-        auto vb = VertexBuffer::Create(const_cast<float*>(verts), sizeof(verts));
-        vb->SetLayout({ { ShaderDataType::Float3, "a_Position" },
-                        { ShaderDataType::Float2, "a_TexCoord" } });
-        d.QuadVA->AddVertexBuffer(vb);
+        d.PositionVB = VertexBuffer::Create(Renderer2DStorage::MaxVertices * (uint32_t)sizeof(glm::vec3));
+        d.PositionVB->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+        d.QuadVA->AddVertexBuffer(d.PositionVB);
 
-        uint32_t idx[6] = { 0,1,2, 2,3,0 };
-        auto ib = IndexBuffer::Create(idx, 6);
+        d.AttribVB = VertexBuffer::Create(Renderer2DStorage::MaxVertices * (uint32_t)sizeof(QuadAttribVertex));
+        d.AttribVB->SetLayout({ { ShaderDataType::Float4, "a_Color" },
+                                { ShaderDataType::Float2, "a_TexCoord" },
+                                { ShaderDataType::Float,  "a_TexIndex" },
+                                { ShaderDataType::Float,  "a_TilingFactor" } });
+        d.QuadVA->AddVertexBuffer(d.AttribVB);
+
+        std::vector<uint32_t> idx(Renderer2DStorage::MaxIndices);
+        for (uint32_t i = 0, v = 0; i < Renderer2DStorage::MaxIndices; i += 6, v += 4) {
+            idx[i + 0] = v + 0; idx[i + 1] = v + 1; idx[i + 2] = v + 2;
+            idx[i + 3] = v + 2; idx[i + 4] = v + 3; idx[i + 5] = v + 0;
+        }
+        auto ib = IndexBuffer::Create(idx.data(), Renderer2DStorage::MaxIndices);
         d.QuadVA->SetIndexBuffer(ib);
 
+        d.Positions.resize(Renderer2DStorage::MaxVertices);
+        d.Attribs.resize(Renderer2DStorage::MaxVertices);
+        d.GPUAttribs.resize(Renderer2DStorage::MaxVertices);
+        d.GPUValidQuads = 0;
+
         d.WhiteTexture = Texture2D::Create(1, 1);
         uint32_t white = 0xffffffffu;
         d.WhiteTexture->SetData(&white, sizeof(uint32_t));
+        d.TextureSlots[0] = d.WhiteTexture;
 
-        d.TextureShader = Shader::Create("assets/shaders/Texture.glsl");
-        d.TextureShader->Binding();
-        d.TextureShader->SetInt("u_Texture", 0);
+        int samplers[Renderer2DStorage::MaxTextureSlots];
+        for (int i = 0; i < (int)Renderer2DStorage::MaxTextureSlots; ++i) samplers[i] = i;
+
+        d.QuadShader = Shader::Create("assets/shaders/Quad2D.glsl");
+        d.QuadShader->Binding();
+        d.QuadShader->SetIntArray("u_Textures", samplers, Renderer2DStorage::MaxTextureSlots);
 
         Initialized() = true;
     }
@@ -60,33 +101,157 @@ namespace Engine {
         EG_PROFILE_FUNCTION();
         if (!Initialized()) return;
         auto& d = Data();
-        d.TextureShader.reset();
+        d.QuadShader.reset();
+        d.TextureSlots = {};
         d.WhiteTexture.reset();
         d.QuadVA.reset();
+        d.PositionVB.reset();
+        d.AttribVB.reset();
+        d.Positions = {};
+        d.Attribs = {};
+        d.GPUAttribs = {};
         Initialized() = false;
     }
 
+    static void StartBatch() {
+        auto& d = Data();
+        d.QuadCount = 0;
+        d.TextureSlotCount = 1;
+    }
+
     void Renderer2D::BeginScene(const OrthographicCamera& camera) {
+        BeginScene(camera.GetViewProjectionMatrix());
+    }
+
+    void Renderer2D::BeginScene(const glm::mat4& viewProjection) {
         EG_PROFILE_FUNCTION();
-        Data().TextureShader->Binding();
-        Data().TextureShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        if (auto* rec = CommandList::Recording()) { rec->SetViewProjection(viewProjection); return; }
+        Data().QuadShader->Binding();
+        Data().QuadShader->SetMat4("u_ViewProjection", viewProjection);
+        StartBatch();
     }
 
     void Renderer2D::EndScene() {
         EG_PROFILE_FUNCTION();
+        if (CommandList::Recording()) return; // the replay flushes
+        Flush();
     }
 
-    static void SubmitQuad(const glm::mat4& transform,
-        const Shared<Texture2D>& tex,
-        float tiling,
-        const glm::vec4& tint) {
+    // Uploads quads [first, last) of stream 1 and records them in the mirror.
+    static void UploadAttribs(uint32_t first, uint32_t last) {
         auto& d = Data();
-        d.TextureShader->SetMat4("u_Transform", transform);
-        d.TextureShader->SetFloat4("u_Color", tint);
-        d.TextureShader->SetFloat("u_TilingFactor", tiling);
-        tex->Bind();
+        const uint32_t quadBytes = 4u * (uint32_t)sizeof(QuadAttribVertex);
+        const uint32_t bytes = (last - first) * quadBytes;
+        d.AttribVB->SetData(&d.Attribs[first * 4], bytes, first * quadBytes);
+        std::memcpy(&d.GPUAttribs[first * 4], &d.Attribs[first * 4], bytes);
+        d.Stats.AttributeBytes += bytes;
+    }
+
+    void Renderer2D::Flush() {
+        EG_PROFILE_FUNCTION();
+        auto& d = Data();
+        if (d.QuadCount == 0 || CommandList::Recording()) return;
+
+        const uint32_t vertexCount = d.QuadCount * 4;
+        const uint32_t posBytes = vertexCount * (uint32_t)sizeof(glm::vec3);
+        d.PositionVB->SetData(d.Positions.data(), posBytes);
+        d.Stats.PositionBytes += posBytes;
+
+        // Coalesce runs of changed quads into as few partial uploads as possible
+        const size_t quadBytes = 4 * sizeof(QuadAttribVertex);
+        auto unchanged = [&](uint32_t q) {
+            return q < d.GPUValidQuads
+                && std::memcmp(&d.Attribs[q * 4], &d.GPUAttribs[q * 4], quadBytes) == 0;
+        };
+        for (uint32_t q = 0; q < d.QuadCount;) {
+            if (unchanged(q)) { ++q; continue; }
+            const uint32_t first = q;
+            while (q < d.QuadCount && !unchanged(q)) ++q;
+            UploadAttribs(first, q);
+        }
+        d.GPUValidQuads = std::max(d.GPUValidQuads, d.QuadCount);
+
+        for (uint32_t i = 0; i < d.TextureSlotCount; ++i)
+            d.TextureSlots[i]->Bind(i);
+
+        d.QuadShader->Binding();
         d.QuadVA->Bind();
-        RenderCommand::DrawIndexed(d.QuadVA);
+        RenderCommand::DrawIndexed(d.QuadVA, d.QuadCount * 6);
+        d.Stats.DrawCalls++;
+
+        StartBatch();
+    }
+
+    static float TextureSlotFor(const Shared<Texture2D>& tex) {
+        auto& d = Data();
+        if (!tex || tex.get() == d.WhiteTexture.get()) return 0.0f;
+
+        for (uint32_t i = 1; i < d.TextureSlotCount; ++i)
+            if (d.TextureSlots[i].get() == tex.get()) return (float)i;
+
+        if (d.TextureSlotCount >= Renderer2DStorage::MaxTextureSlots)
+            Renderer2D::Flush();
+
+        d.TextureSlots[d.TextureSlotCount] = tex;
+        return (float)d.TextureSlotCount++;
+    }
+
+    // Writes one quad into the batch. With rotation == 0 the corners are a
+    // plain offset of `pos`, so no matrix is built for the common case.
+    static void SubmitQuad(const glm::vec3& pos, const glm::vec2& size, float rotation,
+        const Shared<Texture2D>& tex, float tiling, const glm::vec4& tint) {
+        auto& d = Data();
+        if (auto* rec = CommandList::Recording()) {
+            if (!tex || tex == d.WhiteTexture) rec->DrawRotatedQuad(pos, size, rotation, tint);
+            else rec->DrawRotatedQuad(pos, size, rotation, tex, tiling, tint);
+            return;
+        }
+
+        if (d.QuadCount >= Renderer2DStorage::MaxQuads)
+            Renderer2D::Flush();
+
+        const float texIndex = TextureSlotFor(tex);
+        const float c = rotation != 0.0f ? std::cos(rotation) : 1.0f;
+        const float s = rotation != 0.0f ? std::sin(rotation) : 0.0f;
+
+        const uint32_t base = d.QuadCount * 4;
+        for (uint32_t i = 0; i < 4; ++i) {
+            const float ox = kQuadCorner[i].x * size.x;
+            const float oy = kQuadCorner[i].y * size.y;
+            d.Positions[base + i] = { pos.x + ox * c - oy * s, pos.y + ox * s + oy * c, pos.z };
+
+            QuadAttribVertex& a = d.Attribs[base + i];
+            a.Color = tint;
+            a.TexCoord = kQuadUV[i];
+            a.TexIndex = texIndex;
+            a.TilingFactor = tiling;
+        }
+
+        d.QuadCount++;
+        d.Stats.QuadCount++;
+    }
+
+    Renderer2D::QuadSpan Renderer2D::MapQuads(uint32_t count) {
+        auto& d = Data();
+        if (auto* rec = CommandList::Recording()) return rec->MapQuads(count);
+        if (count == 0) return {};
+        count = std::min(count, Renderer2DStorage::MaxQuads);
+        if (d.QuadCount + count > Renderer2DStorage::MaxQuads)
+            Flush();
+
+        QuadSpan span;
+        span.Positions = &d.Positions[d.QuadCount * 4];
+        span.Attribs = &d.Attribs[d.QuadCount * 4];
+        span.Count = count;
+        return span;
+    }
+
+    void Renderer2D::CommitQuads(uint32_t count) {
+        if (auto* rec = CommandList::Recording()) { rec->CommitQuads(count); return; }
+        auto& d = Data();
+        EG_CORE_CHECK(d.QuadCount + count <= Renderer2DStorage::MaxQuads, "CommitQuads past the mapped span");
+        d.QuadCount += count;
+        d.Stats.QuadCount += count;
     }
 
     void Renderer2D::DrawQuad(const glm::vec2& pos, const glm::vec2& size, const glm::vec4& color) {
@@ -94,10 +259,7 @@ namespace Engine {
     }
 
     void Renderer2D::DrawQuad(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& color) {
-        EG_PROFILE_FUNCTION();
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos)
-            * glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-        SubmitQuad(transform, Data().WhiteTexture, 1.0f, color);
+        SubmitQuad(pos, size, 0.0f, Data().WhiteTexture, 1.0f, color);
     }
 
     void Renderer2D::DrawQuad(const glm::vec2& pos, const glm::vec2& size,
@@ -107,10 +269,13 @@ namespace Engine {
 
     void Renderer2D::DrawQuad(const glm::vec3& pos, const glm::vec2& size,
         const Shared<Texture2D>& texture, float tiling, const glm::vec4& tint) {
-        EG_PROFILE_FUNCTION();
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos)
-            * glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-        SubmitQuad(transform, texture, tiling, tint);
+        SubmitQuad(pos, size, 0.0f, texture, tiling, tint);
+    }
+
+    void Renderer2D::DrawQuad(const glm::vec3& pos, const glm::vec2& size,
+        const Shared<Framebuffer>& source, float tiling, const glm::vec4& tint) {
+        if (auto* rec = CommandList::Recording()) { rec->DrawQuad(pos, size, source, tiling, tint); return; }
+        SubmitQuad(pos, size, 0.0f, source->GetColorAttachment(), tiling, tint);
     }
 
     void Renderer2D::DrawRotatedQuad(const glm::vec2& pos, const glm::vec2& size,
@@ -120,11 +285,7 @@ namespace Engine {
 
     void Renderer2D::DrawRotatedQuad(const glm::vec3& pos, const glm::vec2& size,
         float r, const glm::vec4& color) {
-        EG_PROFILE_FUNCTION();
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos)
-            * glm::rotate(glm::mat4(1.0f), r, { 0,0,1 })
-            * glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-        SubmitQuad(transform, Data().WhiteTexture, 1.0f, color);
+        SubmitQuad(pos, size, r, Data().WhiteTexture, 1.0f, color);
     }
 
     void Renderer2D::DrawRotatedQuad(const glm::vec2& pos, const glm::vec2& size,
@@ -136,11 +297,15 @@ namespace Engine {
     void Renderer2D::DrawRotatedQuad(const glm::vec3& pos, const glm::vec2& size,
         float r, const Shared<Texture2D>& tex,
         float tiling, const glm::vec4& tint) {
-        EG_PROFILE_FUNCTION();
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos)
-            * glm::rotate(glm::mat4(1.0f), r, { 0,0,1 })
-            * glm::scale(glm::mat4(1.0f), { size.x,size.y,1.0f });
-        SubmitQuad(transform, tex, tiling, tint);
+        SubmitQuad(pos, size, r, tex, tiling, tint);
+    }
+
+    const Renderer2D::Statistics& Renderer2D::GetStats() {
+        return Data().Stats;
+    }
+
+    void Renderer2D::ResetStats() {
+        Data().Stats = {};
     }
 
 } // namespace Engine
@@ -2,17 +2,25 @@
 #include <glm/glm.hpp>
 #include "OrthographicCamera.h"
 #include "Texture.h"
+#include "Framebuffer.h"
 #include "Engine/Core/Core.h"
 
 namespace Engine {
 
+    // Batched quad renderer. Quads are accumulated on the CPU and drawn with
+    // one DrawIndexed per batch from two vertex streams:
+    //  - stream 0: positions, re-uploaded every flush (they move);
+    //  - stream 1: color/UV/texture slot/tiling, uploaded only for the quads
+    //    whose attributes differ from what the GPU buffer already holds.
     class Renderer2D {
     public:
         static void Init();
         static void Shutdown();
 
         static void BeginScene(const OrthographicCamera& camera);
+        static void BeginScene(const glm::mat4& viewProjection);
         static void EndScene();
+        static void Flush();
 
         static void DrawQuad(const glm::vec2& pos, const glm::vec2& size, const glm::vec4& color);
         static void DrawQuad(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& color);
@@ -39,6 +47,47 @@ namespace Engine {
             float rotation, const Shared<Texture2D>& texture,
             float tiling = 1.0f,
             const glm::vec4& tint = glm::vec4(1.0f));
+
+        // Samples the framebuffer's color attachment. While recording the
+        // attachment is looked up at replay, after any recorded resize.
+        static void DrawQuad(const glm::vec3& pos, const glm::vec2& size,
+            const Shared<Framebuffer>& source,
+            float tiling = 1.0f,
+            const glm::vec4& tint = glm::vec4(1.0f));
+
+        // Stream 1 vertex. Layout must match a_Color..a_TilingFactor in Quad2D.glsl.
+        struct QuadAttribVertex {
+            glm::vec4 Color;
+            glm::vec2 TexCoord;
+            float     TexIndex;     // 0 = white
+            float     TilingFactor;
+        };
+
+        // Quads written straight into the open batch: 4 vertices each, in
+        // corner order (-.5,-.5) (.5,-.5) (.5,.5) (-.5,.5) with UVs 0..1.
+        struct QuadSpan {
+            glm::vec3*        Positions = nullptr;
+            QuadAttribVertex* Attribs = nullptr;
+            uint32_t          Count = 0; // quads that may be written
+        };
+
+        // Reserves up to `count` quads of the current batch, flushing first
+        // if it cannot take them; Count is capped at one batch. Finish with
+        // CommitQuads(n), n <= Count. While a CommandList is recording the
+        // span lives in the list (untextured quads only, TexIndex 0).
+        static QuadSpan MapQuads(uint32_t count);
+        static void CommitQuads(uint32_t count);
+
+        struct Statistics {
+            uint32_t DrawCalls = 0;
+            uint32_t QuadCount = 0;
+            uint32_t PositionBytes = 0;  // stream 0 upload
+            uint32_t AttributeBytes = 0; // stream 1 upload (dirty ranges only)
+
+            uint32_t UploadedBytes() const { return PositionBytes + AttributeBytes; }
+        };
+        static const Statistics& GetStats();
+        static void ResetStats();
     };
 
 } // namespace Engine
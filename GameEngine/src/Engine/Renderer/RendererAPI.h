@@ -8,17 +8,35 @@ namespace Engine {
 
     class RendererAPI {
     public:
-        enum class API { None = 0, OpenGL = 1 };
+        enum class API { None = 0, OpenGL = 1, Software = 2, Recording = 3 };
+
+        // Alpha:           SRC_ALPHA, ONE_MINUS_SRC_ALPHA (the default).
+        // AlphaAccumulate: as Alpha for color, ONE, ONE_MINUS_SRC_ALPHA for
+        //                  alpha. Drawing into a target cleared to 0 leaves
+        //                  premultiplied color with correct coverage.
+        // Premultiplied:   ONE, ONE_MINUS_SRC_ALPHA; composites such a target.
+        // Opaque:          blending off (copies, e.g. upscaling a frame).
+        enum class BlendMode { Alpha = 0, AlphaAccumulate = 1, Premultiplied = 2, Opaque = 3 };
         virtual ~RendererAPI() = default;
 
         virtual void Init() = 0;
         virtual void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) = 0;
         virtual void SetClearColor(const glm::vec4& color) = 0;
         virtual void Clear() = 0;
+        virtual void SetBlendMode(BlendMode mode) = 0;
+        // While on, every fragment that passes the depth test also adds 1
+        // (saturating at 255) to the target's 8-bit stencil. Clear resets it.
+        virtual void SetOverdrawCounting(bool enabled) = 0;
 
-        virtual void DrawIndexed(const Shared<VertexArray>& va) = 0;
+        // indexCount = 0 draws the whole index buffer
+        virtual void DrawIndexed(const Shared<VertexArray>& va, uint32_t indexCount = 0) = 0;
+        // Instance streams (divisor > 0) are read starting at element `baseInstance`
+        virtual void DrawIndexedInstanced(const Shared<VertexArray>& va, uint32_t instanceCount,
+            uint32_t baseInstance = 0) = 0;
 
         static API GetAPI() { return s_API; }
+        // Select the backend before Renderer::Init (Software or Recording for headless runs).
+        static void SetAPI(API api) { s_API = api; }
     protected:
         static API s_API;
     };
@@ -5,6 +5,22 @@
 #include "Platforms/OpenGL/OpenGLVertexArray.h"
 #include "Platforms/OpenGL/OpenGLTexture.h"
 #include "Platforms/OpenGL/OpenGLShader.h"
+#include "Platforms/OpenGL/OpenGLFramebuffer.h"
+#include "Platforms/OpenGL/OpenGLFrameReadback.h"
+
+#include "Platforms/Software/SoftwareBuffer.h"
+#include "Platforms/Software/SoftwareVertexArray.h"
+#include "Platforms/Software/SoftwareTexture.h"
+#include "Platforms/Software/SoftwareShader.h"
+#include "Platforms/Software/SoftwareRenderTarget.h"
+#include "Platforms/Software/SoftwareFrameReadback.h"
+
+#include "Platforms/Recording/RecordingBuffer.h"
+#include "Platforms/Recording/RecordingVertexArray.h"
+#include "Platforms/Recording/RecordingTexture.h"
+#include "Platforms/Recording/RecordingShader.h"
+#include "Platforms/Recording/RecordingFramebuffer.h"
+#include "Platforms/Recording/RecordingFrameReadback.h"
 
 namespace Engine::Detail {
 
@@ -19,6 +35,9 @@ namespace Engine::Detail {
     static Shared<VertexBuffer>  GL_CreateVB(float* d, uint32_t s) {
         return MakeShared<OpenGLVertexBuffer>(d, s);
     }
+    static Shared<VertexBuffer>  GL_CreateDynVB(uint32_t s) {
+        return MakeShared<OpenGLVertexBuffer>(s);
+    }
     static Shared<IndexBuffer>   GL_CreateIB(uint32_t* idx, uint32_t cnt) {
         return MakeShared<OpenGLIndexBuffer>(idx, cnt);
     }
@@ -39,16 +58,121 @@ namespace Engine::Detail {
         const std::string& fs) {
         return MakeShared<OpenGLShader>(name, vs, fs);
     }
+    static Shared<Framebuffer>   GL_CreateFB(const FramebufferSpec& spec) {
+        return MakeShared<OpenGLFramebuffer>(spec);
+    }
+    static Shared<FrameReadback> GL_CreateReadback(uint32_t slots) {
+        return MakeShared<OpenGLFrameReadback>(slots);
+    }
 
     void UseOpenGLCreators() {
         auto& c = S();
         c.vb = &GL_CreateVB;
+        c.vbDynamic = &GL_CreateDynVB;
         c.ib = &GL_CreateIB;
         c.va = &GL_CreateVA;
         c.tex = &GL_CreateTex;
         c.texFromFile = &GL_LoadTex;
         c.shaderFromFile = &GL_LoadShader;
         c.shaderFromSrc = &GL_MakeShader;
+        c.framebuffer = &GL_CreateFB;
+        c.readback = &GL_CreateReadback;
+    }
+
+    // ---- Software rasterizer bindings ----
+    static Shared<VertexBuffer>  SW_CreateVB(float* d, uint32_t s) {
+        return MakeShared<SoftwareVertexBuffer>(d, s);
+    }
+    static Shared<VertexBuffer>  SW_CreateDynVB(uint32_t s) {
+        return MakeShared<SoftwareVertexBuffer>(s);
+    }
+    static Shared<IndexBuffer>   SW_CreateIB(uint32_t* idx, uint32_t cnt) {
+        return MakeShared<SoftwareIndexBuffer>(idx, cnt);
+    }
+    static Shared<VertexArray>   SW_CreateVA() {
+        return MakeShared<SoftwareVertexArray>();
+    }
+    static Shared<Texture2D>     SW_CreateTex(uint32_t w, uint32_t h) {
+        return MakeShared<SoftwareTexture2D>(w, h);
+    }
+    static Shared<Texture2D>     SW_LoadTex(const std::string& path) {
+        return MakeShared<SoftwareTexture2D>(path);
+    }
+    static Shared<Shader>        SW_LoadShader(const std::string& path) {
+        return MakeShared<SoftwareShader>(path);
+    }
+    static Shared<Shader>        SW_MakeShader(const std::string& name,
+        const std::string& vs,
+        const std::string& fs) {
+        return MakeShared<SoftwareShader>(name, vs, fs);
+    }
+    static Shared<Framebuffer>   SW_CreateFB(const FramebufferSpec& spec) {
+        return MakeShared<SoftwareRenderTarget>(spec);
+    }
+    static Shared<FrameReadback> SW_CreateReadback(uint32_t slots) {
+        return MakeShared<SoftwareFrameReadback>(slots);
+    }
+
+    void UseSoftwareCreators() {
+        auto& c = S();
+        c.vb = &SW_CreateVB;
+        c.vbDynamic = &SW_CreateDynVB;
+        c.ib = &SW_CreateIB;
+        c.va = &SW_CreateVA;
+        c.tex = &SW_CreateTex;
+        c.texFromFile = &SW_LoadTex;
+        c.shaderFromFile = &SW_LoadShader;
+        c.shaderFromSrc = &SW_MakeShader;
+        c.framebuffer = &SW_CreateFB;
+        c.readback = &SW_CreateReadback;
+    }
+
+    // ---- Recording (null) bindings ----
+    static Shared<VertexBuffer>  REC_CreateVB(float* d, uint32_t s) {
+        return MakeShared<RecordingVertexBuffer>(d, s);
+    }
+    static Shared<VertexBuffer>  REC_CreateDynVB(uint32_t s) {
+        return MakeShared<RecordingVertexBuffer>(s);
+    }
+    static Shared<IndexBuffer>   REC_CreateIB(uint32_t* idx, uint32_t cnt) {
+        return MakeShared<RecordingIndexBuffer>(idx, cnt);
+    }
+    static Shared<VertexArray>   REC_CreateVA() {
+        return MakeShared<RecordingVertexArray>();
+    }
+    static Shared<Texture2D>     REC_CreateTex(uint32_t w, uint32_t h) {
+        return MakeShared<RecordingTexture2D>(w, h);
+    }
+    static Shared<Texture2D>     REC_LoadTex(const std::string& path) {
+        return MakeShared<RecordingTexture2D>(path);
+    }
+    static Shared<Shader>        REC_LoadShader(const std::string& path) {
+        return MakeShared<RecordingShader>(path);
+    }
+    static Shared<Shader>        REC_MakeShader(const std::string& name,
+        const std::string& vs,
+        const std::string& fs) {
+        return MakeShared<RecordingShader>(name, vs, fs);
+    }
+    static Shared<Framebuffer>   REC_CreateFB(const FramebufferSpec& spec) {
+        return MakeShared<RecordingFramebuffer>(spec);
+    }
+    static Shared<FrameReadback> REC_CreateReadback(uint32_t slots) {
+        return MakeShared<RecordingFrameReadback>(slots);
+    }
+
+    void UseRecordingCreators() {
+        auto& c = S();
+        c.vb = &REC_CreateVB;
+        c.vbDynamic = &REC_CreateDynVB;
+        c.ib = &REC_CreateIB;
+        c.va = &REC_CreateVA;
+        c.tex = &REC_CreateTex;
+        c.texFromFile = &REC_LoadTex;
+        c.shaderFromFile = &REC_LoadShader;
+        c.shaderFromSrc = &REC_MakeShader;
+        c.framebuffer = &REC_CreateFB;
+        c.readback = &REC_CreateReadback;
     }
 
 } // namespace Engine::Detail
@@ -9,11 +9,15 @@ namespace Engine {
     class VertexArray;
     class Texture2D;
     class Shader;
+    class Framebuffer;
+    struct FramebufferSpec;
+    class FrameReadback;
 }
 
 namespace Engine::Detail {
 
     using CreateVB = Shared<::Engine::VertexBuffer>(*)(float* data, uint32_t size);
+    using CreateDynVB = Shared<::Engine::VertexBuffer>(*)(uint32_t size);
     using CreateIB = Shared<::Engine::IndexBuffer>(*)(uint32_t* indices, uint32_t count);
     using CreateVA = Shared<::Engine::VertexArray>(*)(void);
     using CreateTex = Shared<::Engine::Texture2D>(*)(uint32_t w, uint32_t h);
@@ -22,19 +26,26 @@ namespace Engine::Detail {
     using MakeShader = Shared<::Engine::Shader>(*)(const std::string& name,
         const std::string& vs,
         const std::string& fs);
+    using CreateFB = Shared<::Engine::Framebuffer>(*)(const ::Engine::FramebufferSpec& spec);
+    using CreateReadback = Shared<::Engine::FrameReadback>(*)(uint32_t slots);
 
     struct Creators {
         CreateVB   vb = nullptr;
+        CreateDynVB vbDynamic = nullptr;
         CreateIB   ib = nullptr;
         CreateVA   va = nullptr;
         CreateTex  tex = nullptr;
         LoadTex    texFromFile = nullptr;
         LoadShader shaderFromFile = nullptr;
         MakeShader shaderFromSrc = nullptr;
+        CreateFB   framebuffer = nullptr;
+        CreateReadback readback = nullptr;
     };
 
     Creators& GetCreators();
 
     void UseOpenGLCreators();
+    void UseSoftwareCreators();
+    void UseRecordingCreators();
 
 } // namespace Engine::Detail
@@ -1,40 +1,112 @@
 #include "enginepch.h"
 #include "Engine/Renderer/Shader.h"
-#include "Engine/Renderer/Renderer.h"
-#include "Platforms/OpenGL/OpenGLShader.h"
+#include "Engine/Renderer/RendererBackend.h"
+#include <atomic>
+#include <fstream>
+#include <regex>
 
 namespace Engine {
 
-    Shared<Shader> Shader::Create(const std::string& filepath)
+    uint32_t Shader::NextSortID()
+    {
+        static std::atomic<uint32_t> next{ 0 };
+        return next++;
+    }
+
+    UniformValue& Shader::Remember(const std::string& name, UniformValue::Kind type)
+    {
+        // Copy on write: a queued draw may still hold the current block
+        if (m_Uniforms.use_count() > 1) m_Uniforms = std::make_shared<UniformBlock>(*m_Uniforms);
+        UniformValue& v = (*m_Uniforms)[name];
+        v.Type = type;
+        return v;
+    }
+
+    void Shader::SetInt(const std::string& name, int value)
+    {
+        Remember(name, UniformValue::Kind::Int).Ints.assign(1, value);
+        UploadInt(name, value);
+    }
+
+    void Shader::SetIntArray(const std::string& name, const int* values, uint32_t count)
+    {
+        Remember(name, UniformValue::Kind::IntArray).Ints.assign(values, values + count);
+        UploadIntArray(name, values, count);
+    }
+
+    void Shader::SetFloat(const std::string& name, float value)
+    {
+        Remember(name, UniformValue::Kind::Float).Data[0].x = value;
+        UploadFloat(name, value);
+    }
+
+    void Shader::SetFloat3(const std::string& name, const glm::vec3& value)
+    {
+        Remember(name, UniformValue::Kind::Float3).Data[0] = glm::vec4(value, 0.0f);
+        UploadFloat3(name, value);
+    }
+
+    void Shader::SetFloat4(const std::string& name, const glm::vec4& value)
     {
-        switch (Renderer::GetAPI())
-        {
-        case RendererAPI::API::None:
-            EG_CORE_CHECK(false, "RendererAPI::None is not supported!");
-            return nullptr;
-        case RendererAPI::API::OpenGL:
-            return MakeShared<OpenGLShader>(filepath);
-        default:
-            EG_CORE_CHECK(false, "Unknown RendererAPI!");
-            return nullptr;
+        Remember(name, UniformValue::Kind::Float4).Data[0] = value;
+        UploadFloat4(name, value);
+    }
+
+    void Shader::SetMat4(const std::string& name, const glm::mat4& value)
+    {
+        Remember(name, UniformValue::Kind::Mat4).Data = value;
+        UploadMat4(name, value);
+    }
+
+    void Shader::ApplyUniforms(const UniformBlock& block)
+    {
+        for (const auto& [name, v] : block) {
+            switch (v.Type) {
+            case UniformValue::Kind::Int:      UploadInt(name, v.Ints[0]); break;
+            case UniformValue::Kind::IntArray: UploadIntArray(name, v.Ints.data(), (uint32_t)v.Ints.size()); break;
+            case UniformValue::Kind::Float:    UploadFloat(name, v.Data[0].x); break;
+            case UniformValue::Kind::Float3:   UploadFloat3(name, glm::vec3(v.Data[0])); break;
+            case UniformValue::Kind::Float4:   UploadFloat4(name, v.Data[0]); break;
+            case UniformValue::Kind::Mat4:     UploadMat4(name, v.Data); break;
+            }
         }
     }
 
+    Shared<Shader> Shader::Create(const std::string& filepath)
+    {
+        auto fn = Detail::GetCreators().shaderFromFile;
+        EG_CORE_CHECK(fn, "Shader (file) creator not bound!");
+        return fn(filepath);
+    }
+
     Shared<Shader> Shader::Create(const std::string& name,
         const std::string& vertexSrc,
         const std::string& fragmentSrc)
     {
-        switch (Renderer::GetAPI())
-        {
-        case RendererAPI::API::None:
-            EG_CORE_CHECK(false, "RendererAPI::None is not supported!");
-            return nullptr;
-        case RendererAPI::API::OpenGL:
-            return MakeShared<OpenGLShader>(name, vertexSrc, fragmentSrc);
-        default:
-            EG_CORE_CHECK(false, "Unknown RendererAPI!");
-            return nullptr;
-        }
+        auto fn = Detail::GetCreators().shaderFromSrc;
+        EG_CORE_CHECK(fn, "Shader (source) creator not bound!");
+        return fn(name, vertexSrc, fragmentSrc);
+    }
+
+    std::string Shader::ReadVertexStage(const std::string& filepath)
+    {
+        std::ifstream in(filepath, std::ios::binary);
+        EG_CORE_CHECK(in.good(), "Cannot open shader");
+        const std::string src((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        const size_t vs = src.find("#type vertex");
+        if (vs == std::string::npos) return src;
+        const size_t next = src.find("#type", vs + 1);
+        return src.substr(vs, next == std::string::npos ? std::string::npos : next - vs);
+    }
+
+    std::unordered_map<std::string, int> Shader::ParseVertexInputs(const std::string& vertexSrc)
+    {
+        static const std::regex decl(R"(layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*in\s+\w+\s+(\w+))");
+        std::unordered_map<std::string, int> inputs;
+        for (auto it = std::sregex_iterator(vertexSrc.begin(), vertexSrc.end(), decl); it != std::sregex_iterator(); ++it)
+            inputs[(*it)[2].str()] = std::stoi((*it)[1].str());
+        return inputs;
     }
 
     void ShaderLibrary::Add(const std::string& name, const Shared<Shader>& shader)
@@ -1,11 +1,21 @@
 #pragma once
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 #include "Engine/Core/Core.h"
 
 namespace Engine {
 
+    // A uniform as last set through Shader::Set*.
+    struct UniformValue {
+        enum class Kind : uint8_t { Int, IntArray, Float, Float3, Float4, Mat4 };
+        Kind             Type = Kind::Int;
+        glm::mat4        Data{ 0.0f }; // Float..Mat4, read from Data[0] on
+        std::vector<int> Ints;         // Int, IntArray
+    };
+    using UniformBlock = std::unordered_map<std::string, UniformValue>;
+
     class Shader {
     public:
         virtual ~Shader() = default;
@@ -13,18 +23,59 @@ namespace Engine {
         virtual void Binding() const = 0;
         virtual void Unbinding() const = 0;
 
-        virtual void SetInt(const std::string& name, int value) = 0;
-        virtual void SetFloat(const std::string& name, float value) = 0;
-        virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
-        virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
-        virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
+        // Upload to the bound program and remember the value (see GetUniforms).
+        void SetInt(const std::string& name, int value);
+        void SetIntArray(const std::string& name, const int* values, uint32_t count);
+        void SetFloat(const std::string& name, float value);
+        void SetFloat3(const std::string& name, const glm::vec3& value);
+        void SetFloat4(const std::string& name, const glm::vec4& value);
+        void SetMat4(const std::string& name, const glm::mat4& value);
+
+        // Every value set so far. The block is shared, not copied: a Set* made
+        // while someone holds it (a queued Renderer::Submit) works on a copy,
+        // so the holder keeps the values it saw.
+        Shared<const UniformBlock> GetUniforms() const { return m_Uniforms; }
+        // Uploads `block` to the bound program without remembering it.
+        void ApplyUniforms(const UniformBlock& block);
 
         virtual const std::string& GetName() const = 0;
 
+        // Location of a vertex input, -1 if the shader does not declare it.
+        virtual int GetAttributeLocation(const std::string& name) const = 0;
+
+        // Creation order, never reused: a draw-sort key that is the same on
+        // every run (addresses are not).
+        uint32_t GetSortID() const { return m_SortID; }
+
         static Shared<Shader> Create(const std::string& filepath);
         static Shared<Shader> Create(const std::string& name,
             const std::string& vertexSrc,
             const std::string& fragmentSrc);
+
+    protected:
+        // What the Set* calls reach; replayed command lists and the renderer's
+        // own per-draw uniforms come through here directly.
+        friend class CommandList;
+        friend class Renderer;
+        virtual void UploadInt(const std::string& name, int value) = 0;
+        virtual void UploadIntArray(const std::string& name, const int* values, uint32_t count) = 0;
+        virtual void UploadFloat(const std::string& name, float value) = 0;
+        virtual void UploadFloat3(const std::string& name, const glm::vec3& value) = 0;
+        virtual void UploadFloat4(const std::string& name, const glm::vec4& value) = 0;
+        virtual void UploadMat4(const std::string& name, const glm::mat4& value) = 0;
+
+        // Source reflection for backends that do not compile GLSL.
+        // The "#type vertex" section of a combined shader file (whole file if untagged).
+        static std::string ReadVertexStage(const std::string& filepath);
+        // `layout(location = N) in <type> <name>` declarations -> name to N.
+        static std::unordered_map<std::string, int> ParseVertexInputs(const std::string& vertexSrc);
+
+    private:
+        UniformValue& Remember(const std::string& name, UniformValue::Kind type);
+
+        static uint32_t NextSortID();
+        const uint32_t m_SortID = NextSortID();
+        Shared<UniformBlock> m_Uniforms = std::make_shared<UniformBlock>();
     };
 
     class ShaderLibrary {
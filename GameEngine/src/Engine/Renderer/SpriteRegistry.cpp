@@ -0,0 +1,203 @@
+#include "enginepch.h"
+#include "SpriteRegistry.h"
+#include "RenderCommand.h"
+#include "CommandList.h"
+
+namespace Engine {
+
+    static const glm::vec2 kCorner[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+    static const glm::vec2 kUV[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+    SpriteRegistry::SpriteRegistry(uint32_t capacity, Shared<Shader> shader)
+        : m_Capacity(capacity), m_Positions((size_t)capacity * 4), m_Attribs((size_t)capacity * 4),
+          m_Shader(std::move(shader)) {
+        EG_PROFILE_FUNCTION();
+        m_Slots.reserve(capacity);
+
+        if (!m_Shader) m_Shader = Shader::Create("assets/shaders/Quad2D.glsl");
+        int samplers[MaxTextures];
+        for (int i = 0; i < (int)MaxTextures; ++i) samplers[i] = i;
+        m_Shader->Binding();
+        m_Shader->SetIntArray("u_Textures", samplers, MaxTextures);
+
+        auto white = Texture2D::Create(1, 1);
+        uint32_t texel = 0xffffffffu;
+        white->SetData(&texel, sizeof(texel));
+        m_Textures.push_back(white);
+
+        m_VA = VertexArray::Create();
+        m_PositionVB = VertexBuffer::Create(capacity * 4 * (uint32_t)sizeof(glm::vec3));
+        m_PositionVB->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+        m_VA->AddVertexBuffer(m_PositionVB);
+        m_AttribVB = VertexBuffer::Create(capacity * 4 * (uint32_t)sizeof(QuadAttrib));
+        m_AttribVB->SetLayout({ { ShaderDataType::Float4, "a_Color" },
+                                { ShaderDataType::Float2, "a_TexCoord" },
+                                { ShaderDataType::Float,  "a_TexIndex" },
+                                { ShaderDataType::Float,  "a_TilingFactor" } });
+        m_VA->AddVertexBuffer(m_AttribVB);
+
+        std::vector<uint32_t> idx((size_t)capacity * 6);
+        for (uint32_t i = 0, v = 0; i < (uint32_t)idx.size(); i += 6, v += 4) {
+            idx[i + 0] = v + 0; idx[i + 1] = v + 1; idx[i + 2] = v + 2;
+            idx[i + 3] = v + 2; idx[i + 4] = v + 3; idx[i + 5] = v + 0;
+        }
+        m_VA->SetIndexBuffer(IndexBuffer::Create(idx.data(), (uint32_t)idx.size()));
+    }
+
+    SpriteHandle SpriteRegistry::CreateSprite(const SpriteDesc& desc) {
+        uint32_t index;
+        if (!m_FreeSlots.empty()) {
+            index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else {
+            EG_CORE_CHECK(m_Slots.size() < m_Capacity, "SpriteRegistry is full");
+            if (m_Slots.size() >= m_Capacity) return {};
+            index = (uint32_t)m_Slots.size();
+            m_Slots.emplace_back();
+        }
+
+        Slot& slot = m_Slots[index];
+        slot.Desc = desc;
+        slot.Alive = true;
+        m_Alive++;
+        m_HighWater = std::max(m_HighWater, index + 1);
+        MarkDirty(index);
+        return { index, slot.Generation };
+    }
+
+    void SpriteRegistry::UpdateSprite(SpriteHandle handle, const SpriteDesc& desc) {
+        if (!IsAlive(handle)) return;
+        m_Slots[handle.Index].Desc = desc;
+        MarkDirty(handle.Index);
+    }
+
+    void SpriteRegistry::DestroySprite(SpriteHandle handle) {
+        if (!IsAlive(handle)) return;
+        Slot& slot = m_Slots[handle.Index];
+        slot.Alive = false;
+        slot.Desc = {};
+        slot.Generation++;
+        m_Alive--;
+        m_FreeSlots.push_back(handle.Index);
+        MarkDirty(handle.Index); // collapses the quad
+
+        // Trailing dead slots need not be drawn at all
+        while (m_HighWater > 0 && !m_Slots[m_HighWater - 1].Alive) m_HighWater--;
+    }
+
+    bool SpriteRegistry::IsAlive(SpriteHandle handle) const {
+        return handle.Index < m_Slots.size()
+            && m_Slots[handle.Index].Alive
+            && m_Slots[handle.Index].Generation == handle.Generation;
+    }
+
+    const SpriteDesc& SpriteRegistry::GetSprite(SpriteHandle handle) const {
+        EG_CORE_CHECK(IsAlive(handle), "Stale sprite handle");
+        return m_Slots[handle.Index].Desc;
+    }
+
+    void SpriteRegistry::MarkDirty(uint32_t index) {
+        Slot& slot = m_Slots[index];
+        if (slot.Queued) return;
+        slot.Queued = true;
+        m_Dirty.push_back(index);
+    }
+
+    float SpriteRegistry::TextureSlotFor(const Shared<Texture2D>& texture) {
+        if (!texture) return 0.0f;
+        for (uint32_t i = 1; i < (uint32_t)m_Textures.size(); ++i)
+            if (m_Textures[i].get() == texture.get()) return (float)i;
+
+        EG_CORE_CHECK(m_Textures.size() < MaxTextures, "SpriteRegistry texture palette is full");
+        if (m_Textures.size() >= MaxTextures) return 0.0f;
+        m_Textures.push_back(texture);
+        return (float)(m_Textures.size() - 1);
+    }
+
+    // Same corner math as Renderer2D's SubmitQuad.
+    void SpriteRegistry::WriteQuad(uint32_t index) {
+        const Slot& slot = m_Slots[index];
+        const SpriteDesc& s = slot.Desc;
+        const uint32_t base = index * 4;
+
+        if (!slot.Alive) {
+            for (uint32_t i = 0; i < 4; ++i) {
+                m_Positions[base + i] = glm::vec3(0.0f);
+                m_Attribs[base + i] = { glm::vec4(0.0f), kUV[i], 0.0f, 1.0f };
+            }
+            return;
+        }
+
+        const float texIndex = TextureSlotFor(s.Texture);
+        const float c = s.Rotation != 0.0f ? std::cos(s.Rotation) : 1.0f;
+        const float sn = s.Rotation != 0.0f ? std::sin(s.Rotation) : 0.0f;
+        for (uint32_t i = 0; i < 4; ++i) {
+            const float ox = kCorner[i].x * s.Size.x;
+            const float oy = kCorner[i].y * s.Size.y;
+            m_Positions[base + i] = { s.Position.x + ox * c - oy * sn, s.Position.y + ox * sn + oy * c, s.Position.z };
+            m_Attribs[base + i] = { s.Color, kUV[i], texIndex, s.Tiling };
+        }
+    }
+
+    // Rebuilds the queued quads and uploads them as runs of adjacent slots.
+    void SpriteRegistry::UploadDirty() {
+        EG_PROFILE_FUNCTION();
+        if (m_Dirty.empty()) return;
+
+        std::sort(m_Dirty.begin(), m_Dirty.end());
+        for (uint32_t index : m_Dirty) {
+            m_Slots[index].Queued = false;
+            WriteQuad(index);
+        }
+
+        CommandList* rec = CommandList::Recording();
+        for (size_t i = 0; i < m_Dirty.size();) {
+            const uint32_t first = m_Dirty[i];
+            uint32_t last = first + 1;
+            while (++i < m_Dirty.size() && m_Dirty[i] == last) ++last;
+
+            const uint32_t posBytes = (last - first) * 4 * (uint32_t)sizeof(glm::vec3);
+            const uint32_t posOffset = first * 4 * (uint32_t)sizeof(glm::vec3);
+            const uint32_t attribBytes = (last - first) * 4 * (uint32_t)sizeof(QuadAttrib);
+            const uint32_t attribOffset = first * 4 * (uint32_t)sizeof(QuadAttrib);
+            if (rec) {
+                rec->UploadVertices(m_PositionVB, &m_Positions[first * 4], posBytes, posOffset);
+                rec->UploadVertices(m_AttribVB, &m_Attribs[first * 4], attribBytes, attribOffset);
+            }
+            else {
+                m_PositionVB->SetData(&m_Positions[first * 4], posBytes, posOffset);
+                m_AttribVB->SetData(&m_Attribs[first * 4], attribBytes, attribOffset);
+            }
+            m_Stats.UploadRanges++;
+            m_Stats.UploadedBytes += posBytes + attribBytes;
+        }
+        m_Dirty.clear();
+    }
+
+    void SpriteRegistry::Draw(const OrthographicCamera& camera) {
+        Draw(camera.GetViewProjectionMatrix());
+    }
+
+    void SpriteRegistry::Draw(const glm::mat4& viewProjection) {
+        EG_PROFILE_FUNCTION();
+        UploadDirty();
+        if (m_Alive == 0) return;
+
+        CommandList* rec = CommandList::Recording();
+        if (rec) {
+            rec->BindShader(m_Shader);
+            rec->SetMat4("u_ViewProjection", viewProjection);
+            for (uint32_t i = 0; i < (uint32_t)m_Textures.size(); ++i) rec->BindTexture(m_Textures[i], i);
+        }
+        else {
+            m_Shader->Binding();
+            m_Shader->SetMat4("u_ViewProjection", viewProjection);
+            for (uint32_t i = 0; i < (uint32_t)m_Textures.size(); ++i) m_Textures[i]->Bind(i);
+            m_VA->Bind();
+        }
+        RenderCommand::DrawIndexed(m_VA, m_HighWater * 6);
+        m_Stats.DrawCalls++;
+    }
+
+} // namespace Engine
@@ -0,0 +1,99 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Core/Core.h"
+#include "OrthographicCamera.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "VertexArray.h"
+
+namespace Engine {
+
+    struct SpriteDesc {
+        glm::vec3 Position{ 0.0f };
+        glm::vec2 Size{ 1.0f };
+        float     Rotation = 0.0f; // radians
+        glm::vec4 Color{ 1.0f };
+        Shared<Texture2D> Texture;  // null = white
+        float     Tiling = 1.0f;
+    };
+
+    // Stays valid until the sprite is destroyed; stale handles are ignored.
+    struct SpriteHandle {
+        uint32_t Index = UINT32_MAX;
+        uint32_t Generation = 0;
+    };
+
+    // Retained counterpart of Renderer2D's immediate quads. Sprites live in a
+    // persistent GPU buffer (same two-stream Quad2D layout); Create/Update
+    // only touch the CPU copy and queue the quad, and Draw uploads the
+    // queued quads in coalesced ranges before drawing everything with one
+    // call. A frame in which nothing changed uploads nothing.
+    class SpriteRegistry {
+    public:
+        static constexpr uint32_t MaxTextures = 16; // slot 0 is white
+
+        // `shader` must use the Quad2D vertex layout; defaults to Quad2D.glsl.
+        explicit SpriteRegistry(uint32_t capacity = 10000, Shared<Shader> shader = nullptr);
+
+        SpriteHandle CreateSprite(const SpriteDesc& desc);
+        void UpdateSprite(SpriteHandle handle, const SpriteDesc& desc);
+        void DestroySprite(SpriteHandle handle);
+
+        bool IsAlive(SpriteHandle handle) const;
+        const SpriteDesc& GetSprite(SpriteHandle handle) const;
+        uint32_t Count() const { return m_Alive; }
+
+        // Call outside a Renderer2D scene or after its Flush.
+        void Draw(const OrthographicCamera& camera);
+        void Draw(const glm::mat4& viewProjection);
+
+        struct Statistics {
+            uint32_t DrawCalls = 0;
+            uint32_t UploadRanges = 0;
+            uint64_t UploadedBytes = 0;
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats = {}; }
+
+    private:
+        struct QuadAttrib {
+            glm::vec4 Color;
+            glm::vec2 TexCoord;
+            float     TexIndex;
+            float     TilingFactor;
+        };
+
+        struct Slot {
+            SpriteDesc Desc;
+            uint32_t   Generation = 0;
+            bool       Alive = false;
+            bool       Queued = false; // in m_Dirty
+        };
+
+        void WriteQuad(uint32_t index);
+        void MarkDirty(uint32_t index);
+        void UploadDirty();
+        float TextureSlotFor(const Shared<Texture2D>& texture);
+
+        uint32_t m_Capacity;
+        std::vector<Slot>     m_Slots;
+        std::vector<uint32_t> m_FreeSlots;
+        std::vector<uint32_t> m_Dirty;
+        uint32_t m_HighWater = 0; // slots [0, m_HighWater) are drawn
+        uint32_t m_Alive = 0;
+
+        // CPU mirror of the GPU streams
+        std::vector<glm::vec3>  m_Positions;
+        std::vector<QuadAttrib> m_Attribs;
+
+        Shared<VertexArray>  m_VA;
+        Shared<VertexBuffer> m_PositionVB;
+        Shared<VertexBuffer> m_AttribVB;
+        Shared<Shader>       m_Shader;
+        std::vector<Shared<Texture2D>> m_Textures;
+
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
@@ -0,0 +1,267 @@
+#include "enginepch.h"
+#include "Tilemap.h"
+#include "RenderCommand.h"
+#include "CommandList.h"
+
+namespace Engine {
+
+    // Stream 1 vertex, same layout as Renderer2D's (a_Color..a_TilingFactor)
+    struct TileAttribVertex {
+        glm::vec4 Color;
+        glm::vec2 TexCoord;
+        float     TexIndex;
+        float     TilingFactor;
+    };
+
+    static constexpr uint32_t kQuadsPerChunk = Tilemap::ChunkSize * Tilemap::ChunkSize;
+
+    // Default shader and palette entry 0, shared by every live map. Weak, so
+    // they go with the last map rather than outliving the renderer backend.
+    static Shared<Shader> DefaultShader() {
+        static std::weak_ptr<Shader> cache;
+        Shared<Shader> shader = cache.lock();
+        if (!shader) {
+            shader = Shader::Create("assets/shaders/Quad2D.glsl");
+            cache = shader;
+        }
+        return shader;
+    }
+
+    static Shared<Texture2D> WhiteTexture() {
+        static std::weak_ptr<Texture2D> cache;
+        Shared<Texture2D> white = cache.lock();
+        if (!white) {
+            white = Texture2D::Create(1, 1);
+            uint32_t texel = 0xffffffffu;
+            white->SetData(&texel, sizeof(texel));
+            cache = white;
+        }
+        return white;
+    }
+
+    Tilemap::Tilemap(uint32_t width, uint32_t height, const glm::vec2& tileSize,
+        const glm::vec3& origin, Shared<Shader> shader)
+        : m_Width(width), m_Height(height),
+          m_ChunksX((width + ChunkSize - 1) / ChunkSize),
+          m_ChunksY((height + ChunkSize - 1) / ChunkSize),
+          m_TileSize(tileSize), m_Origin(origin),
+          m_Tiles((size_t)width * height), m_Chunks((size_t)m_ChunksX * m_ChunksY),
+          m_Shader(std::move(shader)) {
+        EG_PROFILE_FUNCTION();
+        EG_CORE_CHECK(!CommandList::Recording(), "Create a Tilemap outside a recorded frame");
+
+        if (!m_Shader) m_Shader = DefaultShader();
+        int samplers[MaxTextures];
+        for (int i = 0; i < (int)MaxTextures; ++i) samplers[i] = i;
+        m_Shader->Binding();
+        m_Shader->SetIntArray("u_Textures", samplers, MaxTextures);
+
+        m_Textures.push_back(WhiteTexture());
+
+        std::vector<uint32_t> idx(kQuadsPerChunk * 6);
+        for (uint32_t i = 0, v = 0; i < (uint32_t)idx.size(); i += 6, v += 4) {
+            idx[i + 0] = v + 0; idx[i + 1] = v + 1; idx[i + 2] = v + 2;
+            idx[i + 3] = v + 2; idx[i + 4] = v + 3; idx[i + 5] = v + 0;
+        }
+        m_IndexBuffer = IndexBuffer::Create(idx.data(), (uint32_t)idx.size());
+    }
+
+    void Tilemap::Reserve(uint32_t chunks) {
+        EG_CORE_CHECK(!CommandList::Recording(), "Reserve tilemap chunks outside a recorded frame");
+        chunks = std::min(chunks, (uint32_t)m_Chunks.size());
+        while (m_Pool.size() < chunks) CreateBuffers();
+    }
+
+    void Tilemap::CreateBuffers() {
+        ChunkBuffers b;
+        b.VA = VertexArray::Create();
+        b.PositionVB = VertexBuffer::Create(kQuadsPerChunk * 4 * (uint32_t)sizeof(glm::vec3));
+        b.PositionVB->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+        b.VA->AddVertexBuffer(b.PositionVB);
+        b.AttribVB = VertexBuffer::Create(kQuadsPerChunk * 4 * (uint32_t)sizeof(TileAttribVertex));
+        b.AttribVB->SetLayout({ { ShaderDataType::Float4, "a_Color" },
+                                { ShaderDataType::Float2, "a_TexCoord" },
+                                { ShaderDataType::Float,  "a_TexIndex" },
+                                { ShaderDataType::Float,  "a_TilingFactor" } });
+        b.VA->AddVertexBuffer(b.AttribVB);
+        b.VA->SetIndexBuffer(m_IndexBuffer);
+        m_Pool.push_back(std::move(b));
+    }
+
+    // A free slot, else a new one, else (while recording) the slot of the
+    // chunk drawn least recently, as long as this Draw does not show it.
+    uint32_t Tilemap::AcquireBuffers(uint32_t chunk) {
+        uint32_t slot = NoChunk;
+        for (uint32_t i = 0; i < (uint32_t)m_Pool.size() && slot == NoChunk; ++i)
+            if (m_Pool[i].Owner == NoChunk) slot = i;
+
+        if (slot == NoChunk && !CommandList::Recording()) {
+            CreateBuffers();
+            slot = (uint32_t)m_Pool.size() - 1;
+        }
+
+        if (slot == NoChunk) {
+            uint32_t oldest = m_DrawIndex;
+            for (uint32_t i = 0; i < (uint32_t)m_Pool.size(); ++i) {
+                const Chunk& owner = m_Chunks[m_Pool[i].Owner];
+                if (owner.LastDrawn < oldest) { oldest = owner.LastDrawn; slot = i; }
+            }
+            if (slot == NoChunk) return NoChunk;
+            Chunk& evicted = m_Chunks[m_Pool[slot].Owner];
+            ReleaseBuffers(evicted);
+            evicted.Dirty = true;
+            m_Stats.EvictedChunks++;
+        }
+
+        m_Pool[slot].Owner = chunk;
+        m_Chunks[chunk].Buffers = slot;
+        return slot;
+    }
+
+    void Tilemap::ReleaseBuffers(Chunk& chunk) {
+        if (chunk.Buffers == NoChunk) return;
+        m_Pool[chunk.Buffers].Owner = NoChunk;
+        chunk.Buffers = NoChunk;
+        chunk.IndexCount = 0;
+    }
+
+    uint32_t Tilemap::AddTexture(const Shared<Texture2D>& texture) {
+        EG_CORE_CHECK(m_Textures.size() < MaxTextures, "Tilemap texture palette is full");
+        if (m_Textures.size() >= MaxTextures) return 0;
+        m_Textures.push_back(texture);
+        return (uint32_t)m_Textures.size() - 1;
+    }
+
+    void Tilemap::SetTile(uint32_t x, uint32_t y, const Tile& tile) {
+        EG_CORE_CHECK(x < m_Width && y < m_Height, "Tile out of range");
+        if (x >= m_Width || y >= m_Height) return;
+        m_Tiles[y * m_Width + x] = tile;
+        m_Chunks[(y / ChunkSize) * m_ChunksX + x / ChunkSize].Dirty = true;
+    }
+
+    void Tilemap::Fill(const Tile& tile) {
+        std::fill(m_Tiles.begin(), m_Tiles.end(), tile);
+        for (auto& c : m_Chunks) c.Dirty = true;
+    }
+
+    void Tilemap::RebuildChunk(uint32_t cx, uint32_t cy) {
+        EG_PROFILE_FUNCTION();
+        const uint32_t index = cy * m_ChunksX + cx;
+        Chunk& chunk = m_Chunks[index];
+
+        static const glm::vec2 kCorner[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        std::vector<glm::vec3> positions;
+        std::vector<TileAttribVertex> attribs;
+        positions.reserve(kQuadsPerChunk * 4);
+        attribs.reserve(kQuadsPerChunk * 4);
+
+        const uint32_t x1 = std::min((cx + 1) * ChunkSize, m_Width);
+        const uint32_t y1 = std::min((cy + 1) * ChunkSize, m_Height);
+        for (uint32_t y = cy * ChunkSize; y < y1; ++y) {
+            for (uint32_t x = cx * ChunkSize; x < x1; ++x) {
+                const Tile& t = m_Tiles[y * m_Width + x];
+                if (t.Color.a <= 0.0f) continue;
+                const float texIndex = (float)(t.Texture < m_Textures.size() ? t.Texture : 0);
+                for (const glm::vec2& c : kCorner) {
+                    positions.push_back({ m_Origin.x + ((float)x + c.x) * m_TileSize.x,
+                                          m_Origin.y + ((float)y + c.y) * m_TileSize.y, m_Origin.z });
+                    attribs.push_back({ t.Color, c, texIndex, t.Tiling });
+                }
+            }
+        }
+
+        const uint32_t posBytes = (uint32_t)(positions.size() * sizeof(glm::vec3));
+        const uint32_t attribBytes = (uint32_t)(attribs.size() * sizeof(TileAttribVertex));
+        if (posBytes == 0) {
+            ReleaseBuffers(chunk); // an emptied chunk hands its buffers back
+            chunk.Dirty = false;
+            m_Stats.RebuiltChunks++;
+            return;
+        }
+
+        if (chunk.Buffers == NoChunk && AcquireBuffers(index) == NoChunk) {
+            // Every reserved slot is on screen; stays dirty for a later Draw
+            if (!m_ReportedFullPool) EG_CORE_WARN("Tilemap: more chunks visible than reserved ({}); some are skipped", m_Pool.size());
+            m_ReportedFullPool = true;
+            return;
+        }
+
+        const ChunkBuffers& buffers = m_Pool[chunk.Buffers];
+        if (auto* rec = CommandList::Recording()) {
+            rec->UploadVertices(buffers.PositionVB, positions.data(), posBytes);
+            rec->UploadVertices(buffers.AttribVB, attribs.data(), attribBytes);
+        }
+        else {
+            buffers.PositionVB->SetData(positions.data(), posBytes);
+            buffers.AttribVB->SetData(attribs.data(), attribBytes);
+        }
+
+        chunk.IndexCount = (uint32_t)(positions.size() / 4) * 6;
+        chunk.Dirty = false;
+        m_Stats.RebuiltChunks++;
+        m_Stats.UploadedBytes += posBytes + attribBytes;
+    }
+
+    void Tilemap::Draw(const OrthographicCamera& camera) {
+        Draw(camera.GetViewProjectionMatrix());
+    }
+
+    void Tilemap::Draw(const glm::mat4& viewProjection) {
+        EG_PROFILE_FUNCTION();
+        if (m_Chunks.empty()) return;
+
+        // World-space bounds of the view: unproject the NDC corners
+        const glm::mat4 inv = glm::inverse(viewProjection);
+        glm::vec2 lo(std::numeric_limits<float>::max()), hi(-std::numeric_limits<float>::max());
+        for (float nx : { -1.0f, 1.0f }) {
+            for (float ny : { -1.0f, 1.0f }) {
+                const glm::vec4 w = inv * glm::vec4(nx, ny, 0.0f, 1.0f);
+                const glm::vec2 p = glm::vec2(w) / w.w;
+                lo = glm::min(lo, p);
+                hi = glm::max(hi, p);
+            }
+        }
+
+        const glm::vec2 chunkExtent = m_TileSize * (float)ChunkSize;
+        const glm::vec2 first = glm::floor((lo - glm::vec2(m_Origin)) / chunkExtent);
+        const glm::vec2 last = glm::floor((hi - glm::vec2(m_Origin)) / chunkExtent);
+        if (last.x < 0.0f || last.y < 0.0f || first.x >= (float)m_ChunksX || first.y >= (float)m_ChunksY) return;
+
+        const uint32_t cx0 = (uint32_t)std::max(first.x, 0.0f), cy0 = (uint32_t)std::max(first.y, 0.0f);
+        const uint32_t cx1 = std::min((uint32_t)last.x, m_ChunksX - 1), cy1 = std::min((uint32_t)last.y, m_ChunksY - 1);
+
+        CommandList* rec = CommandList::Recording();
+        if (rec) {
+            rec->BindShader(m_Shader);
+            rec->SetMat4("u_ViewProjection", viewProjection);
+            for (uint32_t i = 0; i < (uint32_t)m_Textures.size(); ++i) rec->BindTexture(m_Textures[i], i);
+        }
+        else {
+            m_Shader->Binding();
+            m_Shader->SetMat4("u_ViewProjection", viewProjection);
+            for (uint32_t i = 0; i < (uint32_t)m_Textures.size(); ++i) m_Textures[i]->Bind(i);
+        }
+
+        // Mark the whole view first so rebuilding one visible chunk never
+        // evicts another
+        m_DrawIndex++;
+        for (uint32_t cy = cy0; cy <= cy1; ++cy)
+            for (uint32_t cx = cx0; cx <= cx1; ++cx)
+                m_Chunks[cy * m_ChunksX + cx].LastDrawn = m_DrawIndex;
+
+        for (uint32_t cy = cy0; cy <= cy1; ++cy) {
+            for (uint32_t cx = cx0; cx <= cx1; ++cx) {
+                Chunk& chunk = m_Chunks[cy * m_ChunksX + cx];
+                if (chunk.Dirty) RebuildChunk(cx, cy);
+                m_Stats.VisibleChunks++;
+                if (chunk.IndexCount == 0) continue;
+
+                const Shared<VertexArray>& va = m_Pool[chunk.Buffers].VA;
+                if (!rec) va->Bind();
+                RenderCommand::DrawIndexed(va, chunk.IndexCount);
+                m_Stats.DrawCalls++;
+            }
+        }
+    }
+
+} // namespace Engine
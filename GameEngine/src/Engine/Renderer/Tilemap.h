@@ -0,0 +1,111 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Core/Core.h"
+#include "OrthographicCamera.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "VertexArray.h"
+
+namespace Engine {
+
+    // Static grid of quads split into ChunkSize x ChunkSize chunks. A chunk
+    // keeps its geometry in GPU buffers taken from the map's pool the first
+    // time it has tiles to draw, refilled only after one of its tiles changes.
+    // Drawing costs one draw call per chunk that intersects the view,
+    // however large the map is.
+    //
+    // Nothing can be created on the GPU while recording, so a map drawn into
+    // a CommandList draws from buffers set aside with Reserve; once they are
+    // all in use, the chunk drawn least recently gives its buffers up.
+    //
+    // Tile (0, 0) is the bottom-left one; tile (x, y) is centered at
+    // origin + (x + 0.5, y + 0.5) * tileSize.
+    class Tilemap {
+    public:
+        static constexpr uint32_t ChunkSize = 16;
+        static constexpr uint32_t MaxTextures = 16; // palette entry 0 is white
+
+        struct Tile {
+            glm::vec4 Color{ 0.0f };  // alpha 0 = empty, nothing is drawn
+            uint32_t  Texture = 0;    // palette index from AddTexture
+            float     Tiling = 1.0f;
+        };
+
+        // `shader` must use the Quad2D vertex layout; defaults to Quad2D.glsl.
+        Tilemap(uint32_t width, uint32_t height, const glm::vec2& tileSize,
+            const glm::vec3& origin = glm::vec3(0.0f), Shared<Shader> shader = nullptr);
+
+        uint32_t AddTexture(const Shared<Texture2D>& texture);
+
+        // Allocates buffers for `chunks` chunks up front (outside a recorded
+        // frame); size it for the chunks one view can show.
+        void Reserve(uint32_t chunks);
+        uint32_t GetAllocatedChunks() const { return (uint32_t)m_Pool.size(); }
+
+        void SetTile(uint32_t x, uint32_t y, const Tile& tile);
+        const Tile& GetTile(uint32_t x, uint32_t y) const { return m_Tiles[y * m_Width + x]; }
+        void Fill(const Tile& tile);
+
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+
+        // Draws the chunks visible through the camera; may be recorded into a
+        // CommandList (the map and its Reserve come before). Call outside a
+        // Renderer2D scene or after its Flush: the chunks are drawn
+        // immediately, not batched with the scene's quads.
+        void Draw(const OrthographicCamera& camera);
+        void Draw(const glm::mat4& viewProjection);
+
+        struct Statistics {
+            uint32_t VisibleChunks = 0;
+            uint32_t DrawCalls = 0;
+            uint32_t RebuiltChunks = 0;
+            uint32_t EvictedChunks = 0;
+            uint64_t UploadedBytes = 0;
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats = {}; }
+
+    private:
+        static constexpr uint32_t NoChunk = ~0u;
+
+        struct ChunkBuffers {
+            Shared<VertexArray>  VA;
+            Shared<VertexBuffer> PositionVB;
+            Shared<VertexBuffer> AttribVB;
+            uint32_t Owner = NoChunk; // chunk index
+        };
+
+        struct Chunk {
+            uint32_t Buffers = NoChunk; // slot in m_Pool
+            uint32_t IndexCount = 0;
+            uint32_t LastDrawn = 0;     // m_DrawIndex of the last Draw that showed it
+            bool     Dirty = true;
+        };
+
+        void RebuildChunk(uint32_t cx, uint32_t cy);
+        uint32_t AcquireBuffers(uint32_t chunk);
+        void ReleaseBuffers(Chunk& chunk);
+        void CreateBuffers();
+
+        uint32_t  m_Width, m_Height;
+        uint32_t  m_ChunksX, m_ChunksY;
+        glm::vec2 m_TileSize;
+        glm::vec3 m_Origin;
+
+        std::vector<Tile>  m_Tiles;
+        std::vector<Chunk> m_Chunks;
+        std::vector<ChunkBuffers> m_Pool;
+        uint32_t m_DrawIndex = 0;
+        bool m_ReportedFullPool = false;
+
+        Shared<Shader>         m_Shader;      // the default one is shared by all maps
+        Shared<IndexBuffer>    m_IndexBuffer; // shared by all chunks
+        std::vector<Shared<Texture2D>> m_Textures;
+
+        Statistics m_Stats;
+    };
+
+} // namespace Engine
@@ -1,9 +1,15 @@
 #include "enginepch.h"
 #include "VertexArray.h"
 #include "RendererBackend.h"
+#include <atomic>
 
 namespace Engine {
 
+    uint32_t VertexArray::NextSortID() {
+        static std::atomic<uint32_t> next{ 0 };
+        return next++;
+    }
+
     Shared<VertexArray> VertexArray::Create() {
         EG_PROFILE_FUNCTION();
         auto fn = Detail::GetCreators().va;
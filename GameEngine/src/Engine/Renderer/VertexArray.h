@@ -18,7 +18,14 @@ namespace Engine {
         virtual const std::vector<Shared<VertexBuffer>>& GetVertexBuffers() const = 0;
         virtual const Shared<IndexBuffer>& GetIndexBuffer() const = 0;
 
+        // Creation order, never reused; see Shader::GetSortID.
+        uint32_t GetSortID() const { return m_SortID; }
+
         static Shared<VertexArray> Create();
+
+    private:
+        static uint32_t NextSortID();
+        const uint32_t m_SortID = NextSortID();
     };
 
 } // namespace Engine
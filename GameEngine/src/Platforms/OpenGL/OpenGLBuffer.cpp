@@ -1,5 +1,6 @@
 #include "enginepch.h"
 #include "OpenGLBuffer.h"
+#include "OpenGLVertexFormatCache.h"
 
 #include <glad/glad.h>
 
@@ -7,34 +8,59 @@ namespace Engine {
 
     // -------- VertexBuffer -------------------------------------------------------
 
-    OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) {
+    OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+        : m_Size(size) {
         EG_PROFILE_FUNCTION();
 
+        // DSA upload: binding GL_ARRAY_BUFFER/GL_ELEMENT_ARRAY_BUFFER here would
+        // disturb whichever shared VAO happens to be current
         glCreateBuffers(1, &m_ID);
-        glBindBuffer(GL_ARRAY_BUFFER, m_ID);
-        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+        glNamedBufferData(m_ID, size, vertices, GL_STATIC_DRAW);
+    }
+
+    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+        : m_Size(size) {
+        EG_PROFILE_FUNCTION();
+
+        glCreateBuffers(1, &m_ID);
+        glNamedBufferData(m_ID, size, nullptr, GL_DYNAMIC_DRAW);
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer() {
         EG_PROFILE_FUNCTION();
-        if (m_ID) glDeleteBuffers(1, &m_ID);
+        Release();
     }
 
     OpenGLVertexBuffer::OpenGLVertexBuffer(OpenGLVertexBuffer&& other) noexcept
-        : m_ID(other.m_ID), m_Layout(std::move(other.m_Layout)) {
+        : m_ID(other.m_ID), m_Size(other.m_Size), m_Layout(std::move(other.m_Layout)) {
         other.m_ID = 0;
+        other.m_Size = 0;
     }
 
     OpenGLVertexBuffer& OpenGLVertexBuffer::operator=(OpenGLVertexBuffer&& other) noexcept {
         if (this != &other) {
-            if (m_ID) glDeleteBuffers(1, &m_ID);
+            Release();
             m_ID = other.m_ID;
+            m_Size = other.m_Size;
             m_Layout = std::move(other.m_Layout);
             other.m_ID = 0;
+            other.m_Size = 0;
         }
         return *this;
     }
 
+    void OpenGLVertexBuffer::Release() {
+        if (!m_ID) return;
+        OpenGLVertexFormatCache::Get().OnBufferDeleted(m_ID);
+        glDeleteBuffers(1, &m_ID);
+        m_ID = 0;
+    }
+
+    void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+        EG_CORE_CHECK(offset + size <= m_Size, "VertexBuffer::SetData out of range");
+        glNamedBufferSubData(m_ID, (GLintptr)offset, (GLsizeiptr)size, data);
+    }
+
     void OpenGLVertexBuffer::Bind() const {
         glBindBuffer(GL_ARRAY_BUFFER, m_ID);
     }
@@ -50,13 +76,12 @@ namespace Engine {
         EG_PROFILE_FUNCTION();
 
         glCreateBuffers(1, &m_ID);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ID);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+        glNamedBufferData(m_ID, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
     }
 
     OpenGLIndexBuffer::~OpenGLIndexBuffer() {
         EG_PROFILE_FUNCTION();
-        if (m_ID) glDeleteBuffers(1, &m_ID);
+        Release();
     }
 
     OpenGLIndexBuffer::OpenGLIndexBuffer(OpenGLIndexBuffer&& other) noexcept
@@ -67,7 +92,7 @@ namespace Engine {
 
     OpenGLIndexBuffer& OpenGLIndexBuffer::operator=(OpenGLIndexBuffer&& other) noexcept {
         if (this != &other) {
-            if (m_ID) glDeleteBuffers(1, &m_ID);
+            Release();
             m_ID = other.m_ID;
             m_Count = other.m_Count;
             other.m_ID = 0;
@@ -76,12 +101,19 @@ namespace Engine {
         return *this;
     }
 
+    void OpenGLIndexBuffer::Release() {
+        if (!m_ID) return;
+        OpenGLVertexFormatCache::Get().OnBufferDeleted(m_ID);
+        glDeleteBuffers(1, &m_ID);
+        m_ID = 0;
+    }
+
     void OpenGLIndexBuffer::Bind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ID);
+        OpenGLVertexFormatCache::Get().BindIndexBuffer(m_ID);
     }
 
     void OpenGLIndexBuffer::Unbind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        OpenGLVertexFormatCache::Get().BindIndexBuffer(0);
     }
 
 } // namespace Engine
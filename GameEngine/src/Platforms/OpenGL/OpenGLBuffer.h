@@ -7,6 +7,7 @@ namespace Engine {
     class OpenGLVertexBuffer final : public VertexBuffer {
     public:
         OpenGLVertexBuffer(float* vertices, uint32_t size);
+        explicit OpenGLVertexBuffer(uint32_t size); // dynamic
         ~OpenGLVertexBuffer() override;
         OpenGLVertexBuffer(const OpenGLVertexBuffer&) = delete;
         OpenGLVertexBuffer& operator=(const OpenGLVertexBuffer&) = delete;
@@ -19,10 +20,16 @@ namespace Engine {
         const BufferLayout& GetLayout() const override { return m_Layout; }
         void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
+        void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+        uint32_t GetSize() const override { return m_Size; }
+
         uint32_t id() const noexcept { return m_ID; }
 
     private:
+        void Release();
+
         uint32_t m_ID = 0;
+        uint32_t m_Size = 0;
         BufferLayout m_Layout;
     };
 
@@ -42,6 +49,8 @@ namespace Engine {
         uint32_t id() const noexcept { return m_ID; }
 
     private:
+        void Release();
+
         uint32_t m_ID = 0;
         uint32_t m_Count = 0;
     };
@@ -29,4 +29,12 @@ namespace Engine {
         glfwSwapBuffers(m_Window);
     }
 
+    void OpenGLContext::MakeCurrent() {
+        glfwMakeContextCurrent(m_Window);
+    }
+
+    void OpenGLContext::ReleaseCurrent() {
+        glfwMakeContextCurrent(nullptr);
+    }
+
 } // namespace Engine
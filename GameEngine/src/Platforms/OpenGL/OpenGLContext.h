@@ -11,6 +11,8 @@ namespace Engine {
 
         void Init() override;
         void SwapBuffers() override;
+        void MakeCurrent() override;
+        void ReleaseCurrent() override;
 
     private:
         GLFWwindow* m_Window = nullptr;
@@ -0,0 +1,75 @@
+#include "enginepch.h"
+#include "OpenGLFrameReadback.h"
+#include <glad/glad.h>
+
+namespace Engine {
+
+    OpenGLFrameReadback::OpenGLFrameReadback(uint32_t slots)
+        : m_Slots(slots) {
+        for (Slot& s : m_Slots) glCreateBuffers(1, &s.Buffer);
+    }
+
+    OpenGLFrameReadback::~OpenGLFrameReadback() {
+        for (Slot& s : m_Slots) {
+            if (s.Fence) glDeleteSync(s.Fence);
+            glDeleteBuffers(1, &s.Buffer);
+        }
+    }
+
+    bool OpenGLFrameReadback::Request(uint32_t width, uint32_t height, uint64_t tag, ReadbackSource source) {
+        EG_PROFILE_FUNCTION();
+        if (m_Count == (uint32_t)m_Slots.size() || width == 0 || height == 0) return false;
+
+        Slot& s = m_Slots[m_Head];
+        const bool color = source == ReadbackSource::Color;
+        const uint32_t bytes = width * height * (color ? 4 : 1);
+        if (s.Capacity < bytes) {
+            glNamedBufferData(s.Buffer, bytes, nullptr, GL_STREAM_READ);
+            s.Capacity = bytes;
+        }
+
+        glPixelStorei(GL_PACK_ALIGNMENT, color ? 4 : 1);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, s.Buffer);
+        glReadPixels(0, 0, (GLsizei)width, (GLsizei)height, color ? GL_RGBA : GL_STENCIL_INDEX, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        s.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        s.Width = width;
+        s.Height = height;
+        s.Tag = tag;
+        s.Source = source;
+
+        m_Head = (m_Head + 1) % (uint32_t)m_Slots.size();
+        m_Count++;
+        return true;
+    }
+
+    bool OpenGLFrameReadback::Poll(ReadbackImage& out, bool wait) {
+        if (m_Count == 0) return false;
+        const uint32_t n = (uint32_t)m_Slots.size();
+        Slot& s = m_Slots[(m_Head + n - m_Count) % n];
+
+        // Without wait this is a query; the flush bit makes sure the fence
+        // actually reaches the GPU before we block on it
+        const GLenum status = glClientWaitSync(s.Fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+            wait ? 1000000000ull : 0);
+        if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED) return false;
+
+        EG_PROFILE_FUNCTION();
+        glDeleteSync(s.Fence);
+        s.Fence = nullptr;
+        m_Count--;
+
+        out.Width = s.Width;
+        out.Height = s.Height;
+        out.Tag = s.Tag;
+        out.Source = s.Source;
+        const size_t bytes = (size_t)s.Width * s.Height * out.BytesPerPixel();
+        out.Pixels.resize(bytes);
+        if (const void* src = glMapNamedBufferRange(s.Buffer, 0, (GLsizeiptr)bytes, GL_MAP_READ_BIT)) {
+            std::memcpy(out.Pixels.data(), src, bytes);
+            glUnmapNamedBuffer(s.Buffer);
+        }
+        return true;
+    }
+
+} // namespace Engine
@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+#include "Engine/Renderer/FrameReadback.h"
+
+typedef struct __GLsync* GLsync;
+
+namespace Engine {
+
+    // glReadPixels into a ring of pixel-pack buffers. The read only queues
+    // a copy on the GPU; a fence per slot tells Poll when the buffer can be
+    // mapped without waiting.
+    class OpenGLFrameReadback final : public FrameReadback {
+    public:
+        explicit OpenGLFrameReadback(uint32_t slots);
+        ~OpenGLFrameReadback() override;
+
+        OpenGLFrameReadback(const OpenGLFrameReadback&) = delete;
+        OpenGLFrameReadback& operator=(const OpenGLFrameReadback&) = delete;
+
+        bool Request(uint32_t width, uint32_t height, uint64_t tag, ReadbackSource source) override;
+        bool Poll(ReadbackImage& out, bool wait) override;
+        uint32_t InFlight() const override { return m_Count; }
+
+    private:
+        struct Slot {
+            uint32_t Buffer = 0;
+            uint32_t Capacity = 0; // bytes
+            GLsync   Fence = nullptr;
+            uint32_t Width = 0, Height = 0;
+            uint64_t Tag = 0;
+            ReadbackSource Source = ReadbackSource::Color;
+        };
+
+        std::vector<Slot> m_Slots;
+        uint32_t m_Head = 0;  // next slot to fill
+        uint32_t m_Count = 0; // in flight, oldest at m_Head - m_Count
+    };
+
+} // namespace Engine
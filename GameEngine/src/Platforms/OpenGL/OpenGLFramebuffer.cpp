@@ -0,0 +1,67 @@
+#include "enginepch.h"
+#include "OpenGLFramebuffer.h"
+#include "OpenGLTexture.h"
+#include <glad/glad.h>
+
+namespace Engine {
+
+    OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpec& spec)
+        : m_Spec(spec) {
+        Invalidate();
+    }
+
+    OpenGLFramebuffer::~OpenGLFramebuffer() {
+        Release();
+    }
+
+    void OpenGLFramebuffer::Release() {
+        if (m_ID) glDeleteFramebuffers(1, &m_ID);
+        if (m_DepthID) glDeleteRenderbuffers(1, &m_DepthID);
+        m_ID = m_DepthID = 0;
+        m_Color.reset();
+    }
+
+    void OpenGLFramebuffer::Invalidate() {
+        EG_PROFILE_FUNCTION();
+        Release();
+        EG_CORE_CHECK(m_Spec.Width > 0 && m_Spec.Height > 0, "Framebuffer size must be non-zero");
+
+        auto color = MakeShared<OpenGLTexture2D>(m_Spec.Width, m_Spec.Height, false);
+        // Sampled scaled (upsampling); no mips, and no wrapping across edges
+        glTextureParameteri(color->id(), GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(color->id(), GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(color->id(), GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glCreateFramebuffers(1, &m_ID);
+        glNamedFramebufferTexture(m_ID, GL_COLOR_ATTACHMENT0, color->id(), 0);
+        m_Color = color;
+
+        if (m_Spec.Depth) {
+            glCreateRenderbuffers(1, &m_DepthID);
+            glNamedRenderbufferStorage(m_DepthID, GL_DEPTH24_STENCIL8, (GLsizei)m_Spec.Width, (GLsizei)m_Spec.Height);
+            glNamedFramebufferRenderbuffer(m_ID, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthID);
+        }
+
+        EG_CORE_CHECK(glCheckNamedFramebufferStatus(m_ID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE,
+            "Framebuffer is incomplete");
+    }
+
+    void OpenGLFramebuffer::Bind() {
+        glGetIntegerv(GL_VIEWPORT, m_SavedViewport);
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_SavedFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_ID);
+        glViewport(0, 0, (GLsizei)m_Spec.Width, (GLsizei)m_Spec.Height);
+    }
+
+    void OpenGLFramebuffer::Unbind() {
+        glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)m_SavedFramebuffer);
+        glViewport(m_SavedViewport[0], m_SavedViewport[1], m_SavedViewport[2], m_SavedViewport[3]);
+    }
+
+    void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0 || (width == m_Spec.Width && height == m_Spec.Height)) return;
+        m_Spec.Width = width;
+        m_Spec.Height = height;
+        Invalidate();
+    }
+
+} // namespace Engine
@@ -0,0 +1,37 @@
+#pragma once
+#include "Engine/Renderer/Framebuffer.h"
+
+namespace Engine {
+
+    class OpenGLTexture2D;
+
+    // FBO with an RGBA8 texture (linear, not sRGB: nothing converts on
+    // write) and an optional depth renderbuffer.
+    class OpenGLFramebuffer final : public Framebuffer {
+    public:
+        explicit OpenGLFramebuffer(const FramebufferSpec& spec);
+        ~OpenGLFramebuffer() override;
+
+        OpenGLFramebuffer(const OpenGLFramebuffer&) = delete;
+        OpenGLFramebuffer& operator=(const OpenGLFramebuffer&) = delete;
+
+        void Bind() override;
+        void Unbind() override;
+        void Resize(uint32_t width, uint32_t height) override;
+
+        const FramebufferSpec& GetSpec() const override { return m_Spec; }
+        const Shared<Texture2D>& GetColorAttachment() const override { return m_Color; }
+
+    private:
+        void Invalidate();
+        void Release();
+
+        FramebufferSpec   m_Spec;
+        uint32_t          m_ID = 0;
+        uint32_t          m_DepthID = 0;
+        Shared<Texture2D> m_Color;
+        int               m_SavedViewport[4] = {};
+        int               m_SavedFramebuffer = 0;
+    };
+
+} // namespace Engine
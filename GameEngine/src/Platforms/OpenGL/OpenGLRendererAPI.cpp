@@ -20,11 +20,50 @@ namespace Engine {
     }
 
     void OpenGLRendererAPI::Clear() {
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
     }
 
-    void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& va) {
-        glDrawElements(GL_TRIANGLES, (GLsizei)va->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
+    void OpenGLRendererAPI::SetOverdrawCounting(bool enabled) {
+        if (!enabled) {
+            glDisable(GL_STENCIL_TEST);
+            return;
+        }
+        // Depth-fail leaves the count alone: those fragments are not shaded
+        glEnable(GL_STENCIL_TEST);
+        glStencilMask(0xff);
+        glStencilFunc(GL_ALWAYS, 0, 0xff);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
+    }
+
+    void OpenGLRendererAPI::SetBlendMode(BlendMode mode) {
+        if (mode == BlendMode::Opaque) {
+            glDisable(GL_BLEND);
+            return;
+        }
+        glEnable(GL_BLEND);
+        switch (mode) {
+        case BlendMode::AlphaAccumulate:
+            glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+        case BlendMode::Premultiplied:
+            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+        default:
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+        }
+    }
+
+    void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& va, uint32_t indexCount) {
+        const uint32_t count = indexCount ? indexCount : va->GetIndexBuffer()->GetCount();
+        glDrawElements(GL_TRIANGLES, (GLsizei)count, GL_UNSIGNED_INT, nullptr);
+    }
+
+    void OpenGLRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& va,
+        uint32_t instanceCount, uint32_t baseInstance) {
+        const GLsizei count = (GLsizei)va->GetIndexBuffer()->GetCount();
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr,
+            (GLsizei)instanceCount, (GLuint)baseInstance);
     }
 
 } // namespace Engine
@@ -9,7 +9,11 @@ namespace Engine {
         void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) override;
         void SetClearColor(const glm::vec4& color) override;
         void Clear() override;
-        void DrawIndexed(const std::shared_ptr<VertexArray>& va) override;
+        void SetBlendMode(BlendMode mode) override;
+        void SetOverdrawCounting(bool enabled) override;
+        void DrawIndexed(const std::shared_ptr<VertexArray>& va, uint32_t indexCount = 0) override;
+        void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& va, uint32_t instanceCount,
+            uint32_t baseInstance = 0) override;
     };
 
 } // namespace Engine
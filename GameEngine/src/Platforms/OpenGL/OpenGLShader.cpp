@@ -38,11 +38,12 @@ namespace Engine {
     void OpenGLShader::Binding() const { glUseProgram(m_Program); }
     void OpenGLShader::Unbinding() const { glUseProgram(0); }
 
-    void OpenGLShader::SetInt(const std::string& n, int v) { UploadUniformInt(n, v); }
-    void OpenGLShader::SetFloat(const std::string& n, float v) { UploadUniformFloat(n, v); }
-    void OpenGLShader::SetFloat3(const std::string& n, const glm::vec3& v) { UploadUniformFloat3(n, v); }
-    void OpenGLShader::SetFloat4(const std::string& n, const glm::vec4& v) { UploadUniformFloat4(n, v); }
-    void OpenGLShader::SetMat4(const std::string& n, const glm::mat4& m) { UploadUniformMat4(n, m); }
+    void OpenGLShader::UploadInt(const std::string& n, int v) { UploadUniformInt(n, v); }
+    void OpenGLShader::UploadIntArray(const std::string& n, const int* v, uint32_t count) { glUniform1iv(Locate(n), (GLsizei)count, v); }
+    void OpenGLShader::UploadFloat(const std::string& n, float v) { UploadUniformFloat(n, v); }
+    void OpenGLShader::UploadFloat3(const std::string& n, const glm::vec3& v) { UploadUniformFloat3(n, v); }
+    void OpenGLShader::UploadFloat4(const std::string& n, const glm::vec4& v) { UploadUniformFloat4(n, v); }
+    void OpenGLShader::UploadMat4(const std::string& n, const glm::mat4& m) { UploadUniformMat4(n, m); }
 
     int OpenGLShader::Locate(const std::string& n) const {
         if (auto it = m_LocCache.find(n); it != m_LocCache.end()) return it->second;
@@ -51,6 +52,10 @@ namespace Engine {
         return loc;
     }
 
+    int OpenGLShader::GetAttributeLocation(const std::string& name) const {
+        return glGetAttribLocation(m_Program, name.c_str());
+    }
+
     void OpenGLShader::UploadUniformInt(const std::string& n, int v) { glUniform1i(Locate(n), v); }
     void OpenGLShader::UploadUniformFloat(const std::string& n, float v) { glUniform1f(Locate(n), v); }
     void OpenGLShader::UploadUniformFloat2(const std::string& n, const glm::vec2& v) { glUniform2f(Locate(n), v.x, v.y); }
@@ -19,13 +19,17 @@ namespace Engine {
         void Binding() const override;
         void Unbinding() const override;
 
-        void SetInt(const std::string& n, int v) override;
-        void SetFloat(const std::string& n, float v) override;
-        void SetFloat3(const std::string& n, const glm::vec3& v) override;
-        void SetFloat4(const std::string& n, const glm::vec4& v) override;
-        void SetMat4(const std::string& n, const glm::mat4& m) override;
+    protected:
+        void UploadInt(const std::string& n, int v) override;
+        void UploadIntArray(const std::string& n, const int* v, uint32_t count) override;
+        void UploadFloat(const std::string& n, float v) override;
+        void UploadFloat3(const std::string& n, const glm::vec3& v) override;
+        void UploadFloat4(const std::string& n, const glm::vec4& v) override;
+        void UploadMat4(const std::string& n, const glm::mat4& m) override;
 
+    public:
         const std::string& GetName() const override { return m_Name; }
+        int GetAttributeLocation(const std::string& name) const override;
 
         // kept for compatibility:
         void UploadUniformInt(const std::string& n, int v);
@@ -6,11 +6,16 @@
 
 namespace Engine {
 
+    // Lightweight view over a shared, format-cached VAO (see OpenGLVertexFormatCache).
+    // Owns no GL object itself; Bind() re-points the shared VAO at this mesh's buffers.
     class OpenGLVertexArray final : public VertexArray {
     public:
         OpenGLVertexArray();
         ~OpenGLVertexArray() override;
 
+        OpenGLVertexArray(const OpenGLVertexArray&) = delete;
+        OpenGLVertexArray& operator=(const OpenGLVertexArray&) = delete;
+
         void Bind() const override;
         void Unbind() const override;
 
@@ -21,12 +26,14 @@ namespace Engine {
         const Shared<IndexBuffer>& GetIndexBuffer() const override { return m_IB; }
 
     private:
-        uint32_t m_VAO = 0;
         std::vector<Shared<VertexBuffer>> m_VBs;
         Shared<IndexBuffer> m_IB;
 
-        uint32_t m_BindingBase = 0;
-        uint32_t m_AttribBase = 0;
+        // Format id in the cache (0 = no streams yet) and the GL ids/strides to attach on Bind
+        uint32_t m_Format = 0;
+        std::vector<uint32_t> m_VBOs;
+        std::vector<uint32_t> m_Strides;
+        uint32_t m_IBO = 0;
     };
 
 } // namespace Engine
@@ -0,0 +1,190 @@
+#include "enginepch.h"
+#include "OpenGLVertexFormatCache.h"
+#include <glad/glad.h>
+
+namespace Engine {
+
+    static GLenum ToGLType(ShaderDataType t) {
+        switch (t) {
+        case ShaderDataType::Float:
+        case ShaderDataType::Float2:
+        case ShaderDataType::Float3:
+        case ShaderDataType::Float4:
+        case ShaderDataType::Mat3:
+        case ShaderDataType::Mat4:  return GL_FLOAT;
+        case ShaderDataType::Int:
+        case ShaderDataType::Int2:
+        case ShaderDataType::Int3:
+        case ShaderDataType::Int4:  return GL_INT;
+        case ShaderDataType::Bool:  return GL_BOOL;
+        default: EG_CORE_CHECK(false, "Unknown ShaderDataType"); return GL_FLOAT;
+        }
+    }
+
+    // Specifies the attribute formats of one stream; returns the next free attribute index.
+    static GLuint SpecifyStream(GLuint vao, GLuint binding, const BufferLayout& layout, GLuint attrib) {
+        for (const BufferElement& e : layout.Elements()) {
+            const GLenum base = ToGLType(e.Type);
+            const GLboolean norm = e.Normalized ? GL_TRUE : GL_FALSE;
+
+            switch (e.Type) {
+            case ShaderDataType::Float:
+            case ShaderDataType::Float2:
+            case ShaderDataType::Float3:
+            case ShaderDataType::Float4:
+                glEnableVertexArrayAttrib(vao, attrib);
+                glVertexArrayAttribBinding(vao, attrib, binding);
+                glVertexArrayAttribFormat(vao, attrib, (GLint)e.GetComponentCount(), base, norm, (GLuint)e.Offset);
+                attrib++;
+                break;
+
+            case ShaderDataType::Int:
+            case ShaderDataType::Int2:
+            case ShaderDataType::Int3:
+            case ShaderDataType::Int4:
+            case ShaderDataType::Bool:
+                glEnableVertexArrayAttrib(vao, attrib);
+                glVertexArrayAttribBinding(vao, attrib, binding);
+                glVertexArrayAttribIFormat(vao, attrib, (GLint)e.GetComponentCount(), base, (GLuint)e.Offset);
+                attrib++;
+                break;
+
+            case ShaderDataType::Mat3:
+            case ShaderDataType::Mat4: {
+                const uint32_t cols = (e.Type == ShaderDataType::Mat3) ? 3u : 4u;
+                const uint32_t colSize = (uint32_t)sizeof(float) * cols;
+
+                for (uint32_t c = 0; c < cols; ++c) {
+                    glEnableVertexArrayAttrib(vao, attrib);
+                    glVertexArrayAttribBinding(vao, attrib, binding);
+                    glVertexArrayAttribFormat(vao, attrib, (GLint)cols, GL_FLOAT, norm,
+                        (GLuint)(e.Offset + c * colSize));
+                    attrib++;
+                }
+            } break;
+
+            default:
+                EG_CORE_CHECK(false, "Unhandled ShaderDataType");
+            }
+        }
+        glVertexArrayBindingDivisor(vao, binding, layout.Divisor());
+        return attrib;
+    }
+
+    OpenGLVertexFormatCache& OpenGLVertexFormatCache::Get() {
+        static OpenGLVertexFormatCache s;
+        return s;
+    }
+
+    uint64_t OpenGLVertexFormatCache::MakeKey(const std::vector<const BufferLayout*>& streams) {
+        uint64_t key = 1469598103934665603ull;
+        for (const BufferLayout* l : streams) {
+            key = (key ^ l->Hash()) * 1099511628211ull;
+        }
+        return key;
+    }
+
+    static bool SameStreams(const std::vector<BufferLayout>& a, const std::vector<const BufferLayout*>& b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i)
+            if (!a[i].SameFormat(*b[i])) return false;
+        return true;
+    }
+
+    uint32_t OpenGLVertexFormatCache::Acquire(const std::vector<const BufferLayout*>& streams) {
+        const uint64_t key = MakeKey(streams);
+        auto [first, last] = m_ByKey.equal_range(key);
+        for (auto it = first; it != last; ++it) {
+            Entry& e = m_Entries.at(it->second);
+            if (!SameStreams(e.Streams, streams)) continue;
+            e.RefCount++;
+            return it->second;
+        }
+
+        EG_PROFILE_SCOPE("OpenGLVertexFormatCache::CreateVAO");
+        const uint32_t format = m_NextFormat++;
+        Entry& e = m_Entries[format];
+        glCreateVertexArrays(1, &e.VAO);
+
+        GLuint attrib = 0;
+        for (size_t b = 0; b < streams.size(); ++b)
+            attrib = SpecifyStream(e.VAO, (GLuint)b, *streams[b], attrib);
+
+        e.Key = key;
+        for (const BufferLayout* l : streams) e.Streams.push_back(*l);
+        e.BoundVBOs.assign(streams.size(), 0u);
+        e.RefCount = 1;
+        m_ByKey.emplace(key, format);
+        return format;
+    }
+
+    void OpenGLVertexFormatCache::Release(uint32_t format) {
+        auto it = m_Entries.find(format);
+        if (it == m_Entries.end()) return;
+
+        Entry& e = it->second;
+        if (--e.RefCount > 0) return;
+
+        if (m_CurrentFormat == format) {
+            glBindVertexArray(0);
+            m_CurrentFormat = 0;
+        }
+        glDeleteVertexArrays(1, &e.VAO);
+        auto [first, last] = m_ByKey.equal_range(e.Key);
+        for (auto k = first; k != last; ++k) {
+            if (k->second == format) { m_ByKey.erase(k); break; }
+        }
+        m_Entries.erase(it);
+    }
+
+    void OpenGLVertexFormatCache::Bind(uint32_t format, const std::vector<uint32_t>& vbos,
+        const std::vector<uint32_t>& strides, uint32_t ibo) {
+        auto it = m_Entries.find(format);
+        EG_CORE_CHECK(it != m_Entries.end(), "Binding a vertex format that was never acquired");
+        if (it == m_Entries.end()) return;
+
+        Entry& e = it->second;
+        for (size_t b = 0; b < vbos.size() && b < e.BoundVBOs.size(); ++b) {
+            if (e.BoundVBOs[b] == vbos[b]) continue;
+            glVertexArrayVertexBuffer(e.VAO, (GLuint)b, vbos[b], 0, (GLsizei)strides[b]);
+            e.BoundVBOs[b] = vbos[b];
+        }
+        if (e.BoundIBO != ibo) {
+            glVertexArrayElementBuffer(e.VAO, ibo);
+            e.BoundIBO = ibo;
+        }
+
+        if (m_CurrentFormat != format) {
+            glBindVertexArray(e.VAO);
+            m_CurrentFormat = format;
+        }
+    }
+
+    void OpenGLVertexFormatCache::Unbind() {
+        if (m_CurrentFormat == 0) return;
+        glBindVertexArray(0);
+        m_CurrentFormat = 0;
+    }
+
+    void OpenGLVertexFormatCache::BindIndexBuffer(uint32_t ibo) {
+        auto it = m_Entries.find(m_CurrentFormat);
+        if (it == m_Entries.end()) {
+            // No shared VAO current: nothing the cache tracks can change
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+            return;
+        }
+        Entry& e = it->second;
+        if (e.BoundIBO == ibo) return;
+        glVertexArrayElementBuffer(e.VAO, ibo);
+        e.BoundIBO = ibo;
+    }
+
+    void OpenGLVertexFormatCache::OnBufferDeleted(uint32_t id) {
+        for (auto& [key, e] : m_Entries) {
+            for (auto& vbo : e.BoundVBOs)
+                if (vbo == id) vbo = 0;
+            if (e.BoundIBO == id) e.BoundIBO = 0;
+        }
+    }
+
+} // namespace Engine
@@ -0,0 +1,59 @@
+#pragma once
+#include "Engine/Renderer/Buffer.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace Engine {
+
+    // Shares one VAO between all vertex arrays with the same vertex format.
+    // The format (attribute layout per binding) is specified once when the VAO
+    // is created; switching meshes only re-points the buffer bindings.
+    class OpenGLVertexFormatCache {
+    public:
+        static OpenGLVertexFormatCache& Get();
+
+        // Combined hash of all streams of a vertex array, in binding order.
+        static uint64_t MakeKey(const std::vector<const BufferLayout*>& streams);
+
+        // Returns the id of the VAO formatted for `streams`, creating it on first
+        // use. A hash hit is only shared after comparing the stored layouts, so
+        // colliding formats get VAOs of their own. Every Acquire must be paired
+        // with a Release of the returned id; 0 is never returned.
+        uint32_t Acquire(const std::vector<const BufferLayout*>& streams);
+        void     Release(uint32_t format);
+
+        // Makes the VAO of `format` current and attaches the given buffers, skipping
+        // the glBindVertexArray / glVertexArray*Buffer calls already in place.
+        void Bind(uint32_t format, const std::vector<uint32_t>& vbos,
+            const std::vector<uint32_t>& strides, uint32_t ibo);
+        void Unbind();
+
+        // Element buffer binds go through here: with a VAO current, a raw
+        // glBindBuffer(GL_ELEMENT_ARRAY_BUFFER) would change that shared VAO
+        // behind BoundIBO.
+        void BindIndexBuffer(uint32_t ibo);
+
+        // GL may hand a deleted buffer name out again; forget it so the next
+        // Bind re-attaches instead of trusting a stale binding.
+        void OnBufferDeleted(uint32_t id);
+
+        size_t VAOCount() const { return m_Entries.size(); }
+
+    private:
+        struct Entry {
+            uint32_t VAO = 0;
+            uint32_t RefCount = 0;
+            uint64_t Key = 0;
+            std::vector<BufferLayout> Streams; // the format, compared on a hash hit
+            std::vector<uint32_t> BoundVBOs;   // per binding, what the VAO points at now
+            uint32_t BoundIBO = 0;
+        };
+
+        std::unordered_map<uint32_t, Entry> m_Entries;           // by format id
+        std::unordered_multimap<uint64_t, uint32_t> m_ByKey;     // hash -> format ids
+        uint32_t m_NextFormat = 1;
+        uint32_t m_CurrentFormat = 0;
+    };
+
+} // namespace Engine
@@ -0,0 +1,26 @@
+#include "enginepch.h"
+#include "RecordingBuffer.h"
+#include "RecordingLog.h"
+
+namespace Engine {
+
+    RecordingVertexBuffer::RecordingVertexBuffer(const float* vertices, uint32_t size)
+        : m_Size(size) {
+        if (vertices && size) RecordingLog::Get().Record({ RecordedOp::UploadVertices, 0, size });
+    }
+
+    RecordingVertexBuffer::RecordingVertexBuffer(uint32_t size)
+        : m_Size(size) {
+    }
+
+    void RecordingVertexBuffer::SetData(const void*, uint32_t size, uint32_t offset) {
+        EG_CORE_CHECK(offset + size <= m_Size, "VertexBuffer::SetData out of range");
+        RecordingLog::Get().Record({ RecordedOp::UploadVertices, 0, size });
+    }
+
+    RecordingIndexBuffer::RecordingIndexBuffer(const uint32_t*, uint32_t count)
+        : m_Count(count) {
+        RecordingLog::Get().Record({ RecordedOp::UploadIndices, 0, (uint64_t)count * sizeof(uint32_t) });
+    }
+
+} // namespace Engine
@@ -0,0 +1,38 @@
+#pragma once
+#include "Engine/Renderer/Buffer.h"
+
+namespace Engine {
+
+    // Null buffers: contents are dropped, uploads are logged by size.
+    class RecordingVertexBuffer final : public VertexBuffer {
+    public:
+        RecordingVertexBuffer(const float* vertices, uint32_t size);
+        explicit RecordingVertexBuffer(uint32_t size); // dynamic
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        const BufferLayout& GetLayout() const override { return m_Layout; }
+        void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+        void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+        uint32_t GetSize() const override { return m_Size; }
+
+    private:
+        uint32_t m_Size;
+        BufferLayout m_Layout;
+    };
+
+    class RecordingIndexBuffer final : public IndexBuffer {
+    public:
+        RecordingIndexBuffer(const uint32_t* indices, uint32_t count);
+
+        void Bind() const override {}
+        void Unbind() const override {}
+        uint32_t GetCount() const override { return m_Count; }
+
+    private:
+        uint32_t m_Count;
+    };
+
+} // namespace Engine
@@ -0,0 +1,23 @@
+#pragma once
+#include <deque>
+#include "Engine/Renderer/FrameReadback.h"
+
+namespace Engine {
+
+    // Logs each copy as a Readback op and returns black images, in order.
+    class RecordingFrameReadback final : public FrameReadback {
+    public:
+        explicit RecordingFrameReadback(uint32_t slots) : m_Slots(slots) {}
+
+        bool Request(uint32_t width, uint32_t height, uint64_t tag, ReadbackSource source) override;
+        bool Poll(ReadbackImage& out, bool wait) override;
+        uint32_t InFlight() const override { return (uint32_t)m_Pending.size(); }
+
+    private:
+        struct Pending { uint32_t Width, Height; uint64_t Tag; ReadbackSource Source; };
+
+        uint32_t m_Slots;
+        std::deque<Pending> m_Pending;
+    };
+
+} // namespace Engine
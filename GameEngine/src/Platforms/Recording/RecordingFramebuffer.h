@@ -0,0 +1,23 @@
+#pragma once
+#include "Engine/Renderer/Framebuffer.h"
+
+namespace Engine {
+
+    // Size-only target; Bind/Unbind are logged as BindFramebuffer.
+    class RecordingFramebuffer final : public Framebuffer {
+    public:
+        explicit RecordingFramebuffer(const FramebufferSpec& spec);
+
+        void Bind() override;
+        void Unbind() override;
+        void Resize(uint32_t width, uint32_t height) override;
+
+        const FramebufferSpec& GetSpec() const override { return m_Spec; }
+        const Shared<Texture2D>& GetColorAttachment() const override { return m_Color; }
+
+    private:
+        FramebufferSpec   m_Spec;
+        Shared<Texture2D> m_Color;
+    };
+
+} // namespace Engine
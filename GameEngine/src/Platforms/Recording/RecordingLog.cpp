@@ -0,0 +1,91 @@
+#include "enginepch.h"
+#include "RecordingLog.h"
+#include <sstream>
+
+namespace Engine {
+
+    const char* ToString(RecordedOp op) {
+        switch (op) {
+        case RecordedOp::SetViewport:          return "SetViewport";
+        case RecordedOp::SetClearColor:        return "SetClearColor";
+        case RecordedOp::Clear:                return "Clear";
+        case RecordedOp::SetBlendMode:         return "SetBlendMode";
+        case RecordedOp::DrawIndexed:          return "DrawIndexed";
+        case RecordedOp::DrawIndexedInstanced: return "DrawIndexedInstanced";
+        case RecordedOp::BindShader:           return "BindShader";
+        case RecordedOp::BindVertexArray:      return "BindVertexArray";
+        case RecordedOp::BindTexture:          return "BindTexture";
+        case RecordedOp::BindFramebuffer:      return "BindFramebuffer";
+        case RecordedOp::SetUniform:           return "SetUniform";
+        case RecordedOp::UploadVertices:       return "UploadVertices";
+        case RecordedOp::UploadIndices:        return "UploadIndices";
+        case RecordedOp::UploadTexture:        return "UploadTexture";
+        case RecordedOp::Readback:             return "Readback";
+        }
+        return "?";
+    }
+
+    RecordingLog& RecordingLog::Get() {
+        static RecordingLog log;
+        return log;
+    }
+
+    void RecordingLog::Record(RecordedCommand cmd) {
+        cmd.Frame = m_Current.Index;
+        RecordedFrame& f = m_Current;
+
+        switch (cmd.Op) {
+        case RecordedOp::Clear:           f.Clears++; break;
+        case RecordedOp::DrawIndexed:
+            f.DrawCalls++;
+            f.Indices += cmd.Count;
+            break;
+        case RecordedOp::DrawIndexedInstanced:
+            f.DrawCalls++;
+            f.InstancedDrawCalls++;
+            f.Indices += cmd.Count * cmd.Instances;
+            break;
+        case RecordedOp::BindShader:      f.ShaderBinds++; break;
+        case RecordedOp::BindVertexArray: f.VertexArrayBinds++; break;
+        case RecordedOp::BindTexture:     f.TextureBinds++; break;
+        case RecordedOp::BindFramebuffer: f.FramebufferBinds++; break;
+        case RecordedOp::SetUniform:
+            f.UniformUploads++;
+            f.UniformBytes += cmd.Count;
+            break;
+        case RecordedOp::UploadVertices:  f.VertexBytes += cmd.Count; break;
+        case RecordedOp::UploadIndices:   f.IndexBytes += cmd.Count; break;
+        case RecordedOp::UploadTexture:   f.TextureBytes += cmd.Count; break;
+        case RecordedOp::Readback:        f.ReadbackBytes += cmd.Count; break;
+        default: break;
+        }
+
+        if (m_KeepCommands) m_Commands.push_back(std::move(cmd));
+    }
+
+    void RecordingLog::EndFrame() {
+        m_Frames.push_back(m_Current);
+        const uint64_t next = m_Current.Index + 1;
+        m_Current = {};
+        m_Current.Index = next;
+    }
+
+    std::string RecordingLog::Dump(uint64_t frame) const {
+        std::ostringstream out;
+        for (const RecordedCommand& c : m_Commands) {
+            if (c.Frame != frame) continue;
+            out << ToString(c.Op) << " count=" << c.Count;
+            if (c.Instances) out << " instances=" << c.Instances;
+            if (!c.Name.empty()) out << " '" << c.Name << "'";
+            out << '\n';
+        }
+        return out.str();
+    }
+
+    void RecordingLog::Reset() {
+        m_Commands.clear();
+        m_Frames.clear();
+        m_Current = {};
+    }
+
+} // namespace Engine
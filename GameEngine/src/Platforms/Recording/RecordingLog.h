@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+    enum class RecordedOp : uint8_t {
+        SetViewport, SetClearColor, Clear, SetBlendMode,
+        DrawIndexed, DrawIndexedInstanced,
+        BindShader, BindVertexArray, BindTexture, BindFramebuffer,
+        SetUniform,
+        UploadVertices, UploadIndices, UploadTexture,
+        Readback
+    };
+
+    const char* ToString(RecordedOp op);
+
+    struct RecordedCommand {
+        RecordedOp  Op;
+        uint64_t    Frame = 0;
+        uint64_t    Count = 0;     // indices (draws), bytes (uploads, uniforms, readbacks), slot (textures), blend mode
+        uint32_t    Instances = 0; // draws only
+        std::string Name;          // shader, uniform or render target name, when there is one
+    };
+
+    // Per-frame totals; the numbers performance budgets are written against.
+    struct RecordedFrame {
+        uint64_t Index = 0;
+        uint32_t DrawCalls = 0;          // including instanced ones
+        uint32_t InstancedDrawCalls = 0;
+        uint64_t Indices = 0;            // summed over instances
+        uint32_t Clears = 0;
+        uint32_t ShaderBinds = 0;
+        uint32_t VertexArrayBinds = 0;
+        uint32_t TextureBinds = 0;
+        uint32_t FramebufferBinds = 0;   // offscreen targets and back to default
+        uint32_t UniformUploads = 0;
+        uint64_t UniformBytes = 0;
+        uint64_t VertexBytes = 0;
+        uint64_t IndexBytes = 0;
+        uint64_t TextureBytes = 0;
+        uint64_t ReadbackBytes = 0;      // render target copies back to the CPU
+    };
+
+    // Everything the recording backend was asked to do. Frames are delimited
+    // by EndFrame(); the caller decides what a frame is.
+    class RecordingLog {
+    public:
+        static RecordingLog& Get();
+
+        void Record(RecordedCommand cmd);
+        // Closes the current frame and starts the next one.
+        void EndFrame();
+
+        const std::vector<RecordedCommand>& Commands() const { return m_Commands; }
+        const std::vector<RecordedFrame>&   Frames() const { return m_Frames; }
+        const RecordedFrame& CurrentFrame() const { return m_Current; }
+
+        // Commands are kept by default; aggregates are always kept.
+        void SetKeepCommands(bool keep) { m_KeepCommands = keep; }
+
+        // Human-readable listing of one frame's commands, for failure messages.
+        std::string Dump(uint64_t frame) const;
+
+        void Reset();
+
+    private:
+        std::vector<RecordedCommand> m_Commands;
+        std::vector<RecordedFrame>   m_Frames;
+        RecordedFrame m_Current;
+        bool m_KeepCommands = true;
+    };
+
+} // namespace Engine
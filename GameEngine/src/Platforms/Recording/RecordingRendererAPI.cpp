@@ -0,0 +1,33 @@
+#include "enginepch.h"
+#include "RecordingRendererAPI.h"
+#include "RecordingLog.h"
+
+namespace Engine {
+
+    void RecordingRendererAPI::SetViewport(uint32_t, uint32_t, uint32_t w, uint32_t h) {
+        RecordingLog::Get().Record({ RecordedOp::SetViewport, 0, (uint64_t)w * h });
+    }
+
+    void RecordingRendererAPI::SetClearColor(const glm::vec4&) {
+        RecordingLog::Get().Record({ RecordedOp::SetClearColor });
+    }
+
+    void RecordingRendererAPI::Clear() {
+        RecordingLog::Get().Record({ RecordedOp::Clear });
+    }
+
+    void RecordingRendererAPI::SetBlendMode(BlendMode mode) {
+        RecordingLog::Get().Record({ RecordedOp::SetBlendMode, 0, (uint64_t)mode });
+    }
+
+    void RecordingRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& va, uint32_t indexCount) {
+        const uint32_t count = indexCount ? indexCount : va->GetIndexBuffer()->GetCount();
+        RecordingLog::Get().Record({ RecordedOp::DrawIndexed, 0, count, 1 });
+    }
+
+    void RecordingRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& va,
+        uint32_t instanceCount, uint32_t) {
+        RecordingLog::Get().Record({ RecordedOp::DrawIndexedInstanced, 0, va->GetIndexBuffer()->GetCount(), instanceCount });
+    }
+
+} // namespace Engine
@@ -0,0 +1,22 @@
+#pragma once
+#include "Engine/Renderer/RendererAPI.h"
+
+namespace Engine {
+
+    // Null backend: executes nothing and appends every call to
+    // RecordingLog::Get(), so tests can assert draw-call and upload budgets
+    // without a GPU.
+    class RecordingRendererAPI final : public RendererAPI {
+    public:
+        void Init() override {}
+        void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) override;
+        void SetClearColor(const glm::vec4& color) override;
+        void Clear() override;
+        void SetBlendMode(BlendMode mode) override;
+        void SetOverdrawCounting(bool) override {}
+        void DrawIndexed(const std::shared_ptr<VertexArray>& va, uint32_t indexCount = 0) override;
+        void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& va, uint32_t instanceCount,
+            uint32_t baseInstance = 0) override;
+    };
+
+} // namespace Engine
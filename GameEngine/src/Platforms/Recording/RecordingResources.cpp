@@ -0,0 +1,96 @@
+#include "enginepch.h"
+#include "RecordingVertexArray.h"
+#include "RecordingTexture.h"
+#include "RecordingShader.h"
+#include "RecordingFramebuffer.h"
+#include "RecordingFrameReadback.h"
+#include "RecordingLog.h"
+#include "stb_image.h"
+#include <filesystem>
+
+namespace Engine {
+
+    void RecordingVertexArray::Bind() const {
+        RecordingLog::Get().Record({ RecordedOp::BindVertexArray });
+    }
+
+    RecordingTexture2D::RecordingTexture2D(const std::string& path) {
+        int w = 0, h = 0, ch = 0;
+        if (stbi_info(path.c_str(), &w, &h, &ch)) {
+            m_W = (uint32_t)w;
+            m_H = (uint32_t)h;
+        }
+        RecordingLog::Get().Record({ RecordedOp::UploadTexture, 0, (uint64_t)m_W * m_H * 4 });
+    }
+
+    void RecordingTexture2D::SetData(void*, uint32_t size) {
+        RecordingLog::Get().Record({ RecordedOp::UploadTexture, 0, size });
+    }
+
+    void RecordingTexture2D::Bind(uint32_t slot) const {
+        RecordingLog::Get().Record({ RecordedOp::BindTexture, 0, slot });
+    }
+
+    RecordingFramebuffer::RecordingFramebuffer(const FramebufferSpec& spec)
+        : m_Spec(spec), m_Color(MakeShared<RecordingTexture2D>(spec.Width, spec.Height)) {
+    }
+
+    void RecordingFramebuffer::Bind() {
+        RecordingLog::Get().Record({ RecordedOp::BindFramebuffer, 0, 0, 0,
+            "offscreen " + std::to_string(m_Spec.Width) + "x" + std::to_string(m_Spec.Height) });
+    }
+
+    void RecordingFramebuffer::Unbind() {
+        RecordingLog::Get().Record({ RecordedOp::BindFramebuffer, 0, 0, 0, "previous" });
+    }
+
+    void RecordingFramebuffer::Resize(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0) return;
+        m_Spec.Width = width;
+        m_Spec.Height = height;
+        m_Color = MakeShared<RecordingTexture2D>(width, height);
+    }
+
+    bool RecordingFrameReadback::Request(uint32_t width, uint32_t height, uint64_t tag, ReadbackSource source) {
+        if (m_Pending.size() >= m_Slots || width == 0 || height == 0) return false;
+        const uint64_t bpp = source == ReadbackSource::Color ? 4 : 1;
+        RecordingLog::Get().Record({ RecordedOp::Readback, 0, (uint64_t)width * height * bpp });
+        m_Pending.push_back({ width, height, tag, source });
+        return true;
+    }
+
+    bool RecordingFrameReadback::Poll(ReadbackImage& out, bool) {
+        if (m_Pending.empty()) return false;
+        const Pending p = m_Pending.front();
+        m_Pending.pop_front();
+        out.Width = p.Width;
+        out.Height = p.Height;
+        out.Tag = p.Tag;
+        out.Source = p.Source;
+        out.Pixels.assign((size_t)p.Width * p.Height * out.BytesPerPixel(), 0);
+        return true;
+    }
+
+    RecordingShader::RecordingShader(const std::string& filepath)
+        : m_Name(std::filesystem::path(filepath).stem().string()),
+          m_Attributes(ParseVertexInputs(ReadVertexStage(filepath))) {
+    }
+
+    RecordingShader::RecordingShader(const std::string& name, const std::string& vs, const std::string&)
+        : m_Name(name), m_Attributes(ParseVertexInputs(vs)) {
+    }
+
+    void RecordingShader::Binding() const {
+        RecordingLog::Get().Record({ RecordedOp::BindShader, 0, 0, 0, m_Name });
+    }
+
+    void RecordingShader::Upload(const std::string& uniform, uint64_t bytes) const {
+        RecordingLog::Get().Record({ RecordedOp::SetUniform, 0, bytes, 0, uniform });
+    }
+
+    int RecordingShader::GetAttributeLocation(const std::string& name) const {
+        auto it = m_Attributes.find(name);
+        return it != m_Attributes.end() ? it->second : -1;
+    }
+
+} // namespace Engine
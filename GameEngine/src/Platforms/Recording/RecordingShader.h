@@ -0,0 +1,37 @@
+#pragma once
+#include "Engine/Renderer/Shader.h"
+#include <unordered_map>
+
+namespace Engine {
+
+    // Logs binds and uniform uploads (with their size) instead of compiling.
+    // Vertex inputs are still reflected from the source so the renderer's
+    // instancing decisions match the GL backend.
+    class RecordingShader final : public Shader {
+    public:
+        explicit RecordingShader(const std::string& filepath);
+        RecordingShader(const std::string& name, const std::string& vs, const std::string& fs);
+
+        void Binding() const override;
+        void Unbinding() const override {}
+
+    protected:
+        void UploadInt(const std::string& n, int) override { Upload(n, sizeof(int)); }
+        void UploadIntArray(const std::string& n, const int*, uint32_t count) override { Upload(n, count * sizeof(int)); }
+        void UploadFloat(const std::string& n, float) override { Upload(n, sizeof(float)); }
+        void UploadFloat3(const std::string& n, const glm::vec3&) override { Upload(n, sizeof(glm::vec3)); }
+        void UploadFloat4(const std::string& n, const glm::vec4&) override { Upload(n, sizeof(glm::vec4)); }
+        void UploadMat4(const std::string& n, const glm::mat4&) override { Upload(n, sizeof(glm::mat4)); }
+
+    public:
+        const std::string& GetName() const override { return m_Name; }
+        int GetAttributeLocation(const std::string& name) const override;
+
+    private:
+        void Upload(const std::string& uniform, uint64_t bytes) const;
+
+        std::string m_Name;
+        std::unordered_map<std::string, int> m_Attributes;
+    };
+
+} // namespace Engine
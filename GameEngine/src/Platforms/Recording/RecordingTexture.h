@@ -0,0 +1,24 @@
+#pragma once
+#include "Engine/Renderer/Texture.h"
+#include <string>
+
+namespace Engine {
+
+    // Keeps only the size. Loading from a file reads the image header, so
+    // width and height match what the GPU backends would report.
+    class RecordingTexture2D final : public Texture2D {
+    public:
+        RecordingTexture2D(uint32_t w, uint32_t h) : m_W(w), m_H(h) {}
+        explicit RecordingTexture2D(const std::string& path);
+
+        uint32_t GetWidth()  const override { return m_W; }
+        uint32_t GetHeight() const override { return m_H; }
+
+        void SetData(void* data, uint32_t size) override;
+        void Bind(uint32_t slot = 0) const override;
+
+    private:
+        uint32_t m_W = 1, m_H = 1;
+    };
+
+} // namespace Engine
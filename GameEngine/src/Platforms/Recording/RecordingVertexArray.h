@@ -0,0 +1,23 @@
+#pragma once
+#include "Engine/Renderer/VertexArray.h"
+#include <vector>
+
+namespace Engine {
+
+    class RecordingVertexArray final : public VertexArray {
+    public:
+        void Bind() const override;
+        void Unbind() const override {}
+
+        void AddVertexBuffer(const Shared<VertexBuffer>& vb) override { m_VBs.push_back(vb); }
+        void SetIndexBuffer(const Shared<IndexBuffer>& ib) override { m_IB = ib; }
+
+        const std::vector<Shared<VertexBuffer>>& GetVertexBuffers() const override { return m_VBs; }
+        const Shared<IndexBuffer>& GetIndexBuffer() const override { return m_IB; }
+
+    private:
+        std::vector<Shared<VertexBuffer>> m_VBs;
+        Shared<IndexBuffer> m_IB;
+    };
+
+} // namespace Engine
@@ -0,0 +1,26 @@
+#include "enginepch.h"
+#include "SoftwareBuffer.h"
+#include <cstring>
+
+namespace Engine {
+
+    SoftwareVertexBuffer::SoftwareVertexBuffer(const float* vertices, uint32_t size)
+        : m_Data(size) {
+        if (vertices && size) std::memcpy(m_Data.data(), vertices, size);
+    }
+
+    SoftwareVertexBuffer::SoftwareVertexBuffer(uint32_t size)
+        : m_Data(size) {
+    }
+
+    void SoftwareVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+        EG_CORE_CHECK(offset + size <= m_Data.size(), "VertexBuffer::SetData out of range");
+        if (offset + size > m_Data.size()) return;
+        std::memcpy(m_Data.data() + offset, data, size);
+    }
+
+    SoftwareIndexBuffer::SoftwareIndexBuffer(const uint32_t* indices, uint32_t count)
+        : m_Indices(indices, indices + count) {
+    }
+
+} // namespace Engine
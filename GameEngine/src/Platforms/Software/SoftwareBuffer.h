@@ -0,0 +1,44 @@
+#pragma once
+#include "Engine/Renderer/Buffer.h"
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+    // Vertex data kept in system memory; the rasterizer reads it directly.
+    class SoftwareVertexBuffer final : public VertexBuffer {
+    public:
+        SoftwareVertexBuffer(const float* vertices, uint32_t size);
+        explicit SoftwareVertexBuffer(uint32_t size); // dynamic
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        const BufferLayout& GetLayout() const override { return m_Layout; }
+        void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+        void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+        uint32_t GetSize() const override { return (uint32_t)m_Data.size(); }
+
+        const uint8_t* Data() const { return m_Data.data(); }
+
+    private:
+        std::vector<uint8_t> m_Data;
+        BufferLayout m_Layout;
+    };
+
+    class SoftwareIndexBuffer final : public IndexBuffer {
+    public:
+        SoftwareIndexBuffer(const uint32_t* indices, uint32_t count);
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        uint32_t GetCount() const override { return (uint32_t)m_Indices.size(); }
+        const uint32_t* Data() const { return m_Indices.data(); }
+
+    private:
+        std::vector<uint32_t> m_Indices;
+    };
+
+} // namespace Engine
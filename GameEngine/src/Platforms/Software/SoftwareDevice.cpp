@@ -0,0 +1,471 @@
+#include "enginepch.h"
+#include "SoftwareDevice.h"
+#include "SoftwareBuffer.h"
+#include "SoftwareShader.h"
+#include "SoftwareTexture.h"
+#include "SoftwareVertexArray.h"
+#include "Engine/Core/ThreadPool.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EG_SOFTWARE_SSE2 1
+#include <emmintrin.h>
+#else
+#define EG_SOFTWARE_SSE2 0
+#endif
+
+namespace Engine {
+
+    // Screen-space triangle ready for rasterization.
+    //
+    // Edge i (opposite vertex i) is E_i(p) = A_i * (p.x - OX_i) + B_i * (p.y - OY_i),
+    // positive inside. Both triangles sharing an edge evaluate it from the same
+    // origin with negated A/B, so their results are exact negatives of each
+    // other and every pixel center on the edge belongs to exactly one of them.
+    struct SoftwareDevice::Triangle {
+        float A[3], B[3], OX[3], OY[3];
+        bool  TopLeft[3];
+        float InvArea;
+        int   MinX, MinY, MaxX, MaxY; // inclusive pixel bounds
+
+        float     Z[3];
+        glm::vec4 Color[3];
+        glm::vec2 UV[3];
+        float     Tiling;
+        const SoftwareTexture2D* Texture; // null = untextured
+        RendererAPI::BlendMode   Blend;
+        bool                     CountOverdraw;
+    };
+
+    SoftwareDevice& SoftwareDevice::Get() {
+        static SoftwareDevice device;
+        return device;
+    }
+
+    SoftwareDevice::SoftwareDevice() = default;
+    SoftwareDevice::~SoftwareDevice() = default;
+
+    void SoftwareDevice::Reset() {
+        if (m_Redirected) std::swap(m_Target, *m_Redirected);
+        m_Redirected = nullptr;
+        m_Triangles = {};
+        m_TileBins = {};
+        m_Target = {};
+        m_TilesX = m_TilesY = 0;
+        m_ViewportX = m_ViewportY = m_ViewportW = m_ViewportH = 0;
+        m_Shader = nullptr;
+        m_VertexArray = nullptr;
+        m_Textures = {};
+        m_BlendMode = RendererAPI::BlendMode::Alpha;
+        m_CountOverdraw = false;
+        m_Stats = {};
+        m_Pool.reset();
+    }
+
+    void SoftwareDevice::SetThreadCount(uint32_t threads) {
+        if (threads == m_ThreadCount && m_Pool) return;
+        Flush();
+        m_ThreadCount = threads;
+        m_Pool.reset();
+    }
+
+    void SoftwareDevice::BindTexture(uint32_t slot, const SoftwareTexture2D* tex) {
+        EG_CORE_CHECK(slot < MaxTextureSlots, "Texture slot out of range");
+        if (slot < MaxTextureSlots) m_Textures[slot] = tex;
+    }
+
+    void SoftwareDevice::OnTextureDestroyed(const SoftwareTexture2D* tex) {
+        if (!m_Triangles.empty()) Flush();
+        for (auto& t : m_Textures)
+            if (t == tex) t = nullptr;
+    }
+
+    void SoftwareDevice::ResizeTargets(uint32_t w, uint32_t h) {
+        if (w == m_Target.Width && h == m_Target.Height) return;
+        Flush();
+        m_Target.Width = w;
+        m_Target.Height = h;
+        m_Target.Color.assign((size_t)w * h, 0xff000000u);
+        m_Target.Depth.assign((size_t)w * h, 1.0f);
+        m_Target.Stencil.assign((size_t)w * h, 0);
+        ResetTiles();
+    }
+
+    void SoftwareDevice::ResetTiles() {
+        m_TilesX = (m_Target.Width + TileSize - 1) / TileSize;
+        m_TilesY = (m_Target.Height + TileSize - 1) / TileSize;
+        m_TileBins.assign((size_t)m_TilesX * m_TilesY, {});
+    }
+
+    void SoftwareDevice::SetRenderTarget(SoftwareFramebuffer* target) {
+        if (target == m_Redirected) return;
+        Flush();
+        if (m_Redirected) std::swap(m_Target, *m_Redirected);
+        m_Redirected = target;
+        if (target) std::swap(m_Target, *target);
+        ResetTiles();
+    }
+
+    void SoftwareDevice::SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+        Flush();
+        m_ViewportX = x; m_ViewportY = y; m_ViewportW = w; m_ViewportH = h;
+        if (!m_Redirected) {
+            ResizeTargets(x + w, y + h);
+            return;
+        }
+        // Offscreen targets keep their size; keep the viewport inside
+        m_ViewportX = std::min(x, m_Target.Width);
+        m_ViewportY = std::min(y, m_Target.Height);
+        m_ViewportW = std::min(w, m_Target.Width - m_ViewportX);
+        m_ViewportH = std::min(h, m_Target.Height - m_ViewportY);
+    }
+
+    static uint32_t Pack(const glm::vec4& c) {
+        auto ch = [](float v) { return (uint32_t)(glm::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f); };
+        return ch(c.r) | (ch(c.g) << 8) | (ch(c.b) << 16) | (ch(c.a) << 24);
+    }
+
+    static glm::vec4 Unpack(uint32_t p) {
+        return glm::vec4((float)(p & 0xff), (float)((p >> 8) & 0xff),
+            (float)((p >> 16) & 0xff), (float)(p >> 24)) * (1.0f / 255.0f);
+    }
+
+    void SoftwareDevice::Clear() {
+        EG_PROFILE_FUNCTION();
+        // Pending triangles were drawn before the clear
+        Flush();
+        std::fill(m_Target.Color.begin(), m_Target.Color.end(), Pack(m_ClearColor));
+        std::fill(m_Target.Depth.begin(), m_Target.Depth.end(), 1.0f);
+        std::fill(m_Target.Stencil.begin(), m_Target.Stencil.end(), (uint8_t)0);
+    }
+
+    const SoftwareFramebuffer& SoftwareDevice::Framebuffer() {
+        Flush();
+        return m_Target;
+    }
+
+    // ------------------------------------------------------------ vertex stage
+
+    namespace {
+
+        // One vertex input resolved to memory
+        struct AttributeStream {
+            const uint8_t* Base = nullptr;
+            uint32_t Stride = 0;
+            uint32_t Divisor = 0;
+            uint32_t Components = 0;
+
+            bool Present() const { return Base != nullptr; }
+
+            const float* At(uint32_t vertex, uint32_t instance) const {
+                const uint32_t element = Divisor ? instance / Divisor : vertex;
+                return reinterpret_cast<const float*>(Base + (size_t)element * Stride);
+            }
+        };
+
+        struct VertexInputs {
+            AttributeStream Position, Color, TexCoord, TexIndex, Tiling, Transform;
+        };
+
+        VertexInputs ResolveInputs(const VertexArray& va) {
+            VertexInputs in;
+            for (const auto& vb : va.GetVertexBuffers()) {
+                const auto* svb = static_cast<const SoftwareVertexBuffer*>(vb.get());
+                const BufferLayout& layout = svb->GetLayout();
+                for (const BufferElement& e : layout) {
+                    AttributeStream s{ svb->Data() + e.Offset, layout.Stride(), layout.Divisor(), e.GetComponentCount() };
+                    if      (e.Name == "a_Position")     in.Position = s;
+                    else if (e.Name == "a_Color")        in.Color = s;
+                    else if (e.Name == "a_TexCoord")     in.TexCoord = s;
+                    else if (e.Name == "a_TexIndex")     in.TexIndex = s;
+                    else if (e.Name == "a_TilingFactor") in.Tiling = s;
+                    else if (e.Name == "a_Transform")    in.Transform = s;
+                }
+            }
+            return in;
+        }
+
+        struct ShadedVertex {
+            glm::vec4 Clip;
+            glm::vec4 Color;
+            glm::vec2 UV;
+            float     TexIndex;
+            float     Tiling;
+        };
+
+    }
+
+    void SoftwareDevice::DrawIndexed(const VertexArray& va, uint32_t indexCount,
+        uint32_t instanceCount, uint32_t baseInstance) {
+        EG_PROFILE_FUNCTION();
+        EG_CORE_CHECK(m_Shader, "Draw without a bound shader");
+        if (!m_Shader || m_Target.Width == 0) return;
+
+        const auto* ib = static_cast<const SoftwareIndexBuffer*>(va.GetIndexBuffer().get());
+        if (!ib) return;
+        const uint32_t count = indexCount ? std::min(indexCount, ib->GetCount()) : ib->GetCount();
+        const uint32_t* indices = ib->Data();
+
+        const VertexInputs in = ResolveInputs(va);
+        EG_CORE_CHECK(in.Position.Present(), "Vertex array has no a_Position");
+        if (!in.Position.Present()) return;
+
+        const glm::mat4 viewProj = m_Shader->Mat4("u_ViewProjection");
+        const glm::mat4 model = m_Shader->Mat4("u_Transform");
+        const glm::vec4 tint = m_Shader->Vec4("u_Color");
+        const float uniformTiling = m_Shader->Float("u_TilingFactor");
+        const int singleSampler = m_Shader->Int("u_Texture");
+        const std::vector<int>* samplers = m_Shader->IntArray("u_Textures");
+
+        auto textureFor = [&](float texIndex) -> const SoftwareTexture2D* {
+            if (!in.TexCoord.Present()) return nullptr;
+            int slot = singleSampler;
+            if (in.TexIndex.Present()) {
+                const int idx = (int)texIndex;
+                slot = (samplers && idx >= 0 && idx < (int)samplers->size()) ? (*samplers)[idx] : idx;
+            }
+            return (slot >= 0 && slot < (int)MaxTextureSlots) ? m_Textures[slot] : nullptr;
+        };
+
+        auto shade = [&](uint32_t vertex, uint32_t instance) {
+            ShadedVertex v;
+            const float* p = in.Position.At(vertex, instance);
+            const glm::vec4 local(p[0], p[1], in.Position.Components > 2 ? p[2] : 0.0f, 1.0f);
+
+            glm::mat4 m = model;
+            if (in.Transform.Present()) {
+                const float* t = in.Transform.At(vertex, instance);
+                for (int c = 0; c < 4; ++c)
+                    m[c] = glm::vec4(t[c * 4 + 0], t[c * 4 + 1], t[c * 4 + 2], t[c * 4 + 3]);
+            }
+            v.Clip = viewProj * (m * local);
+
+            v.Color = tint;
+            if (in.Color.Present()) {
+                const float* c = in.Color.At(vertex, instance);
+                v.Color *= glm::vec4(c[0], c[1], c[2], in.Color.Components > 3 ? c[3] : 1.0f);
+            }
+            v.UV = in.TexCoord.Present() ? glm::vec2(in.TexCoord.At(vertex, instance)[0], in.TexCoord.At(vertex, instance)[1]) : glm::vec2(0.0f);
+            v.TexIndex = in.TexIndex.Present() ? in.TexIndex.At(vertex, instance)[0] : 0.0f;
+            v.Tiling = in.Tiling.Present() ? in.Tiling.At(vertex, instance)[0] : uniformTiling;
+            return v;
+        };
+
+        const float vx = (float)m_ViewportX, vy = (float)m_ViewportY;
+        const float vw = (float)m_ViewportW, vh = (float)m_ViewportH;
+
+        for (uint32_t inst = 0; inst < instanceCount; ++inst) {
+            const uint32_t instance = baseInstance + inst;
+            for (uint32_t i = 0; i + 2 < count; i += 3) {
+                ShadedVertex v[3] = { shade(indices[i], instance), shade(indices[i + 1], instance), shade(indices[i + 2], instance) };
+
+                // No near-plane clipping: the 2D feature set never crosses w = 0
+                if (v[0].Clip.w <= 0.0f || v[1].Clip.w <= 0.0f || v[2].Clip.w <= 0.0f) continue;
+
+                glm::vec2 s[3];
+                float z[3];
+                for (int k = 0; k < 3; ++k) {
+                    const glm::vec3 ndc = glm::vec3(v[k].Clip) / v[k].Clip.w;
+                    // Snap to 1/16 pixel like GL's subpixel precision
+                    s[k].x = std::round((vx + (ndc.x * 0.5f + 0.5f) * vw) * 16.0f) / 16.0f;
+                    s[k].y = std::round((vy + (ndc.y * 0.5f + 0.5f) * vh) * 16.0f) / 16.0f;
+                    z[k] = ndc.z * 0.5f + 0.5f;
+                }
+
+                const float area2 = (s[1].x - s[0].x) * (s[2].y - s[0].y) - (s[2].x - s[0].x) * (s[1].y - s[0].y);
+                if (area2 == 0.0f) continue;
+
+                // No face culling (GL default): make the winding counter-clockwise
+                int order[3] = { 0, 1, 2 };
+                if (area2 < 0.0f) std::swap(order[1], order[2]);
+
+                Triangle tri;
+                const float minX = std::min({ s[0].x, s[1].x, s[2].x }), maxX = std::max({ s[0].x, s[1].x, s[2].x });
+                const float minY = std::min({ s[0].y, s[1].y, s[2].y }), maxY = std::max({ s[0].y, s[1].y, s[2].y });
+                // Clip to the viewport while still float: far off-screen
+                // coordinates do not fit an int and would index past the tile bins
+                if (!std::isfinite(minX + maxX + minY + maxY)) continue;
+                const float x0 = std::max(std::floor(minX), (float)m_ViewportX);
+                const float y0 = std::max(std::floor(minY), (float)m_ViewportY);
+                const float x1 = std::min(std::ceil(maxX), (float)(m_ViewportX + m_ViewportW));
+                const float y1 = std::min(std::ceil(maxY), (float)(m_ViewportY + m_ViewportH));
+                if (x0 >= x1 || y0 >= y1) continue;
+                tri.MinX = (int)x0;
+                tri.MinY = (int)y0;
+                tri.MaxX = (int)x1 - 1;
+                tri.MaxY = (int)y1 - 1;
+
+                for (int e = 0; e < 3; ++e) {
+                    // Edge opposite vertex e runs a -> b
+                    const glm::vec2 a = s[order[(e + 1) % 3]];
+                    const glm::vec2 b = s[order[(e + 2) % 3]];
+
+                    // Canonical origin: the lexicographically smaller endpoint
+                    const bool aFirst = a.x < b.x || (a.x == b.x && a.y < b.y);
+                    const glm::vec2 o = aFirst ? a : b, d = aFirst ? b : a;
+                    const float sign = aFirst ? 1.0f : -1.0f;
+
+                    tri.A[e] = sign * (o.y - d.y);
+                    tri.B[e] = sign * (d.x - o.x);
+                    tri.OX[e] = o.x;
+                    tri.OY[e] = o.y;
+                    tri.TopLeft[e] = tri.A[e] > 0.0f || (tri.A[e] == 0.0f && tri.B[e] < 0.0f);
+                }
+                tri.InvArea = 1.0f / std::fabs(area2);
+
+                for (int k = 0; k < 3; ++k) {
+                    const ShadedVertex& sv = v[order[k]];
+                    tri.Z[k] = z[order[k]];
+                    tri.Color[k] = sv.Color;
+                    tri.UV[k] = sv.UV;
+                }
+                // Flat inputs come from the provoking (last) vertex, as in GL
+                tri.Tiling = v[2].Tiling;
+                tri.Texture = textureFor(v[2].TexIndex);
+                tri.Blend = m_BlendMode;
+                tri.CountOverdraw = m_CountOverdraw;
+
+                BinTriangle(tri);
+            }
+        }
+    }
+
+    void SoftwareDevice::BinTriangle(const Triangle& tri) {
+        const uint32_t index = (uint32_t)m_Triangles.size();
+        m_Triangles.push_back(tri);
+        m_Stats.Triangles++;
+
+        const uint32_t tx0 = (uint32_t)tri.MinX / TileSize, tx1 = (uint32_t)tri.MaxX / TileSize;
+        const uint32_t ty0 = (uint32_t)tri.MinY / TileSize, ty1 = (uint32_t)tri.MaxY / TileSize;
+        for (uint32_t ty = ty0; ty <= ty1; ++ty)
+            for (uint32_t tx = tx0; tx <= tx1; ++tx)
+                m_TileBins[ty * m_TilesX + tx].push_back(index);
+    }
+
+    // ------------------------------------------------------------ raster stage
+
+    // Coverage of pixels [x, x + 4) on row y; writes the edge values for
+    // interpolation and returns one bit per covered pixel.
+    static inline int Coverage4(const float A[3], const float B[3], const float OX[3], const float OY[3],
+        const bool topLeft[3], int x, int y, float out[3][4]) {
+        const float py = (float)y + 0.5f;
+#if EG_SOFTWARE_SSE2
+        const __m128 px = _mm_add_ps(_mm_set1_ps((float)x + 0.5f), _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f));
+        const __m128 zero = _mm_setzero_ps();
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int e = 0; e < 3; ++e) {
+            const __m128 dx = _mm_sub_ps(px, _mm_set1_ps(OX[e]));
+            const __m128 ev = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(A[e]), dx), _mm_set1_ps(B[e] * (py - OY[e])));
+            inside = _mm_and_ps(inside, topLeft[e] ? _mm_cmpge_ps(ev, zero) : _mm_cmpgt_ps(ev, zero));
+            _mm_storeu_ps(out[e], ev);
+        }
+        return _mm_movemask_ps(inside);
+#else
+        int mask = 0;
+        for (int l = 0; l < 4; ++l) {
+            const float px = (float)(x + l) + 0.5f;
+            bool in = true;
+            for (int e = 0; e < 3; ++e) {
+                const float ev = A[e] * (px - OX[e]) + B[e] * (py - OY[e]);
+                out[e][l] = ev;
+                in = in && (topLeft[e] ? ev >= 0.0f : ev > 0.0f);
+            }
+            mask |= in ? (1 << l) : 0;
+        }
+        return mask;
+#endif
+    }
+
+    uint64_t SoftwareDevice::RasterizeTile(uint32_t tileIndex) {
+        const auto& bin = m_TileBins[tileIndex];
+        if (bin.empty()) return 0;
+
+        const int tileX0 = (int)((tileIndex % m_TilesX) * TileSize);
+        const int tileY0 = (int)((tileIndex / m_TilesX) * TileSize);
+        const int tileX1 = std::min(tileX0 + (int)TileSize, (int)m_Target.Width) - 1;
+        const int tileY1 = std::min(tileY0 + (int)TileSize, (int)m_Target.Height) - 1;
+        const uint32_t width = m_Target.Width;
+
+        uint64_t fragments = 0;
+        float ev[3][4];
+
+        for (uint32_t triIndex : bin) {
+            const Triangle& t = m_Triangles[triIndex];
+            const int x0 = std::max(t.MinX, tileX0), x1 = std::min(t.MaxX, tileX1);
+            const int y0 = std::max(t.MinY, tileY0), y1 = std::min(t.MaxY, tileY1);
+
+            for (int y = y0; y <= y1; ++y) {
+                uint32_t* colorRow = &m_Target.Color[(size_t)y * width];
+                float*    depthRow = &m_Target.Depth[(size_t)y * width];
+                uint8_t*  stencilRow = &m_Target.Stencil[(size_t)y * width];
+
+                for (int x = x0; x <= x1; x += 4) {
+                    int mask = Coverage4(t.A, t.B, t.OX, t.OY, t.TopLeft, x, y, ev);
+                    if (x + 4 > x1 + 1) mask &= (1 << (x1 + 1 - x)) - 1;
+
+                    while (mask) {
+                        const int lane = mask & 1 ? 0 : mask & 2 ? 1 : mask & 4 ? 2 : 3;
+                        mask &= mask - 1;
+                        const int px = x + lane;
+
+                        const float l0 = ev[0][lane] * t.InvArea;
+                        const float l1 = ev[1][lane] * t.InvArea;
+                        const float l2 = 1.0f - l0 - l1;
+
+                        const float z = l0 * t.Z[0] + l1 * t.Z[1] + l2 * t.Z[2];
+                        if (z < 0.0f || z > 1.0f || !(z < depthRow[px])) continue;
+
+                        glm::vec4 src = t.Color[0] * l0 + t.Color[1] * l1 + t.Color[2] * l2;
+                        if (t.Texture) {
+                            const glm::vec2 uv = (t.UV[0] * l0 + t.UV[1] * l1 + t.UV[2] * l2) * t.Tiling;
+                            src *= t.Texture->Sample(uv);
+                        }
+
+                        const glm::vec4 dst = Unpack(colorRow[px]);
+                        glm::vec4 out;
+                        switch (t.Blend) {
+                        case RendererAPI::BlendMode::AlphaAccumulate:
+                            out = glm::vec4(glm::vec3(src) * src.a + glm::vec3(dst) * (1.0f - src.a),
+                                src.a + dst.a * (1.0f - src.a));
+                            break;
+                        case RendererAPI::BlendMode::Premultiplied:
+                            out = src + dst * (1.0f - src.a);
+                            break;
+                        case RendererAPI::BlendMode::Opaque:
+                            out = src;
+                            break;
+                        default: // SRC_ALPHA, ONE_MINUS_SRC_ALPHA on all four channels
+                            out = src * src.a + dst * (1.0f - src.a);
+                            break;
+                        }
+                        colorRow[px] = Pack(out);
+                        depthRow[px] = z;
+                        // GL_INCR saturates
+                        if (t.CountOverdraw && stencilRow[px] != 0xff) stencilRow[px]++;
+                        fragments++;
+                    }
+                }
+            }
+        }
+
+        return fragments;
+    }
+
+    void SoftwareDevice::Flush() {
+        if (m_Triangles.empty()) return;
+        EG_PROFILE_FUNCTION();
+
+        if (!m_Pool) m_Pool = std::make_unique<ThreadPool>(m_ThreadCount);
+        std::atomic<uint64_t> fragments{ 0 };
+        m_Pool->ParallelFor((uint32_t)m_TileBins.size(), [&](uint32_t tile) {
+            fragments.fetch_add(RasterizeTile(tile), std::memory_order_relaxed);
+        });
+        m_Stats.Fragments += fragments.load();
+
+        for (auto& bin : m_TileBins) bin.clear();
+        m_Triangles.clear();
+        m_Stats.Flushes++;
+    }
+
+} // namespace Engine
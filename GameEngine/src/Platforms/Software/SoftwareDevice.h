@@ -0,0 +1,117 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Engine/Renderer/RendererAPI.h"
+
+namespace Engine {
+
+    class VertexArray;
+    class SoftwareShader;
+    class SoftwareTexture2D;
+    class SoftwareVertexArray;
+    class ThreadPool;
+
+    // Color (RGBA8, 0xAABBGGRR), depth and stencil, row 0 at the bottom
+    // like GL. The stencil only ever holds overdraw counts.
+    struct SoftwareFramebuffer {
+        uint32_t Width = 0, Height = 0;
+        std::vector<uint32_t> Color;
+        std::vector<float>    Depth;
+        std::vector<uint8_t>  Stencil;
+    };
+
+    // CPU implementation of the 2D feature set: indexed triangles, bilinear
+    // textures with tiling and tint, depth test (GL_LESS) and the blend
+    // modes of RendererAPI::BlendMode.
+    //
+    // Draws only transform and bin triangles into 64x64 tiles. Flush then
+    // rasterizes the tiles in parallel; each tile walks its triangles in
+    // submission order, so blending matches GL. Coverage is evaluated with
+    // edge functions four pixels at a time (SSE2 where available).
+    class SoftwareDevice {
+    public:
+        static constexpr uint32_t TileSize = 64;
+        static constexpr uint32_t MaxTextureSlots = 32;
+
+        static SoftwareDevice& Get();
+
+        void BindShader(const SoftwareShader* shader) { m_Shader = shader; }
+        void OnShaderDestroyed(const SoftwareShader* shader) { if (m_Shader == shader) m_Shader = nullptr; }
+        void BindVertexArray(const SoftwareVertexArray* va) { m_VertexArray = va; }
+        void BindTexture(uint32_t slot, const SoftwareTexture2D* tex);
+
+        void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+        void SetClearColor(const glm::vec4& color) { m_ClearColor = color; }
+        // Applies to triangles drawn from now on
+        void SetBlendMode(RendererAPI::BlendMode mode) { m_BlendMode = mode; }
+        // Applies to triangles drawn from now on
+        void SetOverdrawCounting(bool enabled) { m_CountOverdraw = enabled; }
+        void Clear();
+
+        void DrawIndexed(const VertexArray& va, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance);
+
+        // Rasterizes everything binned so far.
+        void Flush();
+
+        // Flushes, then exposes the result.
+        const SoftwareFramebuffer& Framebuffer();
+
+        // Redirects rendering into `target` (sized by the caller); nullptr
+        // returns to the device's own target. The viewport is left alone.
+        void SetRenderTarget(SoftwareFramebuffer* target);
+        SoftwareFramebuffer* RenderTarget() const { return m_Redirected; }
+
+        struct Viewport { uint32_t X = 0, Y = 0, W = 0, H = 0; };
+        Viewport GetViewport() const { return { m_ViewportX, m_ViewportY, m_ViewportW, m_ViewportH }; }
+
+        // 0 = use every core. Takes effect on the next Flush.
+        void SetThreadCount(uint32_t threads);
+
+        void OnTextureDestroyed(const SoftwareTexture2D* tex);
+
+        struct Statistics {
+            uint64_t Triangles = 0;   // after culling
+            uint64_t Fragments = 0;   // pixels shaded (passed coverage)
+            uint32_t Flushes = 0;
+        };
+        const Statistics& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats = {}; }
+
+        // Drops all state and memory (Renderer::Shutdown).
+        void Reset();
+
+    private:
+        SoftwareDevice();
+        ~SoftwareDevice();
+
+        struct Triangle;
+        void BinTriangle(const Triangle& tri);
+        uint64_t RasterizeTile(uint32_t tileIndex); // returns fragments written
+        void ResizeTargets(uint32_t w, uint32_t h);
+        void ResetTiles();
+
+        const SoftwareShader*      m_Shader = nullptr;
+        const SoftwareVertexArray* m_VertexArray = nullptr;
+        std::array<const SoftwareTexture2D*, MaxTextureSlots> m_Textures{};
+
+        uint32_t  m_ViewportX = 0, m_ViewportY = 0, m_ViewportW = 0, m_ViewportH = 0;
+        glm::vec4 m_ClearColor{ 0.0f, 0.0f, 0.0f, 1.0f };
+        RendererAPI::BlendMode m_BlendMode = RendererAPI::BlendMode::Alpha;
+        bool m_CountOverdraw = false;
+
+        SoftwareFramebuffer  m_Target;
+        SoftwareFramebuffer* m_Redirected = nullptr; // its storage is swapped into m_Target
+        uint32_t m_TilesX = 0, m_TilesY = 0;
+
+        std::vector<Triangle>              m_Triangles;
+        std::vector<std::vector<uint32_t>> m_TileBins; // triangle indices per tile
+
+        std::unique_ptr<ThreadPool> m_Pool;
+        uint32_t                    m_ThreadCount = 0;
+        Statistics  m_Stats;
+    };
+
+} // namespace Engine
@@ -0,0 +1,47 @@
+#include "enginepch.h"
+#include "SoftwareFrameReadback.h"
+#include "SoftwareDevice.h"
+
+namespace Engine {
+
+    bool SoftwareFrameReadback::Request(uint32_t width, uint32_t height, uint64_t tag, ReadbackSource source) {
+        EG_PROFILE_FUNCTION();
+        if (m_Ready.size() >= m_Slots) return false;
+        const SoftwareFramebuffer& fb = SoftwareDevice::Get().Framebuffer();
+        width = std::min(width, fb.Width);
+        height = std::min(height, fb.Height);
+        if (width == 0 || height == 0) return false;
+
+        ReadbackImage img;
+        if (!m_Spare.empty()) {
+            img = std::move(m_Spare.back());
+            m_Spare.pop_back();
+        }
+        img.Width = width;
+        img.Height = height;
+        img.Tag = tag;
+        img.Source = source;
+        const size_t rowBytes = (size_t)width * img.BytesPerPixel();
+        img.Pixels.resize(rowBytes * height);
+        for (uint32_t y = 0; y < height; ++y) {
+            // 0xAABBGGRR words are RGBA bytes in memory
+            const void* src = source == ReadbackSource::Color
+                ? (const void*)(fb.Color.data() + (size_t)y * fb.Width)
+                : (const void*)(fb.Stencil.data() + (size_t)y * fb.Width);
+            std::memcpy(img.Pixels.data() + (size_t)y * rowBytes, src, rowBytes);
+        }
+        m_Ready.push_back(std::move(img));
+        return true;
+    }
+
+    bool SoftwareFrameReadback::Poll(ReadbackImage& out, bool) {
+        if (m_Ready.empty()) return false;
+        ReadbackImage& front = m_Ready.front();
+        std::swap(out, front);
+        // What the caller passed in becomes storage for a later Request
+        if (front.Pixels.capacity() != 0) m_Spare.push_back(std::move(front));
+        m_Ready.pop_front();
+        return true;
+    }
+
+} // namespace Engine
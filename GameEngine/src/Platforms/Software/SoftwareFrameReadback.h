@@ -0,0 +1,23 @@
+#pragma once
+#include <deque>
+#include "Engine/Renderer/FrameReadback.h"
+
+namespace Engine {
+
+    // The software target already lives in memory: Request copies it at
+    // once (after flushing binned triangles) and Poll returns it in order.
+    class SoftwareFrameReadback final : public FrameReadback {
+    public:
+        explicit SoftwareFrameReadback(uint32_t slots) : m_Slots(slots) {}
+
+        bool Request(uint32_t width, uint32_t height, uint64_t tag, ReadbackSource source) override;
+        bool Poll(ReadbackImage& out, bool wait) override;
+        uint32_t InFlight() const override { return (uint32_t)m_Ready.size(); }
+
+    private:
+        uint32_t m_Slots;
+        std::deque<ReadbackImage> m_Ready;
+        std::vector<ReadbackImage> m_Spare; // pixel storage handed back by Poll
+    };
+
+} // namespace Engine
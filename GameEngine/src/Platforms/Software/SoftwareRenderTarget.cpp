@@ -0,0 +1,54 @@
+#include "enginepch.h"
+#include "SoftwareRenderTarget.h"
+#include "SoftwareTexture.h"
+
+namespace Engine {
+
+    SoftwareRenderTarget::SoftwareRenderTarget(const FramebufferSpec& spec)
+        : m_Spec(spec) {
+        Allocate();
+    }
+
+    SoftwareRenderTarget::~SoftwareRenderTarget() {
+        if (m_Bound) Unbind();
+    }
+
+    void SoftwareRenderTarget::Allocate() {
+        EG_CORE_CHECK(m_Spec.Width > 0 && m_Spec.Height > 0, "Framebuffer size must be non-zero");
+        m_Surface.Width = m_Spec.Width;
+        m_Surface.Height = m_Spec.Height;
+        m_Surface.Color.assign((size_t)m_Spec.Width * m_Spec.Height, 0u);
+        m_Surface.Depth.assign((size_t)m_Spec.Width * m_Spec.Height, 1.0f);
+        m_Surface.Stencil.assign((size_t)m_Spec.Width * m_Spec.Height, 0);
+        m_Color = MakeShared<SoftwareTexture2D>(m_Spec.Width, m_Spec.Height);
+    }
+
+    void SoftwareRenderTarget::Bind() {
+        auto& device = SoftwareDevice::Get();
+        if (!m_Bound) {
+            m_Previous = device.RenderTarget();
+            m_SavedViewport = device.GetViewport();
+        }
+        device.SetRenderTarget(&m_Surface);
+        device.SetViewport(0, 0, m_Spec.Width, m_Spec.Height);
+        m_Bound = true;
+    }
+
+    void SoftwareRenderTarget::Unbind() {
+        if (!m_Bound) return;
+        auto& device = SoftwareDevice::Get();
+        device.SetRenderTarget(m_Previous); // flushes and hands m_Surface back
+        device.SetViewport(m_SavedViewport.X, m_SavedViewport.Y, m_SavedViewport.W, m_SavedViewport.H);
+        m_Bound = false;
+        m_Color->SetData(m_Surface.Color.data(), (uint32_t)(m_Surface.Color.size() * sizeof(uint32_t)));
+    }
+
+    void SoftwareRenderTarget::Resize(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0 || (width == m_Spec.Width && height == m_Spec.Height)) return;
+        Unbind();
+        m_Spec.Width = width;
+        m_Spec.Height = height;
+        Allocate();
+    }
+
+} // namespace Engine
@@ -0,0 +1,37 @@
+#pragma once
+#include "Engine/Renderer/Framebuffer.h"
+#include "SoftwareDevice.h"
+
+namespace Engine {
+
+    class SoftwareTexture2D;
+
+    // Framebuffer for the software backend. While bound, the device
+    // rasterizes into m_Surface; Unbind copies the color into the texture
+    // and restores the previous target and viewport.
+    class SoftwareRenderTarget final : public Framebuffer {
+    public:
+        explicit SoftwareRenderTarget(const FramebufferSpec& spec);
+        ~SoftwareRenderTarget() override;
+
+        void Bind() override;
+        void Unbind() override;
+        void Resize(uint32_t width, uint32_t height) override;
+
+        const FramebufferSpec& GetSpec() const override { return m_Spec; }
+        const Shared<Texture2D>& GetColorAttachment() const override { return m_Color; }
+
+    private:
+        void Allocate();
+
+        FramebufferSpec     m_Spec;
+        SoftwareFramebuffer m_Surface;
+        Shared<Texture2D>   m_Color;
+        bool                m_Bound = false;
+
+        // Restored by Unbind
+        SoftwareFramebuffer*     m_Previous = nullptr;
+        SoftwareDevice::Viewport m_SavedViewport;
+    };
+
+} // namespace Engine
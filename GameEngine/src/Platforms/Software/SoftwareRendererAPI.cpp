@@ -0,0 +1,44 @@
+#include "enginepch.h"
+#include "SoftwareRendererAPI.h"
+#include "SoftwareDevice.h"
+
+namespace Engine {
+
+    void SoftwareRendererAPI::Init() {
+        EG_PROFILE_FUNCTION();
+        // Blending and depth testing are always on in the software pipeline
+        auto& device = SoftwareDevice::Get();
+        if (device.Framebuffer().Width == 0)
+            device.SetViewport(0, 0, DefaultWidth, DefaultHeight);
+    }
+
+    void SoftwareRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+        SoftwareDevice::Get().SetViewport(x, y, w, h);
+    }
+
+    void SoftwareRendererAPI::SetClearColor(const glm::vec4& c) {
+        SoftwareDevice::Get().SetClearColor(c);
+    }
+
+    void SoftwareRendererAPI::Clear() {
+        SoftwareDevice::Get().Clear();
+    }
+
+    void SoftwareRendererAPI::SetBlendMode(BlendMode mode) {
+        SoftwareDevice::Get().SetBlendMode(mode);
+    }
+
+    void SoftwareRendererAPI::SetOverdrawCounting(bool enabled) {
+        SoftwareDevice::Get().SetOverdrawCounting(enabled);
+    }
+
+    void SoftwareRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& va, uint32_t indexCount) {
+        SoftwareDevice::Get().DrawIndexed(*va, indexCount, 1, 0);
+    }
+
+    void SoftwareRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& va,
+        uint32_t instanceCount, uint32_t baseInstance) {
+        SoftwareDevice::Get().DrawIndexed(*va, 0, instanceCount, baseInstance);
+    }
+
+} // namespace Engine
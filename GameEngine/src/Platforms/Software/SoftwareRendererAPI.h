@@ -0,0 +1,25 @@
+#pragma once
+#include "Engine/Renderer/RendererAPI.h"
+
+namespace Engine {
+
+    // RendererAPI on top of SoftwareDevice. Needs no window or GL context,
+    // so tests and headless tools can run the normal Renderer/Renderer2D path.
+    // Read the result with SoftwareDevice::Get().Framebuffer().
+    class SoftwareRendererAPI final : public RendererAPI {
+    public:
+        static constexpr uint32_t DefaultWidth = 1280;
+        static constexpr uint32_t DefaultHeight = 720;
+
+        void Init() override;
+        void SetViewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h) override;
+        void SetClearColor(const glm::vec4& color) override;
+        void Clear() override;
+        void SetBlendMode(BlendMode mode) override;
+        void SetOverdrawCounting(bool enabled) override;
+        void DrawIndexed(const std::shared_ptr<VertexArray>& va, uint32_t indexCount = 0) override;
+        void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& va, uint32_t instanceCount,
+            uint32_t baseInstance = 0) override;
+    };
+
+} // namespace Engine
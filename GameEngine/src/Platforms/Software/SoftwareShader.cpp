@@ -0,0 +1,52 @@
+#include "enginepch.h"
+#include "SoftwareShader.h"
+#include "SoftwareDevice.h"
+#include <filesystem>
+
+namespace Engine {
+
+    SoftwareShader::SoftwareShader(const std::string& filepath)
+        : m_Name(std::filesystem::path(filepath).stem().string()),
+          m_Attributes(ParseVertexInputs(ReadVertexStage(filepath))) {
+    }
+
+    SoftwareShader::SoftwareShader(const std::string& name, const std::string& vs, const std::string&)
+        : m_Name(name), m_Attributes(ParseVertexInputs(vs)) {
+    }
+
+    SoftwareShader::~SoftwareShader() { SoftwareDevice::Get().OnShaderDestroyed(this); }
+
+    void SoftwareShader::Binding() const { SoftwareDevice::Get().BindShader(this); }
+    void SoftwareShader::Unbinding() const { SoftwareDevice::Get().BindShader(nullptr); }
+
+    int SoftwareShader::GetAttributeLocation(const std::string& name) const {
+        auto it = m_Attributes.find(name);
+        return it != m_Attributes.end() ? it->second : -1;
+    }
+
+    glm::mat4 SoftwareShader::Mat4(const std::string& n) const {
+        auto it = m_Mat4s.find(n);
+        return it != m_Mat4s.end() ? it->second : glm::mat4(1.0f);
+    }
+
+    glm::vec4 SoftwareShader::Vec4(const std::string& n) const {
+        auto it = m_Vec4s.find(n);
+        return it != m_Vec4s.end() ? it->second : glm::vec4(1.0f);
+    }
+
+    float SoftwareShader::Float(const std::string& n) const {
+        auto it = m_Floats.find(n);
+        return it != m_Floats.end() ? it->second : 1.0f;
+    }
+
+    int SoftwareShader::Int(const std::string& n) const {
+        auto it = m_Ints.find(n);
+        return it != m_Ints.end() ? it->second : 0;
+    }
+
+    const std::vector<int>* SoftwareShader::IntArray(const std::string& n) const {
+        auto it = m_IntArrays.find(n);
+        return it != m_IntArrays.end() ? &it->second : nullptr;
+    }
+
+} // namespace Engine
@@ -0,0 +1,55 @@
+#pragma once
+#include "Engine/Renderer/Shader.h"
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    // The software rasterizer does not run GLSL. It implements the fixed 2D
+    // pipeline the engine's shaders describe, driven by what the source
+    // declares and what was uploaded:
+    //   position = u_ViewProjection * (a_Transform | u_Transform) * a_Position
+    //   color    = a_Color * u_Color * texture(slot, a_TexCoord * tiling)
+    // where slot is u_Textures[a_TexIndex] or u_Texture, and tiling is
+    // a_TilingFactor or u_TilingFactor. Missing inputs default to 1/identity.
+    class SoftwareShader final : public Shader {
+    public:
+        explicit SoftwareShader(const std::string& filepath);
+        SoftwareShader(const std::string& name, const std::string& vs, const std::string& fs);
+        ~SoftwareShader() override;
+
+        void Binding() const override;
+        void Unbinding() const override;
+
+    protected:
+        void UploadInt(const std::string& n, int v) override { m_Ints[n] = v; }
+        void UploadIntArray(const std::string& n, const int* v, uint32_t count) override { m_IntArrays[n].assign(v, v + count); }
+        void UploadFloat(const std::string& n, float v) override { m_Floats[n] = v; }
+        void UploadFloat3(const std::string& n, const glm::vec3& v) override { m_Vec4s[n] = glm::vec4(v, 1.0f); }
+        void UploadFloat4(const std::string& n, const glm::vec4& v) override { m_Vec4s[n] = v; }
+        void UploadMat4(const std::string& n, const glm::mat4& m) override { m_Mat4s[n] = m; }
+
+    public:
+        const std::string& GetName() const override { return m_Name; }
+        int GetAttributeLocation(const std::string& name) const override;
+
+        // Uniform lookups with the defaults listed above
+        glm::mat4 Mat4(const std::string& n) const;
+        glm::vec4 Vec4(const std::string& n) const;
+        float     Float(const std::string& n) const;
+        int       Int(const std::string& n) const;
+        const std::vector<int>* IntArray(const std::string& n) const;
+
+    private:
+        std::string m_Name;
+        std::unordered_map<std::string, int> m_Attributes; // from layout(location = N) in ...
+
+        std::unordered_map<std::string, int>              m_Ints;
+        std::unordered_map<std::string, std::vector<int>> m_IntArrays;
+        std::unordered_map<std::string, float>            m_Floats;
+        std::unordered_map<std::string, glm::vec4>        m_Vec4s;
+        std::unordered_map<std::string, glm::mat4>        m_Mat4s;
+    };
+
+} // namespace Engine
@@ -0,0 +1,77 @@
+#include "enginepch.h"
+#include "SoftwareTexture.h"
+#include "SoftwareDevice.h"
+#include "stb_image.h"
+#include <cmath>
+#include <cstring>
+
+namespace Engine {
+
+    SoftwareTexture2D::SoftwareTexture2D(uint32_t w, uint32_t h)
+        : m_W(w), m_H(h), m_Pixels((size_t)w * h, 0xffffffffu) {
+    }
+
+    SoftwareTexture2D::SoftwareTexture2D(const std::string& path) {
+        EG_PROFILE_FUNCTION();
+        int w, h, ch;
+        stbi_set_flip_vertically_on_load(1);
+        stbi_uc* data = stbi_load(path.c_str(), &w, &h, &ch, 4);
+        EG_CORE_CHECK(data, "Failed to load image");
+        if (!data) { m_W = m_H = 1; m_Pixels.assign(1, 0xffffffffu); return; }
+
+        m_W = (uint32_t)w; m_H = (uint32_t)h;
+        m_Pixels.resize((size_t)w * h);
+        std::memcpy(m_Pixels.data(), data, m_Pixels.size() * 4);
+        stbi_image_free(data);
+    }
+
+    SoftwareTexture2D::~SoftwareTexture2D() {
+        SoftwareDevice::Get().OnTextureDestroyed(this);
+    }
+
+    void SoftwareTexture2D::SetData(void* data, uint32_t size) {
+        EG_PROFILE_FUNCTION();
+        const size_t count = (size_t)m_W * m_H;
+        const uint8_t* src = static_cast<const uint8_t*>(data);
+
+        // Triangles already binned may sample the old contents
+        SoftwareDevice::Get().Flush();
+
+        if (size == count * 4) {
+            std::memcpy(m_Pixels.data(), src, size);
+        } else if (size == count * 3) {
+            for (size_t i = 0; i < count; ++i, src += 3)
+                m_Pixels[i] = src[0] | (src[1] << 8) | (src[2] << 16) | 0xff000000u;
+        } else {
+            EG_CORE_CHECK(false, "Texture data size mismatch");
+        }
+    }
+
+    void SoftwareTexture2D::Bind(uint32_t slot) const {
+        SoftwareDevice::Get().BindTexture(slot, this);
+    }
+
+    static glm::vec4 Unpack(uint32_t p) {
+        return glm::vec4((float)(p & 0xff), (float)((p >> 8) & 0xff),
+            (float)((p >> 16) & 0xff), (float)(p >> 24)) * (1.0f / 255.0f);
+    }
+
+    glm::vec4 SoftwareTexture2D::Sample(glm::vec2 uv) const {
+        // Texel centers at +0.5, repeat wrap (GL_REPEAT, GL_LINEAR)
+        const float x = uv.x * (float)m_W - 0.5f;
+        const float y = uv.y * (float)m_H - 0.5f;
+        const float fx = std::floor(x), fy = std::floor(y);
+        const float tx = x - fx, ty = y - fy;
+
+        auto wrap = [](int v, uint32_t n) { int m = v % (int)n; return (uint32_t)(m < 0 ? m + (int)n : m); };
+        const uint32_t x0 = wrap((int)fx, m_W), x1 = wrap((int)fx + 1, m_W);
+        const uint32_t y0 = wrap((int)fy, m_H), y1 = wrap((int)fy + 1, m_H);
+
+        const glm::vec4 c00 = Unpack(m_Pixels[y0 * m_W + x0]);
+        const glm::vec4 c10 = Unpack(m_Pixels[y0 * m_W + x1]);
+        const glm::vec4 c01 = Unpack(m_Pixels[y1 * m_W + x0]);
+        const glm::vec4 c11 = Unpack(m_Pixels[y1 * m_W + x1]);
+        return glm::mix(glm::mix(c00, c10, tx), glm::mix(c01, c11, tx), ty);
+    }
+
+} // namespace Engine
@@ -0,0 +1,32 @@
+#pragma once
+#include "Engine/Renderer/Texture.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+    // RGBA8 texture in system memory, rows bottom-up like the GL backend.
+    // Sampling is bilinear with repeat wrapping; there are no mipmaps.
+    class SoftwareTexture2D final : public Texture2D {
+    public:
+        SoftwareTexture2D(uint32_t w, uint32_t h);
+        explicit SoftwareTexture2D(const std::string& path);
+        ~SoftwareTexture2D() override;
+
+        uint32_t GetWidth()  const override { return m_W; }
+        uint32_t GetHeight() const override { return m_H; }
+
+        // Accepts RGBA8 (w*h*4 bytes) or RGB8 (w*h*3 bytes)
+        void SetData(void* data, uint32_t size) override;
+        void Bind(uint32_t slot = 0) const override;
+
+        glm::vec4 Sample(glm::vec2 uv) const;
+        const uint32_t* Pixels() const { return m_Pixels.data(); }
+
+    private:
+        uint32_t m_W = 0, m_H = 0;
+        std::vector<uint32_t> m_Pixels; // 0xAABBGGRR
+    };
+
+} // namespace Engine
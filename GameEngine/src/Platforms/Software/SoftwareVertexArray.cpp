@@ -0,0 +1,10 @@
+#include "enginepch.h"
+#include "SoftwareVertexArray.h"
+#include "SoftwareDevice.h"
+
+namespace Engine {
+
+    void SoftwareVertexArray::Bind() const { SoftwareDevice::Get().BindVertexArray(this); }
+    void SoftwareVertexArray::Unbind() const { SoftwareDevice::Get().BindVertexArray(nullptr); }
+
+} // namespace Engine
@@ -206,6 +206,12 @@ namespace Engine {
             m_Context->SwapBuffers();
     }
 
+    void WindowsWindow::PollEvents()
+    {
+        EG_PROFILE_FUNCTION();
+        glfwPollEvents();
+    }
+
     void WindowsWindow::SetTitle(const std::string& title)
     {
         m_Data.Title = title;
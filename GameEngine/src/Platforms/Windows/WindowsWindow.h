@@ -17,6 +17,8 @@ namespace Engine {
 
         // Per-frame pump
         void OnUpdate() override;
+        void PollEvents() override;
+        GraphicsContext& GetContext() override { return *m_Context; }
 
         // Dimensions
         uint32_t GetWidth()  const override { return m_Data.Width; }
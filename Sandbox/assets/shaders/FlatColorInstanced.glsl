@@ -0,0 +1,29 @@
+// Flat Color Shader, instanced: the transform comes from the per-instance
+// a_Transform stream that Renderer::EndScene appends after the mesh's own
+// attributes, so a run of the same mesh is one draw. Its location has to be
+// the mesh's attribute slot count: 1 here, for a_Position alone.
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in mat4 a_Transform;
+
+uniform mat4 u_ViewProjection;
+
+void main()
+{
+	gl_Position = u_ViewProjection * a_Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+uniform vec4 u_Color;
+
+void main()
+{
+	color = u_Color;
+}
@@ -34,6 +34,28 @@ static bool PointInTri(const glm::vec2& p, glm::vec2 a, const glm::vec2& b, cons
 }
 
 
+// Collision triangles of a gate's top and bottom spike, in world space
+static void GateTriangles(const Gate& g, glm::vec2 top[3], glm::vec2 bottom[3])
+{
+	glm::vec4 tri[3] = {
+	{-0.5f + 0.1f,-0.5f + 0.1f,0,1},
+	{ 0.5f - 0.1f,-0.5f + 0.1f,0,1},
+	{ 0.0f, 0.5f - 0.1f,0,1},
+	};
+
+
+	auto Mt = glm::translate(glm::mat4(1), { g.topPos.x,g.topPos.y,0 })
+		* glm::rotate(glm::mat4(1), glm::radians(180.0f), { 0,0,1 })
+		* glm::scale(glm::mat4(1), { g.topSize.x,g.topSize.y,1 });
+	for (int i = 0; i < 3; ++i) { auto v = Mt * tri[i]; top[i] = { v.x,v.y }; }
+
+
+	auto Mb = glm::translate(glm::mat4(1), { g.botPos.x,g.botPos.y,0 })
+		* glm::scale(glm::mat4(1), { g.botSize.x,g.botSize.y,1 });
+	for (int i = 0; i < 3; ++i) { auto v = Mb * tri[i]; bottom[i] = { v.x,v.y }; }
+}
+
+
 void Course::Initialize()
 {
 	Util::RNG::Init();
@@ -42,13 +64,18 @@ void Course::Initialize()
 
 
 	m_Gates.resize(5);
+	m_Colliders.Clear();
+	for (size_t i = 0; i < m_Gates.size() * 2; ++i)
+		m_Colliders.AddTriangle({ 0, 0 }, { 1, 0 }, { 0, 1 }); // placed by SpawnGate
 	for (int i = 0; i < 5; ++i)
 		SpawnGate(i, i * 10.0f);
+	m_Ship.SetColliders(&m_Colliders);
 }
 
 
 void Course::Tick(Engine::Timestep dt)
 {
+	m_Colliders.Update(); // rebuilt only after a gate moved
 	m_Ship.Update(dt);
 
 
@@ -70,7 +97,7 @@ void Course::Tick(Engine::Timestep dt)
 }
 
 
-void Course::Draw()
+void Course::Draw(bool withFX)
 {
 	const auto& shipPos = m_Ship.Position();
 	glm::vec4 col = HSV2RGB(m_ColorHSV);
@@ -87,7 +114,7 @@ void Course::Draw()
 	}
 
 
-	m_Ship.Render();
+	m_Ship.Render(withFX);
 }
 
 
@@ -105,6 +132,12 @@ void Course::SpawnGate(int index, float x)
 
 	g.topPos.y = 10.0f - ((10.0f - center) * 0.2f) + gap * 0.5f;
 	g.botPos.y = -10.0f - ((-10.0f - center) * 0.2f) - gap * 0.5f;
+
+
+	glm::vec2 top[3], bottom[3];
+	GateTriangles(g, top, bottom);
+	m_Colliders.Set(index * 2, top, 3);
+	m_Colliders.Set(index * 2 + 1, bottom, 3);
 }
 
 
@@ -123,28 +156,10 @@ bool Course::CheckCollision() const
 	for (int i = 0; i < 4; ++i) out[i] = M * verts[i];
 
 
-	glm::vec4 tri[3] = {
-	{-0.5f + 0.1f,-0.5f + 0.1f,0,1},
-	{ 0.5f - 0.1f,-0.5f + 0.1f,0,1},
-	{ 0.0f, 0.5f - 0.1f,0,1},
-	};
-
-
 	for (auto& g : m_Gates) {
-		// TOP
-		glm::vec2 T[3];
-		auto Mt = glm::translate(glm::mat4(1), { g.topPos.x,g.topPos.y,0 })
-			* glm::rotate(glm::mat4(1), glm::radians(180.0f), { 0,0,1 })
-			* glm::scale(glm::mat4(1), { g.topSize.x,g.topSize.y,1 });
-		for (int i = 0; i < 3; ++i) { auto v = Mt * tri[i]; T[i] = { v.x,v.y }; }
+		glm::vec2 T[3], B[3];
+		GateTriangles(g, T, B);
 		for (auto& v : out) if (PointInTri({ v.x,v.y }, T[0], T[1], T[2])) return true;
-
-
-		// BOTTOM
-		glm::vec2 B[3];
-		auto Mb = glm::translate(glm::mat4(1), { g.botPos.x,g.botPos.y,0 })
-			* glm::scale(glm::mat4(1), { g.botSize.x,g.botSize.y,1 });
-		for (int i = 0; i < 3; ++i) { auto v = Mb * tri[i]; B[i] = { v.x,v.y }; }
 		for (auto& v : out) if (PointInTri({ v.x,v.y }, B[0], B[1], B[2])) return true;
 	}
 	return false;
@@ -4,6 +4,7 @@
 #include "Engine/Core/Timestep.h"
 #include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Renderer/Texture.h"
+#include "Engine/Physics/SpatialHash.h"
 #include "Ship.h"
 
 
@@ -21,7 +22,9 @@ class Course {
 public:
 	void Initialize();
 	void Tick(Engine::Timestep dt);
-	void Draw();
+	// withFX = false skips the ship's particles; draw them with DrawFX
+	void Draw(bool withFX = true);
+	void DrawFX() const { m_Ship.RenderFX(); }
 
 
 	bool Ended() const { return m_Ended; }
@@ -47,5 +50,6 @@ private:
 
 
 	std::vector<Gate> m_Gates;
+	Engine::SpatialHash m_Colliders; // gate triangles (2 per gate), for the ship's particles
 	Engine::Shared<Engine::Texture2D> m_TriTex;
 };
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "enginepch.h"
+#include "PlaySceneFrame.h"
+
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/LowResolutionPass.h"
+#include "Engine/Renderer/DynamicResolution.h"
+#include "Engine/Renderer/RenderGraph.h"
+#include "Engine/Renderer/OverdrawView.h"
+#include "Engine/Renderer/FXBudget.h"
+
+#include "Course.h"
+#include "Ship.h"
+
+PlaySceneFrame::PlaySceneFrame(uint32_t width, uint32_t height)
+    : m_Height(height)
+{
+    m_FXPass = std::make_unique<Engine::LowResolutionPass>(width, height, 0.5f);
+    m_FXPass->SetDepthAware(true); // the ship (z = 0.5) stays in front of its smoke
+    m_DynamicRes = std::make_unique<Engine::DynamicResolution>(width, height);
+    m_Overdraw = std::make_unique<Engine::OverdrawView>(width, height);
+
+    // The FX pass blends onto the scene, so it reads what it writes
+    using Graph = Engine::RenderGraph;
+    m_Graph = std::make_unique<Graph>();
+    const Graph::Resource backbuffer = m_Graph->Import("Backbuffer");
+    m_Graph->AddPass("Scene",
+        [backbuffer](Graph::Builder& b) { b.Write(backbuffer); },
+        [this](const Graph::Context&) {
+            Engine::RenderCommand::SetClearColor({ 0.f, 0.f, 0.f, 1.f });
+            Engine::RenderCommand::Clear();
+            Engine::Renderer2D::BeginScene(*m_Camera);
+            m_Course->Draw(false);
+            Engine::Renderer2D::EndScene();
+        });
+    m_Graph->AddPass("ShipFX",
+        [backbuffer](Graph::Builder& b) { b.Read(backbuffer); b.Write(backbuffer); },
+        [this](const Graph::Context&) {
+            m_FXPass->Begin(*m_Camera);
+            m_Course->DrawFX();
+            m_FXPass->End();
+            m_FXPass->Composite();
+        });
+    m_Graph->Compile();
+    EG_INFO("{}", m_Graph->Dump());
+}
+
+PlaySceneFrame::~PlaySceneFrame() = default;
+
+void PlaySceneFrame::OnResize(uint32_t width, uint32_t height)
+{
+    m_Height = height;
+    m_FXPass->OnResize(width, height);
+    m_DynamicRes->OnResize(width, height);
+    m_Overdraw->OnResize(width, height);
+}
+
+void PlaySceneFrame::Render(Engine::Timestep dt, const Engine::OrthographicCamera& camera, Course& course)
+{
+    m_Camera = &camera;
+    m_Course = &course;
+
+    // Particles are drawn at the FX pass's share of the dynamic resolution
+    // (all of it while the overdraw view has them drawn direct); the camera
+    // is 16 units tall
+    const float fxScale = m_FXPass->IsDirect() ? 1.0f : m_FXPass->GetScale();
+    const float fxPixels = m_Height * m_DynamicRes->GetScale() * fxScale;
+    auto& budget = Engine::FXBudget::Global();
+    budget.SetView(course.PlayerRef().Position(), fxPixels / 16.0f);
+    budget.BeginFrame();
+
+    // Scene at the dynamic scale; the HUD draws after EndFrame at native size
+    m_DynamicRes->Update(dt);
+    m_DynamicRes->BeginFrame();
+
+    if (m_ShowOverdraw)
+        m_Overdraw->Begin();
+    m_Graph->Execute();
+    if (m_ShowOverdraw)
+    {
+        m_Overdraw->End();
+        m_Overdraw->Composite();
+    }
+    m_DynamicRes->EndFrame();
+
+    m_Camera = nullptr;
+    m_Course = nullptr;
+}
+
+void PlaySceneFrame::ShowOverdraw(bool show)
+{
+    m_ShowOverdraw = show;
+    m_FXPass->SetDirect(show);
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Engine/Core/Timestep.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+
+#include <memory>
+
+class Course;
+namespace Engine { class LowResolutionPass; class DynamicResolution; class RenderGraph; class OverdrawView; }
+
+
+// Everything the play scene draws per frame, minus the HUD: the scene and the
+// half-resolution ship FX as a render graph inside the dynamic-resolution
+// target, wrapped by the overdraw view while it is shown. PlaySceneLayer owns
+// one; the draw-budget test drives one on the recording backend.
+class PlaySceneFrame
+{
+public:
+	PlaySceneFrame(uint32_t width, uint32_t height);
+	~PlaySceneFrame();
+
+	PlaySceneFrame(const PlaySceneFrame&) = delete;
+	PlaySceneFrame& operator=(const PlaySceneFrame&) = delete;
+
+
+	void OnResize(uint32_t width, uint32_t height);
+
+	// Draws the course as the camera sees it; dt drives the resolution scale
+	void Render(Engine::Timestep dt, const Engine::OrthographicCamera& camera, Course& course);
+
+	// The particles skip the low-resolution target while shown, so they are counted too
+	void ShowOverdraw(bool show);
+	bool IsShowingOverdraw() const { return m_ShowOverdraw; }
+	Engine::OverdrawView& GetOverdraw() { return *m_Overdraw; }
+
+
+private:
+	std::unique_ptr<Engine::LowResolutionPass> m_FXPass; // ship smoke/flame at half resolution
+	std::unique_ptr<Engine::RenderGraph> m_Graph; // scene and FX passes, run inside the dynamic-resolution target
+	std::unique_ptr<Engine::DynamicResolution> m_DynamicRes; // scene scale follows frame time; HUD stays native
+	std::unique_ptr<Engine::OverdrawView> m_Overdraw; // its target is allocated on first use
+
+	uint32_t m_Height;
+	bool m_ShowOverdraw = false;
+
+	// What the graph's passes draw during Render
+	const Engine::OrthographicCamera* m_Camera = nullptr;
+	Course* m_Course = nullptr;
+};
@@ -2,16 +2,20 @@
 #include "PlaySceneLayer.h"
 
 #include "Engine/Core/Application.h"
-#include "Engine/Renderer/Renderer2D.h"
-#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/FrameCapture.h"
+#include "Engine/Renderer/OverdrawView.h"
+#include "Engine/Renderer/FXBudget.h"
+#include "Engine/Core/KeyCodes.h"
 
 #include "Course.h"
 #include "Ship.h"
+#include "PlaySceneFrame.h"
 
 #include <imgui/imgui.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <cmath>
+#include <filesystem>
 
 PlaySceneLayer::PlaySceneLayer()
     : Layer("PlaySceneLayer")
@@ -27,6 +31,10 @@ void PlaySceneLayer::OnAttach()
     m_Course = std::make_unique<Course>();
     m_Course->Initialize();
 
+    auto& win = Engine::Application::Get().GetWindow();
+    m_Frame = std::make_unique<PlaySceneFrame>(win.GetWidth(), win.GetHeight());
+    Engine::FXBudget::Global().SetCullDistance(40.0f); // a few screens behind the ship
+
     // Bigger fonts for HUD
     ImGuiIO& io = ImGui::GetIO();
     m_FontTitle = io.Fonts->AddFontFromFileTTF("assets/OpenSans-Regular.ttf", 96.0f);
@@ -35,6 +43,7 @@ void PlaySceneLayer::OnAttach()
 
 void PlaySceneLayer::OnDetach()
 {
+    m_Frame.reset();
     m_Course.reset();
 }
 
@@ -54,12 +63,8 @@ void PlaySceneLayer::OnUpdate(Engine::Timestep dt)
             m_Mode = Mode::Defeat;
     }
 
-    Engine::RenderCommand::SetClearColor({ 0.f, 0.f, 0.f, 1.f });
-    Engine::RenderCommand::Clear();
-
-    Engine::Renderer2D::BeginScene(*m_Camera);
-    m_Course->Draw();
-    Engine::Renderer2D::EndScene();
+    // Scene at the dynamic scale; ImGui (OnImGuiRender) draws after it at native size
+    m_Frame->Render(dt, *m_Camera, *m_Course);
 }
 
 void PlaySceneLayer::OnImGuiRender()
@@ -72,6 +77,22 @@ void PlaySceneLayer::DrawHUD()
     ImVec2 origin = ImGui::GetWindowPos();
     const auto& wnd = Engine::Application::Get().GetWindow();
 
+    if (m_Frame->IsShowingOverdraw())
+    {
+        const auto& od = m_Frame->GetOverdraw().GetStats().Last;
+        char text[128];
+        std::snprintf(text, sizeof(text), "Overdraw  avg %.2f  max %u  coverage %.0f%%",
+            od.Average, od.Max, od.Coverage * 100.0f);
+        ImGui::GetForegroundDrawList()->AddText(
+            { origin.x + 16.0f, origin.y + wnd.GetHeight() - 32.0f }, 0xffffffff, text);
+
+        const auto& fx = Engine::FXBudget::Global().GetStats().Last;
+        std::snprintf(text, sizeof(text), "Particles  %zu  pressure %.0f%%  demand %.0f%%  throttled %u  rejected %u",
+            fx.Live, fx.Pressure * 100.0f, fx.Demand * 100.0f, fx.Throttled, fx.Rejected);
+        ImGui::GetForegroundDrawList()->AddText(
+            { origin.x + 16.0f, origin.y + wnd.GetHeight() - 52.0f }, 0xffffffff, text);
+    }
+
     if (m_Mode == Mode::Running)
     {
         const uint32_t score = m_Course->PlayerRef().Score();
@@ -128,11 +149,13 @@ void PlaySceneLayer::OnEvent(Engine::Event& e)
     Engine::EventDispatcher d(e);
     d.Dispatch<Engine::WindowResizeEvent>([this](auto& ev) { return HandleResize(ev); });
     d.Dispatch<Engine::MouseButtonPressedEvent>([this](auto& ev) { return HandleMousePress(ev); });
+    d.Dispatch<Engine::KeyPressedEvent>([this](auto& ev) { return HandleKeyPress(ev); });
 }
 
 bool PlaySceneLayer::HandleResize(Engine::WindowResizeEvent& e)
 {
     RecreateCamera(e.GetWidth(), e.GetHeight());
+    if (m_Frame) m_Frame->OnResize(e.GetWidth(), e.GetHeight());
     return false;
 }
 
@@ -147,6 +170,44 @@ bool PlaySceneLayer::HandleMousePress(Engine::MouseButtonPressedEvent&)
     return false;
 }
 
+bool PlaySceneLayer::HandleKeyPress(Engine::KeyPressedEvent& e)
+{
+    if (e.GetRepeatCount() > 0)
+        return false;
+
+    auto& capture = Engine::Application::Get().GetFrameCapture();
+    if (e.GetKeyCode() == EG_KEY_F12)
+    {
+        std::filesystem::create_directories("captures");
+        capture.CaptureNextFrame("captures/screenshot_" + std::to_string(m_Screenshots++) + ".png");
+        return true;
+    }
+    if (e.GetKeyCode() == EG_KEY_F11)
+    {
+        if (capture.IsRecordingSequence()) capture.StopSequence();
+        else capture.StartSequence("captures/sequence");
+        return true;
+    }
+    if (e.GetKeyCode() == EG_KEY_F10)
+    {
+        // Turning the view off exports what it measured
+        const bool show = !m_Frame->IsShowingOverdraw();
+        m_Frame->ShowOverdraw(show);
+        if (!show)
+        {
+            auto& overdraw = m_Frame->GetOverdraw();
+            overdraw.Flush();
+            std::filesystem::create_directories("captures");
+            const std::string path = "captures/overdraw_" + std::to_string(m_OverdrawReports++) + ".json";
+            if (overdraw.WriteReport(path))
+                EG_INFO("Overdraw report: {} (mean {:.2f}, peak max {})", path,
+                    overdraw.GetStats().MeanAverage, overdraw.GetStats().PeakMax);
+        }
+        return true;
+    }
+    return false;
+}
+
 void PlaySceneLayer::RecreateCamera(uint32_t width, uint32_t height)
 {
     const float aspect = (height > 0) ? (float)width / (float)height : 16.0f / 9.0f;
@@ -5,12 +5,14 @@
 #include "Engine/Events/Event.h"
 #include "Engine/Events/ApplicationEvent.h"
 #include "Engine/Events/MouseEvent.h"
+#include "Engine/Events/KeyEvent.h"
 
 
 #include <memory>
 struct ImFont;
 
 class Course;
+class PlaySceneFrame;
 
 
 class PlaySceneLayer final : public Engine::Layer
@@ -32,6 +34,7 @@ public:
 private:
 	bool HandleResize(Engine::WindowResizeEvent& e);
 	bool HandleMousePress(Engine::MouseButtonPressedEvent& e);
+	bool HandleKeyPress(Engine::KeyPressedEvent& e); // F12 screenshot, F11 toggles image sequence, F10 overdraw heatmap
 
 
 	void RecreateCamera(uint32_t w, uint32_t h);
@@ -44,11 +47,14 @@ private:
 
 	std::unique_ptr<Engine::OrthographicCamera> m_Camera;
 	std::unique_ptr<Course> m_Course;
+	std::unique_ptr<PlaySceneFrame> m_Frame; // everything but the HUD; F10 shows its overdraw view
 
 
 	Mode m_Mode = Mode::Menu;
 	float m_Time = 0.0f;
 	float m_BlinkPhase = 0.0f;
+	uint32_t m_Screenshots = 0;
+	uint32_t m_OverdrawReports = 0;
 
 	// HUD fonts
 	ImFont * m_FontTitle = nullptr; // np. 96 px
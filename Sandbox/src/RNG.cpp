@@ -1,12 +1,11 @@
 #include "enginepch.h"
 #include "RNG.h"
+#include <random>
 
 
-std::mt19937 Util::RNG::s_Engine;
-std::uniform_int_distribution<std::mt19937::result_type> Util::RNG::s_Dist;
+Engine::Random Util::RNG::s_Engine;
 
 
-void Util::RNG::Init() { s_Engine.seed(std::random_device{}()); }
-float Util::RNG::Float01() {
-	return (float)s_Dist(s_Engine) / (float)std::numeric_limits<uint32_t>::max();
-}
\ No newline at end of file
+void Util::RNG::Init() { Init(((uint64_t)std::random_device{}() << 32) | std::random_device{}()); }
+void Util::RNG::Init(uint64_t seed) { s_Engine.Seed(seed); }
+float Util::RNG::Float01() { return s_Engine.Float01(); }
\ No newline at end of file
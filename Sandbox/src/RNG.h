@@ -1,15 +1,16 @@
 #pragma once
-#include <random>
-#include <limits>
+#include <cstdint>
+#include "Engine/Core/Random.h"
 
 
 namespace Util {
 	class RNG {
 	public:
-		static void Init();
-		static float Float01(); // [0,1]
+		static void Init();               // random seed, a new course every run
+		static void Init(uint64_t seed);  // reproducible course
+		static float Float01(); // [0,1)
+		static uint64_t GetSeed() { return s_Engine.GetSeed(); }
 	private:
-		static std::mt19937 s_Engine;
-		static std::uniform_int_distribution<std::mt19937::result_type> s_Dist;
+		static Engine::Random s_Engine;
 	};
 }
\ No newline at end of file
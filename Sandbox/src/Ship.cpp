@@ -4,22 +4,38 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <Engine.h>
 
+static Engine::FXTrailDesc SmokeDesc()
+{
+    Engine::FXTrailDesc d;
+    d.Width = Engine::FXCurve<float>(0.35f, 0.0f);
+    d.Color = Engine::FXCurve<glm::vec4>({ 0.8f,0.8f,0.8f,1.0f }, { 0.6f,0.6f,0.6f,0.0f });
+    d.Lifetime = 4.0f;
+    d.MinDistance = 0.5f;
+    d.Depth = -0.1f; // behind the flame
+    return d;
+}
+
+
+static Engine::FXEmitterDesc FlameDesc()
+{
+    Engine::FXEmitterDesc d;
+    d.Particle.vel = { -2.0f, 0.0f }; d.Particle.velJitter = { 3.0f, 1.0f };
+    d.Particle.sizeStart = 0.5f; d.Particle.sizeJitter = 0.3f;
+    d.Particle.life = 1.0f;
+    // orange to yellow while fading out, as the linear spec had it
+    d.Color = Engine::FXCurve<glm::vec4>({ 254 / 255.f,109 / 255.f, 41 / 255.f, 1.0f },
+        { 254 / 255.f,212 / 255.f,123 / 255.f, 0.0f });
+    d.Size = Engine::FXCurve<float>(1.0f, 0.0f);
+    d.Rate = 60.0f;
+    return d;
+}
+
+
 Ship::Ship()
+    : m_Flame(m_FX, FlameDesc()), m_Smoke(SmokeDesc())
 {
-    // smoke
-    m_Smoke.vel = { -2.0f, 0.0f }; m_Smoke.velJitter = { 4.0f, 2.0f };
-    m_Smoke.sizeStart = 0.35f; m_Smoke.sizeEnd = 0.0f; m_Smoke.sizeJitter = 0.15f;
-    m_Smoke.colorStart = { 0.8f,0.8f,0.8f,1.0f };
-    m_Smoke.colorEnd = { 0.6f,0.6f,0.6f,1.0f };
-    m_Smoke.life = 4.0f;
-
-
-    // fire
-    m_Flame.vel = { -2.0f, 0.0f }; m_Flame.velJitter = { 3.0f, 1.0f };
-    m_Flame.sizeStart = 0.5f; m_Flame.sizeEnd = 0.0f; m_Flame.sizeJitter = 0.3f;
-    m_Flame.colorStart = { 254 / 255.f,109 / 255.f, 41 / 255.f, 1.0f };
-    m_Flame.colorEnd = { 254 / 255.f,212 / 255.f,123 / 255.f, 1.0f };
-    m_Flame.life = 1.0f;
+    // the player's exhaust is the last effect to give up particles
+    m_FX.SetBudget(&Engine::FXBudget::Global(), Engine::FXPriority::High);
 }
 
 
@@ -31,9 +47,8 @@ void Ship::LoadAssets()
 
 void Ship::Update(Engine::Timestep dt)
 {
-    m_Time += dt;
-
-    if (Engine::Input::IsKeyPressed(EG_KEY_SPACE))
+    const bool thrust = Engine::Input::IsKeyPressed(EG_KEY_SPACE);
+    if (thrust)
     {
         m_Vel.y += m_Thrust;
         if (m_Vel.y < 0.0f) m_Vel.y += m_Thrust * 2.0f;
@@ -43,9 +58,8 @@ void Ship::Update(Engine::Timestep dt)
         float r = glm::radians(HeadingDeg());
         glm::vec4 t = glm::rotate(glm::mat4(1.0f), r, { 0,0,1 }) * glm::vec4(tail, 0, 1);
 
-        m_Flame.pos = m_Pos + glm::vec2{ t.x, t.y };
-        m_Flame.vel.y = -m_Vel.y * 0.2f - 0.2f;
-        m_FX.Spawn(m_Flame);
+        m_Flame.SetPosition(m_Pos + glm::vec2{ t.x, t.y });
+        m_Flame.Particle().vel.y = -m_Vel.y * 0.2f - 0.2f;
     }
     else
     {
@@ -55,19 +69,17 @@ void Ship::Update(Engine::Timestep dt)
     m_Vel.y = glm::clamp(m_Vel.y, -20.0f, 20.0f);
     m_Pos += m_Vel * (float)dt;
 
-    // smoke trail
-    if (m_Time > m_SmokeT) {
-        m_Smoke.pos = m_Pos;
-        m_FX.Spawn(m_Smoke);
-        m_SmokeT += m_SmokeEvery;
-    }
+    // fire while thrusting, smoke trail always
+    m_Flame.SetActive(thrust);
+    m_Flame.Update(dt);
+    m_Smoke.Update(dt, m_Pos);
 
     m_FX.Update(dt);
 }
 
-void Ship::Render() const
+void Ship::Render(bool withFX) const
 {
-    m_FX.Render();
+    if (withFX) RenderFX();
     Engine::Renderer2D::DrawRotatedQuad(
         { m_Pos.x, m_Pos.y, 0.5f },
         { 1.0f, 1.3f },
@@ -79,5 +91,5 @@ void Ship::Reset()
 {
 	m_Pos = { -10.0f, 0.0f };
 	m_Vel = { 5.0f, 0.0f };
-	m_Time = 0.0f; m_SmokeT = m_SmokeEvery;
+	m_Smoke.Clear(); m_Flame.Restart();
 }
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include "Engine/Core/Input.h"
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/FXSystem.h"
+#include "Engine/Renderer/FXEmitter.h"
+#include "Engine/Renderer/FXTrail.h"
+#include "Engine/Physics/SpatialHash.h"
 #include "Engine/Physics/Acceleration.h"
 
 class Ship {
@@ -13,7 +16,11 @@ public:
 
     void LoadAssets();
     void Update(Engine::Timestep dt);
-    void Render() const;
+    // withFX = false leaves the smoke trail and exhaust particles to RenderFX
+    void Render(bool withFX = true) const;
+    void RenderFX() const { m_Smoke.Render(); m_FX.Render(); }
+    // The flame bounces off these; nullptr turns collision off
+    void SetColliders(const Engine::SpatialHash* world) { m_FX.SetCollision(world, Engine::FXCollision::Bounce, 0.3f); }
     void Reset();
 
     float HeadingDeg() const { return m_Vel.y * 4.0f - 90.0f; }
@@ -27,10 +34,9 @@ private:
     float m_Thrust = 0.5f;
     Engine::Acceleration m_Gravity{ { 0.0f, -0.4f } };
 
-    float m_Time = 0.0f, m_SmokeT = 0.0f, m_SmokeEvery = 0.4f;
-
-    Engine::FXSystem m_FX;
-    Engine::FXSpec   m_Smoke, m_Flame;
+    Engine::FXSystem  m_FX;
+    Engine::FXEmitter m_Flame;
+    Engine::FXTrail   m_Smoke;
 
     Engine::Shared<Engine::Texture2D> m_Tex;
 };
@@ -0,0 +1,55 @@
+#pragma once
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Renderer/RendererBackend.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "Platforms/Software/SoftwareDevice.h"
+
+namespace TestHelpers {
+
+    // Switches to a headless backend for one scope and restores the previous
+    // API after. The recording log / software device is reset on both ends.
+    class BackendGuard {
+    public:
+        enum class Setup {
+            Creators, // resource creators only
+            Renderer  // full Renderer::Init / Shutdown (Renderer2D included)
+        };
+
+        explicit BackendGuard(Engine::RendererAPI::API api, Setup setup = Setup::Creators)
+            : m_API(api), m_Setup(setup), m_Previous(Engine::RendererAPI::GetAPI())
+        {
+            Engine::RendererAPI::SetAPI(api);
+            ResetDevice();
+            if (setup == Setup::Renderer) Engine::Renderer::Init();
+            else if (api == Engine::RendererAPI::API::Software) Engine::Detail::UseSoftwareCreators();
+            else Engine::Detail::UseRecordingCreators();
+        }
+        ~BackendGuard() {
+            if (m_Setup == Setup::Renderer) Engine::Renderer::Shutdown();
+            ResetDevice();
+            Engine::RendererAPI::SetAPI(m_Previous);
+        }
+
+        BackendGuard(const BackendGuard&) = delete;
+        BackendGuard& operator=(const BackendGuard&) = delete;
+
+    private:
+        void ResetDevice() const {
+            if (m_API == Engine::RendererAPI::API::Software) Engine::SoftwareDevice::Get().Reset();
+            else Engine::RecordingLog::Get().Reset();
+        }
+
+        Engine::RendererAPI::API m_API;
+        Setup m_Setup;
+        Engine::RendererAPI::API m_Previous;
+    };
+
+    // Recording-backend shader with the Quad2D vertex inputs (position, colour).
+    inline Engine::Shared<Engine::Shader> QuadShader() {
+        return Engine::Shader::Create("Quad2D",
+            "layout(location = 0) in vec3 a_Position;\n"
+            "layout(location = 1) in vec4 a_Color;\n", "");
+    }
+
+} // namespace TestHelpers
@@ -13,6 +13,9 @@ TEST(Integration, AssetsArePresent)
     const fs::path shader1 = base / "shaders" / "FlatColor.glsl";
     EXPECT_TRUE(fs::exists(shader1)) << "Lack of shader: " << shader1.string();
 
+    const fs::path shader2 = base / "shaders" / "Quad2D.glsl";
+    EXPECT_TRUE(fs::exists(shader2)) << "Lack of shader: " << shader2.string();
+
     const fs::path texture0 = base / "textures" / "Checkerboard.png";
     EXPECT_TRUE(fs::exists(texture0)) << "Lack of texture: " << texture0.string();
 
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "InputTestHelpers.h"
+#include "RendererTestHelpers.h"
+#include "Course.h"
+#include "PlaySceneFrame.h"
+
+namespace fs = std::filesystem;
+
+// Draw-cost budgets for the Sandbox play scene, measured on the recording
+// backend. A failure here means batching regressed; the message lists the
+// commands of the offending frame.
+//
+// A frame is one batch each for the scene and the ship FX, the FX
+// composite and the dynamic-resolution resolve. The scene is ~14 quads and
+// the FX ~100 (a second of flame plus the smoke trail); a quad uploads
+// 4 * (12 + 32) bytes, so 256 quads leave twice the headroom.
+namespace {
+    constexpr uint32_t kMaxDrawCalls = 4;
+    constexpr uint64_t kMaxVertexBytes = 256 * 4 * (sizeof(glm::vec3) + sizeof(Engine::Renderer2D::QuadAttribVertex));
+}
+
+TEST(Integration, PlaySceneFrameStaysWithinDrawBudget)
+{
+    using namespace Engine;
+    ASSERT_TRUE(fs::exists("assets/shaders/Quad2D.glsl")) << "CWD=" << fs::current_path().string();
+
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording, TestHelpers::BackendGuard::Setup::Renderer);
+    TestHelpers::InputGuard input(std::make_unique<TestHelpers::FakeInputBackend>());
+    auto& log = RecordingLog::Get();
+
+    OrthographicCamera camera(-8.0f * 16.0f / 9.0f, 8.0f * 16.0f / 9.0f, -8.0f, 8.0f);
+    Course course;
+    course.Initialize();
+    PlaySceneFrame frame(1280, 720);
+    log.EndFrame(); // loading is not part of a frame
+
+    // PlaySceneLayer::OnUpdate while running
+    constexpr int frames = 120;
+    for (int i = 0; i < frames; ++i) {
+        const glm::vec2& ship = course.PlayerRef().Position();
+        camera.SetPosition({ ship.x, ship.y, 0.0f });
+        course.Tick(Timestep(1.0f / 60.0f));
+        frame.Render(Timestep(1.0f / 60.0f), camera, course);
+        log.EndFrame();
+    }
+
+    const auto& recorded = log.Frames();
+    ASSERT_EQ(recorded.size(), 121u);
+
+    uint32_t worstDraws = 0;
+    uint64_t worstBytes = 0;
+    for (size_t i = 1; i < recorded.size(); ++i) {
+        const RecordedFrame& f = recorded[i];
+        EXPECT_GE(f.DrawCalls, 3u); // scene, composite and resolve at least
+        EXPECT_LE(f.DrawCalls, kMaxDrawCalls) << "frame " << f.Index << ":\n" << log.Dump(f.Index);
+        EXPECT_LE(f.VertexBytes, kMaxVertexBytes) << "frame " << f.Index << ":\n" << log.Dump(f.Index);
+        worstDraws = std::max(worstDraws, f.DrawCalls);
+        worstBytes = std::max(worstBytes, f.VertexBytes);
+    }
+    ::testing::Test::RecordProperty("worst_draw_calls", (int)worstDraws);
+    ::testing::Test::RecordProperty("worst_vertex_bytes", (int)worstBytes);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+#include "Engine/Renderer/LowResolutionPass.h"
+#include "Platforms/Software/SoftwareDevice.h"
+#include "InputTestHelpers.h"
+#include "Course.h"
+
+namespace fs = std::filesystem;
+using namespace Engine;
+
+namespace {
+
+    class SoftwareScene : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            ASSERT_TRUE(fs::exists("assets/shaders/Quad2D.glsl")) << "CWD=" << fs::current_path().string();
+            m_Previous = RendererAPI::GetAPI();
+            RendererAPI::SetAPI(RendererAPI::API::Software);
+            Renderer::Init();
+        }
+        void TearDown() override {
+            Renderer::Shutdown();
+            SoftwareDevice::Get().Reset();
+            RendererAPI::SetAPI(m_Previous);
+        }
+
+        RendererAPI::API m_Previous = RendererAPI::API::OpenGL;
+    };
+
+    uint32_t Channel(uint32_t pixel, int c) { return (pixel >> (8 * c)) & 0xff; }
+
+}
+
+TEST_F(SoftwareScene, CompositeMatchesDirectTranslucentDraw)
+{
+    constexpr uint32_t size = 64;
+    RenderCommand::SetViewport(0, 0, size, size);
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    const glm::vec4 smoke{ 1.0f, 0.5f, 0.0f, 0.5f };
+
+    auto background = [&] {
+        RenderCommand::SetClearColor({ 0.0f, 0.0f, 1.0f, 1.0f });
+        RenderCommand::Clear();
+    };
+
+    background();
+    Renderer2D::BeginScene(camera);
+    Renderer2D::DrawQuad({ 0.0f, 0.0f }, { 2.0f, 2.0f }, smoke);
+    Renderer2D::EndScene();
+    const uint32_t direct = SoftwareDevice::Get().Framebuffer().Color[size * size / 2 + size / 2];
+
+    LowResolutionPass pass(size, size, 0.5f);
+    background();
+    pass.Begin(camera);
+    Renderer2D::DrawQuad({ 0.0f, 0.0f }, { 2.0f, 2.0f }, smoke);
+    pass.End();
+    pass.Composite();
+    const uint32_t composited = SoftwareDevice::Get().Framebuffer().Color[size * size / 2 + size / 2];
+
+    EXPECT_EQ(pass.GetStats().Width, size / 2);
+    // RGB only: the direct draw's destination alpha is blended as a color
+    for (int c = 0; c < 3; ++c)
+        EXPECT_NEAR((int)Channel(composited, c), (int)Channel(direct, c), 1) << "channel " << c;
+}
+
+// Render-thread mode: the pass is driven while recording, and its target is
+// reallocated and sampled when the frame is replayed.
+TEST_F(SoftwareScene, ResizeRecordedWithTheFrameTakesEffectAtReplay)
+{
+    constexpr uint32_t size = 96;
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    const glm::vec4 smoke{ 1.0f, 0.5f, 0.0f, 0.5f };
+    LowResolutionPass pass(64, 64, 0.5f);
+
+    CommandList frame;
+    {
+        CommandList::RecordingScope recording(frame);
+        RenderCommand::SetViewport(0, 0, size, size);
+        pass.OnResize(size, size);
+        RenderCommand::SetClearColor({ 0.0f, 0.0f, 1.0f, 1.0f });
+        RenderCommand::Clear();
+        pass.Begin(camera);
+        Renderer2D::DrawQuad({ 0.0f, 0.0f }, { 2.0f, 2.0f }, smoke);
+        pass.End();
+        pass.Composite();
+    }
+    EXPECT_EQ(pass.GetStats().Width, size / 2);
+
+    CommandQueue queue;
+    queue.Submit(std::move(frame));
+    queue.Execute();
+
+    // Premultiplied smoke over blue
+    const uint32_t composited = SoftwareDevice::Get().Framebuffer().Color[size * size / 2 + size / 2];
+    EXPECT_NEAR((int)Channel(composited, 0), 128, 2);
+    EXPECT_NEAR((int)Channel(composited, 1), 64, 2);
+    EXPECT_NEAR((int)Channel(composited, 2), 128, 2);
+}
+
+TEST_F(SoftwareScene, ShipExhaustAtReducedScales)
+{
+    constexpr uint32_t width = 640, height = 360;
+    TestHelpers::InputGuard input(std::make_unique<TestHelpers::FakeInputBackend>());
+    RenderCommand::SetViewport(0, 0, width, height);
+    OrthographicCamera camera(-8.0f * 16.0f / 9.0f, 8.0f * 16.0f / 9.0f, -8.0f, 8.0f);
+
+    Course course;
+    course.Initialize();
+    LowResolutionPass pass(width, height);
+    pass.SetDepthAware(true);
+
+    for (float scale : { 1.0f, 0.5f, 0.25f }) {
+        pass.SetScale(scale);
+        for (int i = 0; i < 30; ++i) {
+            course.Tick(Timestep(1.0f / 60.0f));
+            const glm::vec2& ship = course.PlayerRef().Position();
+            camera.SetPosition({ ship.x, ship.y, 0.0f });
+
+            RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+            RenderCommand::Clear();
+            Renderer2D::BeginScene(camera);
+            course.Draw(false);
+            Renderer2D::EndScene();
+
+            pass.Begin(camera);
+            course.DrawFX();
+            pass.End();
+            pass.Composite();
+        }
+        SoftwareDevice::Get().Framebuffer();
+        EXPECT_EQ(pass.GetStats().Width, (uint32_t)(width * scale));
+        EXPECT_EQ(pass.GetStats().Height, (uint32_t)(height * scale));
+    }
+
+    const auto& timings = pass.GetTimings();
+    ASSERT_EQ(timings.size(), 3u);
+    for (const auto& t : timings) {
+        EXPECT_EQ(t.Samples, 30u);
+        ::testing::Test::RecordProperty("fx_pass_ms_scale_" + std::to_string((int)(t.Scale * 100)), std::to_string(t.AverageMs));
+    }
+}
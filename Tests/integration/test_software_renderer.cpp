@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+#include "Engine/Renderer/ImageWriter.h"
+#include "Platforms/Software/SoftwareDevice.h"
+#include "InputTestHelpers.h"
+#include "Course.h"
+
+namespace fs = std::filesystem;
+
+// Runs the Sandbox course through the normal Renderer2D path on the
+// software backend: no window, no GL context.
+TEST(Integration, SoftwareRendererDrawsSandboxFramesHeadless)
+{
+    using namespace Engine;
+    ASSERT_TRUE(fs::exists("assets/shaders/Quad2D.glsl")) << "CWD=" << fs::current_path().string();
+
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Software);
+    TestHelpers::InputGuard input(std::make_unique<TestHelpers::FakeInputBackend>());
+
+    constexpr uint32_t width = 640, height = 360;
+    Renderer::Init();
+    RenderCommand::SetViewport(0, 0, width, height);
+
+    const float aspect = (float)width / (float)height;
+    OrthographicCamera camera(-8.0f * aspect, 8.0f * aspect, -8.0f, 8.0f);
+
+    {
+        Course course;
+        course.Initialize();
+
+        auto& device = SoftwareDevice::Get();
+        device.ResetStats();
+
+        constexpr int frames = 60;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; ++i) {
+            course.Tick(Timestep(1.0f / 60.0f));
+            const glm::vec2& ship = course.PlayerRef().Position();
+            camera.SetPosition({ ship.x, ship.y, 0.0f });
+            RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+            RenderCommand::Clear();
+            Renderer2D::BeginScene(camera);
+            course.Draw();
+            Renderer2D::EndScene();
+        }
+        const SoftwareFramebuffer& fb = device.Framebuffer();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        ::testing::Test::RecordProperty("frames_per_second", std::to_string(frames / seconds));
+        ::testing::Test::RecordProperty("fragments_per_frame", std::to_string(device.GetStats().Fragments / frames));
+
+        ASSERT_EQ(fb.Width, width);
+        ASSERT_EQ(fb.Height, height);
+        size_t lit = 0;
+        for (uint32_t p : fb.Color)
+            lit += (p & 0x00ffffffu) != 0;
+        EXPECT_GT(lit, fb.Color.size() / 2) << "background quads should cover most of the frame";
+
+        EXPECT_TRUE(ImageWriter::WriteTGA("software_frame.tga", fb.Width, fb.Height,
+            reinterpret_cast<const uint8_t*>(fb.Color.data()), true));
+    }
+
+    Renderer::Shutdown();
+    RendererAPI::SetAPI(previous);
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/Buffer.h"
+
+using namespace Engine;
+
+TEST(BufferLayout, StrideAndOffsets)
+{
+    BufferLayout layout = {
+        { ShaderDataType::Float3, "a_Position" },
+        { ShaderDataType::Float2, "a_TexCoord" },
+    };
+
+    EXPECT_EQ(layout.Stride(), 20u);
+    EXPECT_EQ(layout.Elements()[0].Offset, 0u);
+    EXPECT_EQ(layout.Elements()[1].Offset, 12u);
+}
+
+TEST(BufferLayout, HashIgnoresNamesButNotFormat)
+{
+    BufferLayout a = { { ShaderDataType::Float3, "a_Position" }, { ShaderDataType::Float2, "a_TexCoord" } };
+    BufferLayout b = { { ShaderDataType::Float3, "a_Pos" },      { ShaderDataType::Float2, "a_UV" } };
+    BufferLayout c = { { ShaderDataType::Float3, "a_Position" }, { ShaderDataType::Float4, "a_Color" } };
+    BufferLayout d = { { ShaderDataType::Float3, "a_Position" }, { ShaderDataType::Float2, "a_TexCoord", true } };
+
+    // Same format under different names -> meshes can share one VAO
+    EXPECT_EQ(a.Hash(), b.Hash());
+    EXPECT_NE(a.Hash(), c.Hash());
+    EXPECT_NE(a.Hash(), d.Hash());
+    EXPECT_TRUE(a.SameFormat(b));
+    EXPECT_FALSE(a.SameFormat(c));
+    EXPECT_FALSE(a.SameFormat(d));
+}
+
+TEST(BufferLayout, DivisorIsPartOfTheFormat)
+{
+    BufferLayout perVertex = { { ShaderDataType::Mat4, "a_Transform" } };
+    BufferLayout perInstance = { { ShaderDataType::Mat4, "a_Transform" } };
+    perInstance.SetDivisor(1);
+
+    EXPECT_EQ(perVertex.Divisor(), 0u);
+    EXPECT_EQ(perInstance.Divisor(), 1u);
+    EXPECT_EQ(perInstance.Stride(), 64u);
+    EXPECT_NE(perVertex.Hash(), perInstance.Hash());
+    EXPECT_FALSE(perVertex.SameFormat(perInstance));
+}
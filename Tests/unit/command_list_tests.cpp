@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "Engine/Renderer/CommandList.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Platforms/Recording/RecordingLog.h"
+
+using namespace Engine;
+
+TEST(CommandList, RecordsWithoutGraphicsContext)
+{
+    CommandList list;
+    list.SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
+    list.Clear();
+    list.SetViewProjection(glm::mat4(1.0f));
+    list.DrawQuad({ 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f }, { 1.0f, 0.0f, 0.0f, 1.0f });
+
+    EXPECT_EQ(list.CommandCount(), 4u);
+    EXPECT_GT(list.SizeBytes(), 0u);
+
+    list.Reset();
+    EXPECT_TRUE(list.Empty());
+    EXPECT_EQ(list.SizeBytes(), 0u);
+}
+
+TEST(CommandQueue, SegmentsReplayByKeyThenSubmissionOrder)
+{
+    CommandQueue queue;
+
+    // Lists built on worker threads, as layers would
+    CommandList a, b;
+    std::thread ta([&] {
+        a.SetSortKey(2); a.Clear();
+        a.SetSortKey(0); a.Clear();
+    });
+    std::thread tb([&] {
+        b.SetSortKey(1); b.Clear();
+        b.SetSortKey(2); b.Clear();
+    });
+    ta.join(); tb.join();
+
+    queue.Submit(std::move(a));
+    queue.Submit(std::move(b));
+
+    const auto order = queue.SortedSegments();
+    using P = std::pair<uint32_t, uint32_t>;
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order[0], P(0, 1)); // key 0
+    EXPECT_EQ(order[1], P(1, 0)); // key 1
+    EXPECT_EQ(order[2], P(0, 0)); // key 2, submitted first
+    EXPECT_EQ(order[3], P(1, 1)); // key 2
+}
+
+TEST(CommandQueue, ReplayMergesQuadsAcrossListsIntoOneBatch)
+{
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Recording);
+    Renderer::Init();
+    auto& log = RecordingLog::Get();
+    log.Reset();
+    Renderer2D::ResetStats();
+
+    float vertices[3 * 3] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+    uint32_t indices[3] = { 0, 1, 2 };
+    auto vb = VertexBuffer::Create(vertices, sizeof(vertices));
+    vb->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+    auto mesh = VertexArray::Create();
+    mesh->AddVertexBuffer(vb);
+    mesh->SetIndexBuffer(IndexBuffer::Create(indices, 3));
+    auto shader = Shader::Create("Flat", "layout(location = 0) in vec3 a_Position;\n", "");
+
+    const glm::mat4 viewProjection(1.0f);
+    CommandList a, b, c;
+    a.SetSortKey(0);
+    a.SetViewProjection(viewProjection);
+    for (int i = 0; i < 3; ++i) a.DrawQuad({ (float)i, 0.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    a.SetSortKey(2);
+    for (int i = 0; i < 2; ++i) a.DrawQuad({ (float)i, 1.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    b.SetSortKey(0);
+    b.SetViewProjection(viewProjection);
+    for (int i = 0; i < 4; ++i) b.DrawQuad({ (float)i, 2.0f, 0.0f }, { 1.0f, 1.0f }, glm::vec4(1.0f));
+    // A mesh draw between the quads has to end the batch
+    c.SetSortKey(1);
+    c.BindShader(shader);
+    c.SetMat4("u_ViewProjection", viewProjection);
+    c.DrawIndexed(mesh);
+
+    CommandQueue queue;
+    queue.Submit(std::move(a));
+    queue.Submit(std::move(b));
+    queue.Submit(std::move(c));
+    queue.Execute();
+
+    // a0 + b0 in one batch, the mesh, then a2 in a second batch
+    EXPECT_EQ(Renderer2D::GetStats().QuadCount, 9u);
+    EXPECT_EQ(Renderer2D::GetStats().DrawCalls, 2u);
+    EXPECT_EQ(log.CurrentFrame().DrawCalls, 3u);
+    EXPECT_EQ(log.CurrentFrame().Indices, 9u * 6u + 3u);
+    EXPECT_EQ(queue.GetStats().Lists, 3u);
+    EXPECT_EQ(queue.GetStats().Segments, 4u);
+
+    Renderer::Shutdown();
+    log.Reset();
+    RendererAPI::SetAPI(previous);
+}
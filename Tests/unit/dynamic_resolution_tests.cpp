@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/DynamicResolution.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+
+namespace {
+
+    // EndFrame composites through Renderer2D, so the whole renderer comes up
+    using Setup = TestHelpers::BackendGuard::Setup;
+
+    void Feed(DynamicResolution& dr, float frameMs, int frames) {
+        for (int i = 0; i < frames; ++i) dr.Update(Timestep(frameMs / 1000.0f));
+    }
+
+}
+
+TEST(DynamicResolution, LowersScaleWhenOverBudgetAndRecovers)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording, Setup::Renderer);
+    DynamicResolution::Settings s;
+    s.TargetFrameMs = 16.0f;
+    DynamicResolution dr(1280, 720, s);
+    EXPECT_EQ(dr.GetScale(), 1.0f);
+
+    // 24 ms against a 16 ms budget: drops, never below MinScale
+    Feed(dr, 24.0f, 600);
+    EXPECT_EQ(dr.GetScale(), s.MinScale);
+
+    // Headroom again: back to full resolution, without waiting out a wound-up integral
+    Feed(dr, 8.0f, 120);
+    EXPECT_EQ(dr.GetScale(), s.MaxScale);
+
+    dr.BeginFrame();
+    EXPECT_EQ(dr.GetStats().RenderWidth, 1280u);
+    EXPECT_EQ(dr.GetStats().RenderHeight, 720u);
+    dr.EndFrame();
+}
+
+TEST(DynamicResolution, SettlesAndQuantizesNearBudget)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording, Setup::Renderer);
+    DynamicResolution::Settings s;
+    s.TargetFrameMs = 16.0f;
+    DynamicResolution dr(1000, 500, s);
+
+    // Slightly over budget: the scale moves down but stays on the Step grid
+    Feed(dr, 17.0f, 30);
+    const float scale = dr.GetScale();
+    EXPECT_LT(scale, 1.0f);
+    EXPECT_GE(scale, s.MinScale);
+    EXPECT_FLOAT_EQ(std::round(scale / s.Step) * s.Step, scale);
+
+    // On budget: no further changes
+    Feed(dr, 16.0f, 600);
+    const uint32_t changes = dr.GetStats().ScaleChanges;
+    Feed(dr, 16.0f, 60);
+    EXPECT_EQ(dr.GetStats().ScaleChanges, changes);
+
+    dr.BeginFrame();
+    EXPECT_EQ(dr.GetStats().RenderWidth, (uint32_t)std::lround(1000 * dr.GetScale()));
+    dr.EndFrame();
+
+    dr.SetEnabled(false);
+    EXPECT_EQ(dr.GetScale(), s.MaxScale);
+}
+
+// Render-thread mode: a window resize arrives while the main thread records
+// the frame. The target must be reallocated in stream order at replay, not
+// on the recording thread.
+TEST(DynamicResolution, ResizeWhileRecordingIsReplayedInOrder)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording, Setup::Renderer);
+    DynamicResolution dr(1280, 720);
+    auto& log = RecordingLog::Get();
+    log.Reset();
+
+    CommandList frame;
+    {
+        CommandList::RecordingScope recording(frame);
+        dr.BeginFrame();
+        dr.EndFrame();
+        dr.OnResize(1920, 1080);
+        dr.BeginFrame();
+        EXPECT_EQ(dr.GetStats().RenderWidth, 1920u);
+        EXPECT_EQ(dr.GetStats().RenderHeight, 1080u);
+        dr.EndFrame();
+    }
+    EXPECT_TRUE(log.Commands().empty()) << log.Dump(0);
+
+    CommandQueue queue;
+    queue.Submit(std::move(frame));
+    queue.Execute();
+
+    std::vector<std::string> targets;
+    for (const RecordedCommand& c : log.Commands())
+        if (c.Op == RecordedOp::BindFramebuffer) targets.push_back(c.Name);
+    EXPECT_EQ(targets, (std::vector<std::string>{
+        "offscreen 1280x720", "previous", "offscreen 1920x1080", "previous" }));
+    EXPECT_EQ(log.CurrentFrame().DrawCalls, 2u); // one composite quad per frame
+    log.Reset();
+}
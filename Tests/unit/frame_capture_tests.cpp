@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "Engine/Renderer/FrameCapture.h"
+#include "Engine/Renderer/ImageWriter.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "Platforms/Software/SoftwareDevice.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+namespace fs = std::filesystem;
+
+namespace {
+
+    std::vector<uint8_t> ReadFile(const fs::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    }
+
+    // Reference QOI decoder (spec order of ops); returns top-down RGBA
+    std::vector<uint8_t> DecodeQOI(const std::vector<uint8_t>& d, uint32_t& w, uint32_t& h) {
+        auto be32 = [&d](size_t i) { return (uint32_t)d[i] << 24 | (uint32_t)d[i + 1] << 16 | (uint32_t)d[i + 2] << 8 | d[i + 3]; };
+        if (d.size() < 22 || std::string(d.begin(), d.begin() + 4) != "qoif") return {};
+        w = be32(4);
+        h = be32(8);
+        std::vector<uint8_t> px((size_t)w * h * 4);
+        uint8_t index[64][4] = {};
+        uint8_t p[4] = { 0, 0, 0, 255 };
+        size_t i = 14;
+        uint32_t run = 0;
+        for (size_t o = 0; o < px.size(); o += 4) {
+            if (run) run--;
+            else {
+                const uint8_t b = d[i++];
+                if (b == 0xfe) { p[0] = d[i++]; p[1] = d[i++]; p[2] = d[i++]; }
+                else if (b == 0xff) { p[0] = d[i++]; p[1] = d[i++]; p[2] = d[i++]; p[3] = d[i++]; }
+                else if ((b & 0xc0) == 0x00) std::memcpy(p, index[b], 4);
+                else if ((b & 0xc0) == 0x40) {
+                    p[0] += ((b >> 4) & 3) - 2; p[1] += ((b >> 2) & 3) - 2; p[2] += (b & 3) - 2;
+                }
+                else if ((b & 0xc0) == 0x80) {
+                    const int dg = (b & 0x3f) - 32, b2 = d[i++];
+                    p[0] += dg + ((b2 >> 4) & 0xf) - 8; p[1] += dg; p[2] += dg + (b2 & 0xf) - 8;
+                }
+                else run = b & 0x3f;
+                std::memcpy(index[(p[0] * 3 + p[1] * 5 + p[2] * 7 + p[3] * 11) % 64], p, 4);
+            }
+            std::memcpy(&px[o], p, 4);
+        }
+        return px;
+    }
+
+}
+
+TEST(ImageWriter, QoiRoundTripsBottomUpPixels)
+{
+    constexpr uint32_t w = 37, h = 23;
+    std::vector<uint8_t> rgba((size_t)w * h * 4);
+    for (uint32_t y = 0; y < h; ++y)
+        for (uint32_t x = 0; x < w; ++x) {
+            uint8_t* p = &rgba[((size_t)y * w + x) * 4];
+            // Runs, small steps, big jumps and alpha changes
+            p[0] = (uint8_t)(x < 10 ? 40 : x * 7);
+            p[1] = (uint8_t)(y * 11);
+            p[2] = (uint8_t)((x * y) & 0xff);
+            p[3] = (uint8_t)(x % 5 == 0 ? 128 : 255);
+        }
+
+    const fs::path path = fs::temp_directory_path() / "eg_roundtrip.qoi";
+    ASSERT_TRUE(ImageWriter::Write(path.string(), w, h, rgba.data(), true));
+    uint32_t dw = 0, dh = 0;
+    const auto decoded = DecodeQOI(ReadFile(path), dw, dh);
+    ASSERT_EQ(dw, w);
+    ASSERT_EQ(dh, h);
+    for (uint32_t y = 0; y < h; ++y) // decoded is top-down
+        ASSERT_EQ(std::memcmp(&decoded[(size_t)y * w * 4], &rgba[(size_t)(h - 1 - y) * w * 4], w * 4), 0) << "row " << y;
+    fs::remove(path);
+
+    const fs::path png = fs::temp_directory_path() / "eg_header.png";
+    ASSERT_TRUE(ImageWriter::Write(png.string(), w, h, rgba.data(), true));
+    const auto bytes = ReadFile(png);
+    ASSERT_GT(bytes.size(), (size_t)w * h * 4);
+    EXPECT_EQ(std::string(bytes.begin() + 12, bytes.begin() + 16), "IHDR");
+    EXPECT_EQ(std::string(bytes.end() - 8, bytes.end() - 4), "IEND");
+    fs::remove(png);
+}
+
+TEST(FrameCapture, SoftwareScreenshotMatchesBackbuffer)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Software);
+    auto& device = SoftwareDevice::Get();
+    device.Reset();
+    RenderCommand::SetViewport(0, 0, 40, 30);
+    RenderCommand::SetClearColor({ 1.0f, 0.5f, 0.0f, 1.0f });
+    RenderCommand::Clear();
+
+    const fs::path path = fs::temp_directory_path() / "eg_capture.qoi";
+    {
+        FrameCapture capture;
+        capture.CaptureNextFrame(path.string());
+        capture.OnFrameEnd(40, 30);
+        capture.Flush();
+        EXPECT_EQ(capture.GetStats().Written, 1u);
+        EXPECT_EQ(capture.GetStats().Dropped, 0u);
+    }
+
+    uint32_t w = 0, h = 0;
+    const auto px = DecodeQOI(ReadFile(path), w, h);
+    ASSERT_EQ(w, 40u);
+    ASSERT_EQ(h, 30u);
+    const uint32_t expected = device.Framebuffer().Color[0];
+    EXPECT_EQ(px[0], expected & 0xff);
+    EXPECT_EQ(px[1], (expected >> 8) & 0xff);
+    EXPECT_EQ(px[3], 255u);
+    fs::remove(path);
+    device.Reset();
+}
+
+TEST(FrameCapture, SequenceWritesEveryFrameWithoutBlocking)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording);
+    auto& log = RecordingLog::Get();
+    log.Reset();
+
+    const fs::path dir = fs::temp_directory_path() / "eg_sequence";
+    fs::remove_all(dir);
+    constexpr int frames = 12;
+    {
+        FrameCapture capture(3, 16);
+        capture.StartSequence(dir.string(), ".qoi");
+        for (int i = 0; i < frames; ++i) {
+            capture.OnFrameEnd(64, 32);
+            log.EndFrame();
+        }
+        capture.StopSequence();
+        capture.OnFrameEnd(64, 32); // not captured
+        capture.Flush();
+
+        const auto stats = capture.GetStats();
+        EXPECT_EQ(stats.Requested, (uint64_t)frames);
+        EXPECT_EQ(stats.Written, (uint64_t)frames);
+        EXPECT_GE(stats.LatencyFrames, 1.0);
+    }
+
+    EXPECT_EQ(log.Frames()[0].ReadbackBytes, 64u * 32u * 4u);
+    EXPECT_EQ(std::distance(fs::directory_iterator(dir), fs::directory_iterator{}), frames);
+    EXPECT_TRUE(fs::exists(dir / "frame_000000.qoi"));
+    EXPECT_TRUE(fs::exists(dir / "frame_000011.qoi"));
+    fs::remove_all(dir);
+    log.Reset();
+}
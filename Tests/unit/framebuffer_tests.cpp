@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/CachedLayer.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "Platforms/Software/SoftwareBuffer.h"
+#include "Platforms/Software/SoftwareDevice.h"
+#include "Platforms/Software/SoftwareShader.h"
+#include "Platforms/Software/SoftwareTexture.h"
+#include "Platforms/Software/SoftwareVertexArray.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+
+namespace {
+
+    // Full-viewport quad in NDC
+    Shared<VertexArray> MakeQuad(const glm::vec4& color) {
+        float v[] = {
+            -1.0f, -1.0f, 0.0f,  color.r, color.g, color.b, color.a,
+             1.0f, -1.0f, 0.0f,  color.r, color.g, color.b, color.a,
+             1.0f,  1.0f, 0.0f,  color.r, color.g, color.b, color.a,
+            -1.0f,  1.0f, 0.0f,  color.r, color.g, color.b, color.a,
+        };
+        uint32_t idx[] = { 0, 1, 2, 2, 3, 0 };
+        auto vb = VertexBuffer::Create(v, (uint32_t)sizeof(v));
+        vb->SetLayout({ { ShaderDataType::Float3, "a_Position" },
+                        { ShaderDataType::Float4, "a_Color" } });
+        auto va = VertexArray::Create();
+        va->AddVertexBuffer(vb);
+        va->SetIndexBuffer(IndexBuffer::Create(idx, 6u));
+        return va;
+    }
+
+}
+
+TEST(Framebuffer, SoftwareTargetCapturesDrawsAndLeavesBackbufferAlone)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Software);
+    auto& device = SoftwareDevice::Get();
+    device.Reset();
+    RenderCommand::SetViewport(0, 0, 32, 32);
+    RenderCommand::SetClearColor({ 0.0f, 0.0f, 1.0f, 1.0f });
+    RenderCommand::Clear();
+
+    SoftwareShader shader("test", "layout(location = 0) in vec3 a_Position;\n"
+                                  "layout(location = 1) in vec4 a_Color;\n", "");
+    shader.Binding();
+    auto quad = MakeQuad({ 1.0f, 0.0f, 0.0f, 1.0f });
+
+    auto fb = Framebuffer::Create({ 8, 4 });
+    fb->Bind();
+    RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 0.0f });
+    RenderCommand::Clear();
+    RenderCommand::DrawIndexed(quad);
+    fb->Unbind();
+
+    auto* color = static_cast<SoftwareTexture2D*>(fb->GetColorAttachment().get());
+    ASSERT_EQ(color->GetWidth(), 8u);
+    ASSERT_EQ(color->GetHeight(), 4u);
+    for (uint32_t i = 0; i < 8 * 4; ++i)
+        ASSERT_EQ(color->Pixels()[i], 0xff0000ffu) << i;
+
+    // The default target kept its size and blue clear
+    const SoftwareFramebuffer& screen = device.Framebuffer();
+    EXPECT_EQ(screen.Width, 32u);
+    EXPECT_EQ(screen.Color[0], 0xffff0000u);
+    EXPECT_EQ(screen.Color[32 * 32 - 1], 0xffff0000u);
+
+    fb.reset();
+    device.Reset();
+}
+
+TEST(Framebuffer, NestedBindsRestoreOuterTargetAndViewport)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Software);
+    auto& device = SoftwareDevice::Get();
+    device.Reset();
+    RenderCommand::SetViewport(0, 0, 32, 32);
+
+    SoftwareShader shader("test", "layout(location = 0) in vec3 a_Position;\n"
+                                  "layout(location = 1) in vec4 a_Color;\n", "");
+    shader.Binding();
+    auto green = MakeQuad({ 0.0f, 1.0f, 0.0f, 1.0f });
+
+    auto outer = Framebuffer::Create({ 16, 16 });
+    auto inner = Framebuffer::Create({ 4, 4 });
+    outer->Bind();
+    RenderCommand::SetViewport(0, 0, 8, 8);
+    RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 0.0f });
+    RenderCommand::Clear();
+    inner->Bind();
+    RenderCommand::Clear();
+    inner->Unbind();
+    RenderCommand::DrawIndexed(green); // back in outer, still in the 8x8 corner
+    outer->Unbind();
+
+    const auto* color = static_cast<SoftwareTexture2D*>(outer->GetColorAttachment().get());
+    EXPECT_EQ(color->Pixels()[0], 0xff00ff00u);
+    EXPECT_EQ(color->Pixels()[7 * 16 + 7], 0xff00ff00u);
+    EXPECT_EQ(color->Pixels()[8 * 16 + 8], 0u);
+    const SoftwareDevice::Viewport vp = device.GetViewport();
+    EXPECT_EQ(vp.W, 32u);
+    EXPECT_EQ(vp.H, 32u);
+
+    inner.reset();
+    outer.reset();
+    device.Reset();
+}
+
+TEST(CachedLayer, RendersOnlyWhenInvalidated)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording);
+    auto& log = RecordingLog::Get();
+    log.Reset();
+
+    auto quad = MakeQuad(glm::vec4(1.0f));
+    int renders = 0;
+    CachedLayer layer(256, 64, [&] {
+        ++renders;
+        for (int i = 0; i < 10; ++i) RenderCommand::DrawIndexed(quad);
+    });
+
+    EXPECT_TRUE(layer.Update());
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().DrawCalls, 10u);
+    EXPECT_EQ(log.Frames().back().FramebufferBinds, 2u);
+
+    for (int frame = 0; frame < 5; ++frame) {
+        EXPECT_FALSE(layer.Update());
+        log.EndFrame();
+        EXPECT_EQ(log.Frames().back().DrawCalls, 0u);
+        EXPECT_EQ(log.Frames().back().FramebufferBinds, 0u);
+    }
+    EXPECT_EQ(renders, 1);
+
+    layer.Invalidate();
+    EXPECT_TRUE(layer.Update());
+    layer.Resize(128, 64);
+    EXPECT_FALSE(layer.IsValid());
+    EXPECT_EQ(layer.GetTexture()->GetWidth(), 128u);
+    EXPECT_TRUE(layer.Update());
+    EXPECT_EQ(renders, 3);
+    EXPECT_EQ(layer.GetStats().Renders, 3u);
+
+    log.Reset();
+}
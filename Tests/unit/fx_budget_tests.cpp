@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "Engine/Renderer/FXSystem.h"
+
+using namespace Engine;
+
+namespace {
+    FXSpec Particle(const glm::vec2& pos = { 0.0f, 0.0f }, float size = 1.0f)
+    {
+        FXSpec s;
+        s.pos = pos;
+        s.sizeStart = size;
+        s.sizeEnd = size;
+        s.life = 10.0f;
+        return s;
+    }
+}
+
+TEST(FXBudget, LowerPrioritiesGiveUpTheirShareFirst)
+{
+    FXBudget budget(100);
+    FXSystem low, high;
+    low.ResizePool(1000);
+    high.ResizePool(1000);
+    low.SetBudget(&budget, FXPriority::Low);
+    high.SetBudget(&budget, FXPriority::High);
+
+    for (int i = 0; i < 200; ++i) low.Spawn(Particle());
+    // Thinned past 75% of its 50% share, never over it
+    EXPECT_GE(low.GetLiveCount(), 38u);
+    EXPECT_LE(low.GetLiveCount(), 50u);
+
+    for (int i = 0; i < 200; ++i) high.Spawn(Particle());
+    EXPECT_LE(low.GetLiveCount() + high.GetLiveCount(), 100u);
+    EXPECT_GT(high.GetLiveCount(), 30u);
+
+    // Full budget: even high priority is rejected until something expires
+    budget.BeginFrame();
+    const FXBudget::FrameStats& frame = budget.GetStats().Last;
+    EXPECT_EQ(frame.Requested, 400u);
+    EXPECT_EQ(frame.Admitted, low.GetLiveCount() + high.GetLiveCount());
+    EXPECT_EQ(frame.Requested, frame.Admitted + frame.Throttled + frame.Rejected);
+    EXPECT_GT(frame.Rejected, 0u);
+    EXPECT_GT(frame.Demand, 1.0f);
+    EXPECT_FLOAT_EQ(frame.Pressure, (float)frame.Live / 100.0f);
+
+    high.Update(Timestep(11.0f));
+    low.Update(Timestep(11.0f));
+    budget.BeginFrame();
+    high.Spawn(Particle());
+    EXPECT_EQ(high.GetLiveCount(), 1u);
+}
+
+TEST(FXBudget, CullsDistantAndSubPixelSpawns)
+{
+    FXBudget budget(1000);
+    budget.SetView({ 10.0f, 0.0f }, 4.0f); // one pixel = 0.25 units
+    budget.SetCullDistance(20.0f);
+    FXSystem fx;
+    fx.SetBudget(&budget);
+
+    fx.Spawn(Particle({ 35.0f, 0.0f }));       // 25 units away
+    fx.Spawn(Particle({ 0.0f, 0.0f }, 0.1f)); // under a pixel
+    fx.Spawn(Particle({ 0.0f, 0.0f }));
+    EXPECT_EQ(fx.GetLiveCount(), 1u);
+
+    budget.BeginFrame();
+    EXPECT_EQ(budget.GetStats().Last.Culled, 1u);
+    EXPECT_EQ(budget.GetStats().Last.SubPixel, 1u);
+}
+
+TEST(FXBudget, DetachingSystemsOnEitherSide)
+{
+    auto budget = std::make_unique<FXBudget>(10);
+    FXSystem fx;
+    {
+        FXSystem temporary;
+        temporary.SetBudget(budget.get());
+        for (int i = 0; i < 5; ++i) temporary.Spawn(Particle());
+    }
+    // The destroyed system's particles no longer count
+    budget->BeginFrame();
+    EXPECT_EQ(budget->GetStats().Last.Live, 0u);
+
+    fx.SetBudget(budget.get());
+    budget.reset();
+    EXPECT_EQ(fx.GetBudget(), nullptr);
+    for (int i = 0; i < 20; ++i) fx.Spawn(Particle());
+    EXPECT_EQ(fx.GetLiveCount(), 20u);
+}
+
+TEST(FXBudget, FullPoolSpawnsDoNotAddToTheLiveCount)
+{
+    FXBudget budget(100);
+    FXSystem overwrite, drop;
+    overwrite.ResizePool(10);
+    overwrite.SetOverflow(FXOverflow::Overwrite);
+    drop.ResizePool(10);
+    overwrite.SetBudget(&budget, FXPriority::High);
+    drop.SetBudget(&budget, FXPriority::High);
+
+    // Replaced or dropped particles must not eat the other system's share
+    for (int i = 0; i < 50; ++i) overwrite.Spawn(Particle());
+    for (int i = 0; i < 50; ++i) drop.Spawn(Particle());
+    EXPECT_EQ(overwrite.GetLiveCount(), 10u);
+    EXPECT_EQ(drop.GetLiveCount(), 10u);
+    EXPECT_EQ(drop.GetDroppedCount(), 40u);
+
+    FXSystem other;
+    other.ResizePool(100);
+    other.SetBudget(&budget, FXPriority::High);
+    for (int i = 0; i < 60; ++i) other.Spawn(Particle());
+    EXPECT_GE(other.GetLiveCount(), 50u);
+
+    budget.BeginFrame();
+    EXPECT_EQ(budget.GetStats().Last.Live, 20u + other.GetLiveCount());
+    EXPECT_EQ(budget.GetStats().Last.Rejected, 0u);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/FXEmitter.h"
+
+using namespace Engine;
+
+TEST(FXCurve, InterpolatesBetweenKeysAndClampsOutside)
+{
+    FXCurve<float> curve;
+    curve.Add(0.25f, 2.0f).Add(0.5f, 4.0f).Add(1.0f, 0.0f);
+    EXPECT_EQ(curve.Evaluate(0.0f), 2.0f);
+    EXPECT_FLOAT_EQ(curve.Evaluate(0.375f), 3.0f);
+    EXPECT_FLOAT_EQ(curve.Evaluate(0.75f), 2.0f);
+    EXPECT_EQ(curve.Evaluate(1.5f), 0.0f);
+}
+
+TEST(FXCurve, BakedTablesMatchTheCurvesAtTheirSamples)
+{
+    FXSystem fx;
+    const uint16_t index = fx.AddCurves(
+        FXCurve<glm::vec4>({ 1.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }),
+        FXCurve<float>(1.0f).Add(0.5f, 3.0f).Add(1.0f, 0.0f));
+    const FXCurveLut& lut = fx.GetCurves(index);
+    const uint32_t last = FXCurveLut::LutSize - 1;
+
+    EXPECT_EQ(lut.Color[0], glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(lut.Color[last], glm::vec4(0.0f, 0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(lut.Size[0], 1.0f);
+    EXPECT_EQ(lut.Size[last], 0.0f);
+    EXPECT_TRUE(lut.ConstantSpeed);
+
+    // Spawn, half-way and expiry land on the first, middle and last entries
+    EXPECT_EQ(FXCurveLut::Index(2.0f, 2.0f), 0u);
+    EXPECT_EQ(FXCurveLut::Index(1.0f, 2.0f), (last + 1) / 2);
+    EXPECT_EQ(FXCurveLut::Index(0.0f, 2.0f), last);
+    EXPECT_NEAR(lut.Size[FXCurveLut::Index(1.0f, 2.0f)], 3.0f, 0.1f);
+}
+
+TEST(FXEmitter, RateCarriesFractionsAcrossFrames)
+{
+    FXSystem fx;
+    FXEmitterDesc desc;
+    desc.Rate = 10.0f;
+    desc.Particle.life = 100.0f;
+    FXEmitter emitter(fx, desc);
+
+    for (int i = 0; i < 60; ++i) emitter.Update(Timestep(1.0f / 60.0f));
+    EXPECT_NEAR((double)emitter.GetSpawnedCount(), 10.0, 1.0);
+    EXPECT_EQ(fx.GetLiveCount(), emitter.GetSpawnedCount());
+
+    // Paused: nothing spawns and the cycle does not advance
+    emitter.SetActive(false);
+    const float time = emitter.GetTime();
+    emitter.Update(Timestep(1.0f));
+    EXPECT_EQ(emitter.GetTime(), time);
+    EXPECT_EQ(fx.GetLiveCount(), emitter.GetSpawnedCount());
+}
+
+TEST(FXEmitter, BurstsFireOncePerScheduledTimeAcrossLoops)
+{
+    FXSystem fx;
+    FXEmitterDesc desc;
+    desc.Particle.life = 100.0f;
+    desc.Duration = 1.0f;
+    desc.Loop = true;
+    desc.Bursts.push_back({ 0.0f, 5, 1, 0.0f });   // cycle start
+    desc.Bursts.push_back({ 0.25f, 2, 3, 0.25f }); // 0.25, 0.5, 0.75
+    FXEmitter emitter(fx, desc);
+
+    // Steps that straddle cycle boundaries and burst times; 2.7 s is two
+    // whole cycles plus the bursts at 2.0, 2.25 and 2.5
+    for (int i = 0; i < 27; ++i) emitter.Update(Timestep(0.1f));
+    EXPECT_EQ(emitter.GetSpawnedCount(), 2u * (5 + 3 * 2) + 5 + 2 * 2);
+    EXPECT_FALSE(emitter.IsFinished());
+
+    // A single long step still catches every cycle
+    emitter.Restart();
+    const uint64_t before = emitter.GetSpawnedCount();
+    emitter.Update(Timestep(2.0f));
+    EXPECT_EQ(emitter.GetSpawnedCount() - before, 2u * (5 + 3 * 2));
+}
+
+TEST(FXEmitter, OneShotFinishesAfterItsDuration)
+{
+    FXSystem fx;
+    FXEmitterDesc desc;
+    desc.Particle.life = 100.0f;
+    desc.Duration = 0.5f;
+    desc.Loop = false;
+    desc.Rate = 20.0f;
+    FXEmitter emitter(fx, desc);
+
+    emitter.Update(Timestep(2.0f));
+    EXPECT_TRUE(emitter.IsFinished());
+    EXPECT_EQ(emitter.GetSpawnedCount(), 10u);
+    emitter.Update(Timestep(1.0f));
+    EXPECT_EQ(emitter.GetSpawnedCount(), 10u);
+}
+
+TEST(FXEmitter, SpeedCurveScalesVelocityOverLifetime)
+{
+    FXSystem fx;
+    FXEmitterDesc desc;
+    desc.Particle.vel = { 1.0f, 0.0f };
+    desc.Particle.life = 1.0f;
+    desc.Speed = FXCurve<float>(1.0f).Add(0.5f, 1.0f).Add(0.5001f, 0.0f);
+    desc.Bursts.push_back({});
+    FXEmitter emitter(fx, desc);
+    emitter.Update(Timestep(1e-4f));
+    ASSERT_EQ(fx.GetLiveCount(), 1u);
+
+    // Moves at full speed for the first half of its life, then stops
+    for (int i = 0; i < 9; ++i) fx.Update(Timestep(0.1f));
+    EXPECT_NEAR(fx.GetStreams().x[0], 0.5f, 0.02f);
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <glm/gtc/matrix_transform.hpp>
+#include "Engine/Renderer/FXSystem.h"
+#include "Engine/Physics/SpatialHash.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Platforms/Software/SoftwareDevice.h"
+
+using namespace Engine;
+
+TEST(FXSystem, IntegratesLiveParticlesAndFreezesExpiredOnes)
+{
+    FXSystem fx;
+    fx.ResizePool(5); // padded up to a whole SIMD step
+    EXPECT_EQ(fx.GetPoolSize(), 5u);
+    EXPECT_EQ(fx.GetStreams().x.size() % FXSystem::Lanes, 0u);
+
+    FXSpec shortLived;
+    shortLived.vel = { 1.0f, 0.0f };
+    shortLived.life = 0.25f;
+    FXSpec longLived;
+    longLived.pos = { 0.0f, 1.0f };
+    longLived.vel = { 0.0f, -2.0f };
+    longLived.life = 10.0f;
+    fx.Spawn(shortLived);
+    fx.Spawn(longLived);
+
+    for (int i = 0; i < 4; ++i) fx.Update(Timestep(0.1f));
+
+    // The short-lived one expired in the third step; the survivor moved into its slot
+    const FXStreams& p = fx.GetStreams();
+    ASSERT_EQ(fx.GetLiveCount(), 1u);
+    EXPECT_NEAR(p.left[0], 9.6f, 1e-5f);
+    EXPECT_NEAR(p.y[0], 1.0f - 0.8f, 1e-5f);
+    // Everything past the live range is dead
+    for (size_t i = 1; i < p.left.size(); ++i) EXPECT_EQ(p.left[i], 0.0f) << i;
+}
+
+TEST(FXSystem, FullPoolDropsSpawnsUnlessOverwriteIsSet)
+{
+    FXSystem fx;
+    fx.ResizePool(4);
+    FXSpec spec;
+    spec.life = 1.0f;
+    for (int i = 0; i < 4; ++i) { spec.pos.x = (float)i; fx.Spawn(spec); }
+    ASSERT_EQ(fx.GetLiveCount(), 4u);
+
+    spec.pos.x = 100.0f;
+    fx.Spawn(spec);
+    EXPECT_EQ(fx.GetDroppedCount(), 1u);
+    for (size_t i = 0; i < 4; ++i) EXPECT_EQ(fx.GetStreams().x[i], (float)i);
+
+    fx.SetOverflow(FXOverflow::Overwrite);
+    fx.Spawn(spec);
+    EXPECT_EQ(fx.GetLiveCount(), 4u);
+    EXPECT_EQ(fx.GetDroppedCount(), 1u);
+    EXPECT_EQ(fx.GetStreams().x[0], 100.0f);
+
+    // All expire together: the pool empties and takes spawns again
+    fx.Update(Timestep(2.0f));
+    EXPECT_EQ(fx.GetLiveCount(), 0u);
+    fx.SetOverflow(FXOverflow::Drop);
+    fx.Spawn(spec);
+    EXPECT_EQ(fx.GetLiveCount(), 1u);
+}
+
+TEST(FXSystem, LinearSpawnsShareABoundedSetOfCurves)
+{
+    FXSystem fx;
+    fx.ResizePool(4096);
+    FXSpec spec;
+    spec.life = 1.0f;
+
+    // Closer than one 8-bit step: the same LUT
+    spec.colorStart = { 1.0f, 0.5f, 0.2f, 1.0f };
+    fx.Spawn(spec);
+    spec.colorStart.g += 0.0005f;
+    fx.Spawn(spec);
+    EXPECT_EQ(fx.GetCurveCount(), 1u);
+
+    // A new color per spawn stops baking at the bound; later ones get the closest
+    for (int i = 0; i < 2000; ++i) {
+        spec.colorStart = { (float)(i % 256) / 255.0f, (float)(i / 256) / 255.0f, 0.0f, 1.0f };
+        fx.Spawn(spec);
+    }
+    EXPECT_EQ(fx.GetCurveCount(), FXSystem::MaxLinearCurves);
+    const FXStreams& p = fx.GetStreams();
+    const FXCurveLut& last = fx.GetCurves(p.curves[fx.GetLiveCount() - 1]);
+    EXPECT_NEAR(last.Color[0].r, 207.0f / 255.0f, 1e-6f);
+    EXPECT_EQ(last.Color[0].g, 0.0f);
+}
+
+TEST(FXSystem, RendersIntoTheBatchLikeDrawRotatedQuad)
+{
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Software);
+    Renderer::Init();
+    RenderCommand::SetViewport(0, 0, 96, 64);
+    auto& device = SoftwareDevice::Get();
+
+    FXSystem fx;
+    fx.ResizePool(300);
+    FXSpec spec;
+    spec.velJitter = { 6.0f, 6.0f };
+    spec.colorStart = { 1.0f, 0.5f, 0.2f, 1.0f };
+    spec.sizeJitter = 0.5f;
+    spec.life = 2.0f;
+    for (int i = 0; i < 300; ++i) fx.Spawn(spec);
+    fx.Update(Timestep(0.5f));
+
+    const glm::mat4 viewProjection = glm::scale(glm::mat4(1.0f), { 1.0f / 6.0f, 1.0f / 4.0f, 1.0f });
+    auto frame = [&](const std::function<void()>& draw) {
+        RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+        RenderCommand::Clear();
+        Renderer2D::ResetStats();
+        Renderer2D::BeginScene(viewProjection);
+        draw();
+        Renderer2D::EndScene();
+        return device.Framebuffer().Color;
+    };
+
+    const std::vector<uint32_t> direct = frame([&] { fx.Render(); });
+    EXPECT_EQ(Renderer2D::GetStats().DrawCalls, 1u);
+    EXPECT_EQ(Renderer2D::GetStats().QuadCount, 300u);
+
+    const std::vector<uint32_t> reference = frame([&] {
+        const FXStreams& p = fx.GetStreams();
+        for (size_t i = 0; i < fx.GetLiveCount(); ++i) {
+            const FXCurveLut& lut = fx.GetCurves(p.curves[i]);
+            const uint32_t k = FXCurveLut::Index(p.left[i], p.life[i]);
+            const float sz = p.size[i] * lut.Size[k];
+            Renderer2D::DrawRotatedQuad({ p.x[i], p.y[i] }, { sz, sz }, p.rot[i], lut.Color[k]);
+        }
+    });
+    EXPECT_TRUE(direct == reference);
+    EXPECT_GT(std::count_if(direct.begin(), direct.end(), [](uint32_t c) { return c != 0xff000000u; }), 500);
+
+    // Recorded (render-thread mode), then replayed: the same single batch
+    CommandList list;
+    {
+        CommandList::RecordingScope recording(list);
+        frame([&] { fx.Render(); });
+    }
+    EXPECT_EQ(list.CommandCount(), 4u); // clear colour, clear, view-projection, one quad span
+    CommandQueue queue;
+    queue.Submit(std::move(list));
+    queue.Execute();
+    EXPECT_EQ(Renderer2D::GetStats().DrawCalls, 1u);
+    EXPECT_EQ(Renderer2D::GetStats().QuadCount, 300u);
+    EXPECT_TRUE(device.Framebuffer().Color == direct);
+
+    Renderer::Shutdown();
+    device.Reset();
+    RendererAPI::SetAPI(previous);
+}
+
+TEST(FXSystem, CollisionResponses)
+{
+    SpatialHash world;
+    world.AddBox({ -10.0f, -10.0f }, { 10.0f, 0.0f }); // floor at y = 0
+    world.Update();
+
+    FXSpec spec;
+    spec.pos = { 0.0f, 0.5f };
+    spec.vel = { 1.0f, -2.0f };
+    spec.life = 10.0f;
+
+    auto run = [&](FXCollision response) {
+        auto fx = std::make_unique<FXSystem>();
+        fx->SetCollision(&world, response, 0.5f);
+        fx->Spawn(spec);
+        fx->Update(Timestep(0.5f)); // ends at y = -0.5
+        return fx;
+    };
+
+    auto bounce = run(FXCollision::Bounce);
+    ASSERT_EQ(bounce->GetLiveCount(), 1u);
+    EXPECT_NEAR(bounce->GetStreams().y[0], 0.0f, 1e-3f);
+    EXPECT_FLOAT_EQ(bounce->GetStreams().vx[0], 1.0f);
+    EXPECT_FLOAT_EQ(bounce->GetStreams().vy[0], 1.0f);
+    EXPECT_EQ(bounce->GetCollisionCount(), 1u);
+
+    auto stick = run(FXCollision::Stick);
+    ASSERT_EQ(stick->GetLiveCount(), 1u);
+    EXPECT_NEAR(stick->GetStreams().y[0], 0.0f, 1e-3f);
+    stick->Update(Timestep(0.5f));
+    EXPECT_FLOAT_EQ(stick->GetStreams().x[0], 0.5f);
+    EXPECT_EQ(stick->GetCollisionCount(), 1u);
+
+    auto kill = run(FXCollision::Kill);
+    EXPECT_EQ(kill->GetLiveCount(), 0u);
+
+    auto none = run(FXCollision::None);
+    EXPECT_FLOAT_EQ(none->GetStreams().y[0], -0.5f);
+}
+
+TEST(FXSystem, BatchSpawnDrawsTheSameValuesAsSingleSpawns)
+{
+    FXSpec spec;
+    spec.velJitter = { 2.0f, 1.0f };
+    spec.sizeStart = 0.5f;
+    spec.sizeJitter = 0.2f;
+    spec.life = 1.0f;
+
+    FXSystem batch, single;
+    batch.Seed(7);
+    single.Seed(7);
+    const FXCurve<glm::vec4> color({ 1.0f, 1.0f, 1.0f, 1.0f });
+    const uint16_t curves = batch.AddCurves(color, FXCurve<float>(1.0f));
+    ASSERT_EQ(single.AddCurves(color, FXCurve<float>(1.0f)), curves);
+
+    constexpr uint32_t count = 21; // 84 values: whole Fill01 blocks and a tail
+    batch.Spawn(spec, curves, count);
+    for (uint32_t i = 0; i < count; ++i) single.Spawn(spec, curves);
+
+    ASSERT_EQ(batch.GetLiveCount(), count);
+    const FXStreams& a = batch.GetStreams();
+    const FXStreams& b = single.GetStreams();
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_EQ(a.vx[i], b.vx[i]) << i;
+        EXPECT_EQ(a.vy[i], b.vy[i]) << i;
+        EXPECT_EQ(a.rot[i], b.rot[i]) << i;
+        EXPECT_EQ(a.size[i], b.size[i]) << i;
+    }
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+#include "Engine/Renderer/FXTrail.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Platforms/Software/SoftwareDevice.h"
+
+using namespace Engine;
+
+TEST(FXTrail, FixesPointsEveryMinDistanceAndDropsOldOnes)
+{
+    FXTrailDesc desc;
+    desc.MinDistance = 1.0f;
+    desc.Lifetime = 1.0f;
+    FXTrail trail(desc);
+
+    trail.Update(Timestep(0.1f), { 0.0f, 0.0f });
+    EXPECT_EQ(trail.GetPointCount(), 2u);
+
+    // Under MinDistance the head only moves
+    trail.Update(Timestep(0.1f), { 0.5f, 0.0f });
+    EXPECT_EQ(trail.GetPointCount(), 2u);
+    EXPECT_EQ(trail.GetPoint(1), glm::vec2(0.5f, 0.0f));
+
+    for (int i = 1; i <= 4; ++i) trail.Update(Timestep(0.1f), { (float)i, 0.0f });
+    EXPECT_EQ(trail.GetPointCount(), 6u);
+    EXPECT_EQ(trail.GetPoint(0), glm::vec2(0.0f, 0.0f));
+    EXPECT_EQ(trail.GetPoint(trail.GetPointCount() - 1), glm::vec2(4.0f, 0.0f));
+
+    // Standing still, everything behind the head expires
+    for (int i = 0; i < 20; ++i) trail.Update(Timestep(0.1f), { 4.0f, 0.0f });
+    EXPECT_LE(trail.GetPointCount(), 2u);
+
+    trail.Clear();
+    EXPECT_EQ(trail.GetPointCount(), 0u);
+}
+
+TEST(FXTrail, FullRingDropsTheOldestPoint)
+{
+    FXTrailDesc desc;
+    desc.MinDistance = 1.0f;
+    desc.Lifetime = 100.0f;
+    desc.MaxPoints = 8;
+    FXTrail trail(desc);
+
+    for (int i = 0; i <= 20; ++i) trail.Update(Timestep(0.1f), { (float)i, 0.0f });
+    trail.Update(Timestep(0.1f), { 20.5f, 0.0f });
+    EXPECT_EQ(trail.GetPointCount(), 8u);
+    for (size_t i = 1; i < trail.GetPointCount(); ++i)
+        EXPECT_GT(trail.GetPoint(i).x, trail.GetPoint(i - 1).x);
+    EXPECT_EQ(trail.GetPoint(trail.GetPointCount() - 1), glm::vec2(20.5f, 0.0f));
+}
+
+TEST(FXTrail, RendersAsOneBatchWithOneQuadPerSegment)
+{
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Software);
+    Renderer::Init();
+    RenderCommand::SetViewport(0, 0, 96, 64);
+    auto& device = SoftwareDevice::Get();
+
+    FXTrailDesc desc;
+    desc.Width = FXCurve<float>(1.0f, 0.5f);
+    desc.Color = FXCurve<glm::vec4>({ 1.0f, 1.0f, 1.0f, 1.0f });
+    desc.MinDistance = 0.5f;
+    desc.Lifetime = 10.0f;
+    FXTrail trail(desc);
+    // An arc, so neighbouring segments have to share bent edges
+    for (int i = 0; i <= 20; ++i) {
+        const float a = 3.0f * (float)i / 20.0f;
+        trail.Update(Timestep(0.05f), { 4.0f * std::cos(a), 3.0f * std::sin(a) });
+    }
+    const uint32_t segments = (uint32_t)trail.GetPointCount() - 1;
+    ASSERT_GT(segments, 10u);
+
+    auto frame = [&] {
+        RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+        RenderCommand::Clear();
+        Renderer2D::ResetStats();
+        Renderer2D::BeginScene(glm::scale(glm::mat4(1.0f), { 1.0f / 6.0f, 1.0f / 4.0f, 1.0f }));
+        trail.Render();
+        Renderer2D::EndScene();
+    };
+    frame();
+
+    EXPECT_EQ(Renderer2D::GetStats().DrawCalls, 1u);
+    EXPECT_EQ(Renderer2D::GetStats().QuadCount, segments);
+    const std::vector<uint32_t> color = device.Framebuffer().Color;
+    EXPECT_GT(std::count_if(color.begin(), color.end(), [](uint32_t c) { return c != 0xff000000u; }), 200);
+
+    // Recorded and replayed: the same quads, no gaps at the bends
+    CommandList list;
+    {
+        CommandList::RecordingScope recording(list);
+        frame();
+    }
+    CommandQueue queue;
+    queue.Submit(std::move(list));
+    queue.Execute();
+    EXPECT_EQ(Renderer2D::GetStats().DrawCalls, 1u);
+    EXPECT_EQ(Renderer2D::GetStats().QuadCount, segments);
+    EXPECT_TRUE(device.Framebuffer().Color == color);
+
+    Renderer::Shutdown();
+    device.Reset();
+    RendererAPI::SetAPI(previous);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "Engine/Renderer/OverdrawView.h"
+#include "Engine/Renderer/LowResolutionPass.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Platforms/Software/SoftwareDevice.h"
+#include "Platforms/Software/SoftwareShader.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+namespace fs = std::filesystem;
+
+namespace {
+
+    // NDC rectangle at depth z (lower is nearer)
+    Shared<VertexArray> MakeRect(float x0, float y0, float x1, float y1, float z) {
+        float v[] = {
+            x0, y0, z,  1.0f, 1.0f, 1.0f, 0.5f,
+            x1, y0, z,  1.0f, 1.0f, 1.0f, 0.5f,
+            x1, y1, z,  1.0f, 1.0f, 1.0f, 0.5f,
+            x0, y1, z,  1.0f, 1.0f, 1.0f, 0.5f,
+        };
+        uint32_t idx[] = { 0, 1, 2, 2, 3, 0 };
+        auto vb = VertexBuffer::Create(v, (uint32_t)sizeof(v));
+        vb->SetLayout({ { ShaderDataType::Float3, "a_Position" },
+                        { ShaderDataType::Float4, "a_Color" } });
+        auto va = VertexArray::Create();
+        va->AddVertexBuffer(vb);
+        va->SetIndexBuffer(IndexBuffer::Create(idx, 6u));
+        return va;
+    }
+
+    // Left-bottom quarter 3 layers, left-top 2, right half 1. The last rect
+    // lies behind everything and fails the depth test: not counted.
+    void DrawLayers() {
+        RenderCommand::DrawIndexed(MakeRect(-1.0f, -1.0f, 1.0f, 1.0f, 0.5f));
+        RenderCommand::DrawIndexed(MakeRect(-1.0f, -1.0f, 0.0f, 1.0f, 0.0f));
+        RenderCommand::DrawIndexed(MakeRect(-1.0f, -1.0f, 0.0f, 0.0f, -0.5f));
+        RenderCommand::DrawIndexed(MakeRect(-1.0f, -1.0f, 1.0f, 1.0f, 0.9f));
+    }
+
+}
+
+TEST(OverdrawView, CountsFragmentsThatPassTheDepthTest)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Software);
+    RenderCommand::SetViewport(0, 0, 16, 16);
+    SoftwareShader shader("test", "layout(location = 0) in vec3 a_Position;\n"
+                                  "layout(location = 1) in vec4 a_Color;\n", "");
+    shader.Binding();
+
+    OverdrawView view(16, 16);
+    view.Begin();
+    DrawLayers();
+    view.End();
+    view.Flush();
+
+    const OverdrawView::Statistics& s = view.GetStats();
+    ASSERT_EQ(s.Frames, 1u);
+    EXPECT_FLOAT_EQ(s.Last.Average, (64 * 3 + 64 * 2 + 128 * 1) / 256.0f);
+    EXPECT_EQ(s.Last.Max, 3u);
+    EXPECT_FLOAT_EQ(s.Last.Coverage, 1.0f);
+    ASSERT_TRUE(view.GetHeatmap());
+    EXPECT_EQ(view.GetHeatmap()->GetWidth(), 16u);
+
+    // Counting is off again: the backbuffer's stencil stays untouched
+    DrawLayers();
+    const SoftwareFramebuffer& screen = SoftwareDevice::Get().Framebuffer();
+    for (uint8_t c : screen.Stencil) ASSERT_EQ(c, 0u);
+    EXPECT_EQ(SoftwareDevice::Get().GetViewport().W, 16u);
+}
+
+TEST(OverdrawView, ReportListsEveryMeasuredFrame)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Software);
+    RenderCommand::SetViewport(0, 0, 8, 8);
+    SoftwareShader shader("test", "layout(location = 0) in vec3 a_Position;\n"
+                                  "layout(location = 1) in vec4 a_Color;\n", "");
+    shader.Binding();
+
+    OverdrawView view(8, 8);
+    for (int frame = 0; frame < 3; ++frame) {
+        view.Begin();
+        if (frame == 1) DrawLayers();
+        view.End();
+    }
+    view.Flush();
+    ASSERT_EQ(view.GetHistory().size(), 3u);
+    EXPECT_EQ(view.GetHistory()[0].Max, 0u);
+    EXPECT_EQ(view.GetHistory()[1].Max, 3u);
+    EXPECT_EQ(view.GetStats().PeakMax, 3u);
+    EXPECT_FLOAT_EQ(view.GetStats().MeanAverage, 1.75f / 3.0f);
+
+    const fs::path path = fs::temp_directory_path() / "eg_overdraw.json";
+    ASSERT_TRUE(view.WriteReport(path.string()));
+    std::ifstream in(path);
+    std::stringstream text;
+    text << in.rdbuf();
+    const std::string json = text.str();
+    EXPECT_NE(json.find("\"frames\": 3"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"peak_max_overdraw\": 3"), std::string::npos) << json;
+    EXPECT_NE(json.find("{ \"frame\": 2, \"average\": 1.75, \"max\": 3"), std::string::npos) << json;
+    fs::remove(path);
+}
+
+// Particles go through a LowResolutionPass, whose target the view cannot
+// see: only the composite quad would be counted. Direct mode draws them
+// into the counted target.
+TEST(OverdrawView, CountsParticlesOfADirectLowResolutionPass)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Software);
+    Renderer::Init();
+    RenderCommand::SetViewport(0, 0, 16, 16);
+    OrthographicCamera camera(-1.0f, 1.0f, -1.0f, 1.0f);
+    LowResolutionPass pass(16, 16, 0.5f);
+    OverdrawView view(16, 16);
+
+    auto frame = [&] {
+        view.Begin();
+        pass.Begin(camera);
+        for (int layer = 0; layer < 3; ++layer) // each nearer than the last
+            Renderer2D::DrawQuad({ 0.0f, 0.0f, 0.1f * (float)(layer + 1) }, { 2.0f, 2.0f }, glm::vec4(1.0f, 1.0f, 1.0f, 0.2f));
+        pass.End();
+        pass.Composite();
+        view.End();
+        view.Flush();
+        return view.GetStats().Last.Average;
+    };
+
+    EXPECT_FLOAT_EQ(frame(), 1.0f); // the composite quad alone
+    pass.SetDirect(true);
+    EXPECT_FLOAT_EQ(frame(), 3.0f);
+
+    Renderer::Shutdown();
+}
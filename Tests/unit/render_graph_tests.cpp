@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/RenderGraph.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+
+namespace {
+
+    using Graph = RenderGraph;
+
+}
+
+TEST(RenderGraph, CullsUnusedPassesAndOrdersByDependency)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording);
+    Graph graph;
+    const FramebufferSpec spec{ 320, 180 };
+    const auto backbuffer = graph.Import("Backbuffer");
+    const auto scene = graph.CreateTransient("Scene", spec);
+    const auto debug = graph.CreateTransient("Debug", spec);
+
+    std::vector<std::string> ran;
+    auto record = [&ran](const char* name) { return [&ran, name](const Graph::Context&) { ran.push_back(name); }; };
+
+    // Declared out of order: the composite comes before the pass it reads
+    graph.AddPass("Composite", [&](Graph::Builder& b) { b.Read(scene); b.Write(backbuffer); }, record("Composite"));
+    graph.AddPass("Scene", [&](Graph::Builder& b) { b.Write(scene); }, record("Scene"));
+    graph.AddPass("DebugView", [&](Graph::Builder& b) { b.Read(scene); b.Write(debug); }, record("DebugView"));
+    graph.AddPass("Stats", [&](Graph::Builder& b) { b.SideEffect(); }, record("Stats"));
+
+    graph.Execute();
+    EXPECT_EQ(ran, (std::vector<std::string>{ "Scene", "Composite", "Stats" }));
+    EXPECT_EQ(graph.GetStats().Passes, 3u);
+    EXPECT_EQ(graph.GetStats().CulledPasses, 1u);
+    EXPECT_EQ(graph.GetStats().PhysicalTargets, 1u);
+
+    const std::string dump = graph.Dump();
+    EXPECT_NE(dump.find("DebugView [culled]"), std::string::npos) << dump;
+    EXPECT_NE(dump.find("Debug 320x180+depth unused"), std::string::npos) << dump;
+    EXPECT_NE(graph.DumpGraphviz().find("style=dashed"), std::string::npos);
+}
+
+// A transient reused within the frame: each read sees the write declared
+// just before it, not the last one.
+TEST(RenderGraph, ReadBetweenTwoWritesSeesTheEarlierOne)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording);
+    const FramebufferSpec spec{ 320, 180 };
+    std::vector<std::string> ran;
+    auto record = [&ran](const char* name) { return [&ran, name](const Graph::Context&) { ran.push_back(name); }; };
+
+    // Both reads are outputs: the second write waits for the first read
+    {
+        Graph graph;
+        const auto backbuffer = graph.Import("Backbuffer");
+        const auto overlay = graph.Import("Overlay", Framebuffer::Create(spec));
+        const auto scratch = graph.CreateTransient("Scratch", spec);
+        graph.AddPass("WriteA", [&](Graph::Builder& b) { b.Write(scratch); }, record("WriteA"));
+        graph.AddPass("ReadA", [&](Graph::Builder& b) { b.Read(scratch); b.Write(backbuffer); }, record("ReadA"));
+        graph.AddPass("WriteB", [&](Graph::Builder& b) { b.Write(scratch); }, record("WriteB"));
+        graph.AddPass("ReadB", [&](Graph::Builder& b) { b.Read(scratch); b.Write(overlay); }, record("ReadB"));
+        graph.Execute();
+        EXPECT_EQ(ran, (std::vector<std::string>{ "WriteA", "ReadA", "WriteB", "ReadB" }));
+    }
+
+    // Only the first read is used: the second version is culled, the first kept
+    ran.clear();
+    {
+        Graph graph;
+        const auto backbuffer = graph.Import("Backbuffer");
+        const auto scratch = graph.CreateTransient("Scratch", spec);
+        const auto debug = graph.CreateTransient("Debug", spec);
+        graph.AddPass("WriteA", [&](Graph::Builder& b) { b.Write(scratch); }, record("WriteA"));
+        graph.AddPass("ReadA", [&](Graph::Builder& b) { b.Read(scratch); b.Write(backbuffer); }, record("ReadA"));
+        graph.AddPass("WriteB", [&](Graph::Builder& b) { b.Write(scratch); }, record("WriteB"));
+        graph.AddPass("ReadB", [&](Graph::Builder& b) { b.Read(scratch); b.Write(debug); }, record("ReadB"));
+        graph.Execute();
+        EXPECT_EQ(ran, (std::vector<std::string>{ "WriteA", "ReadA" }));
+        EXPECT_EQ(graph.GetStats().CulledPasses, 2u);
+    }
+}
+
+TEST(RenderGraph, AliasesTransientsWithDisjointLifetimes)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording);
+    Graph graph;
+    const FramebufferSpec spec{ 256, 256, false };
+    const auto backbuffer = graph.Import("Backbuffer");
+    const auto a = graph.CreateTransient("A", spec);
+    const auto b = graph.CreateTransient("B", spec);
+    const auto c = graph.CreateTransient("C", spec);
+    const auto half = graph.CreateTransient("Half", { 128, 128, false });
+
+    Shared<Texture2D> sampled;
+    graph.AddPass("MakeA", [&](Graph::Builder& p) { p.Write(a); }, nullptr);
+    graph.AddPass("AtoB", [&](Graph::Builder& p) { p.Read(a); p.Write(b); }, nullptr);
+    graph.AddPass("BtoC", [&](Graph::Builder& p) { p.Read(b); p.Write(c); }, nullptr);
+    graph.AddPass("Downsample", [&](Graph::Builder& p) { p.Read(c); p.Write(half); }, nullptr);
+    graph.AddPass("BlendHalf", [&](Graph::Builder& p) { p.Read(half); p.Read(c); p.Write(c); }, nullptr);
+    graph.AddPass("Present", [&](Graph::Builder& p) { p.Read(c); p.Write(backbuffer); },
+        [&](const Graph::Context& ctx) { sampled = ctx.GetTexture(c); });
+
+    graph.Execute();
+    const auto& stats = graph.GetStats();
+    // A and C never live at the same time; Half has its own size
+    EXPECT_EQ(stats.Transients, 4u);
+    EXPECT_EQ(stats.PhysicalTargets, 3u);
+    EXPECT_LT(stats.PhysicalBytes, stats.TransientBytes);
+    ASSERT_TRUE(sampled);
+    EXPECT_EQ(sampled->GetWidth(), 256u);
+
+    // MakeA, AtoB, BtoC, Downsample, BlendHalf, back to the backbuffer
+    auto& log = RecordingLog::Get();
+    log.EndFrame();
+    EXPECT_EQ(stats.TargetSwitches, 6u);
+    EXPECT_EQ(log.Frames().back().FramebufferBinds, 5u + 5u);
+
+    // Resizing recompiles and keeps the aliasing
+    graph.SetSpec(a, { 512, 512, false });
+    graph.SetSpec(b, { 512, 512, false });
+    graph.SetSpec(c, { 512, 512, false });
+    graph.Execute();
+    EXPECT_EQ(graph.GetStats().PhysicalTargets, 3u);
+    EXPECT_EQ(sampled->GetWidth(), 512u);
+}
+
+// Render-thread mode: Execute runs while the frame is recorded, and a
+// window resize (SetSpec) recompiles there. Only the resize may happen, and
+// it has to wait for the replay.
+TEST(RenderGraph, RecompileWhileRecordingDefersTheResizeToReplay)
+{
+    TestHelpers::BackendGuard backend(RendererAPI::API::Recording);
+    Graph graph;
+    const auto backbuffer = graph.Import("Backbuffer");
+    const auto scene = graph.CreateTransient("Scene", { 320, 180 });
+    graph.AddPass("Scene", [&](Graph::Builder& b) { b.Write(scene); }, nullptr);
+    graph.AddPass("Composite", [&](Graph::Builder& b) { b.Read(scene); b.Write(backbuffer); }, nullptr);
+    graph.Compile(); // creates the target, before any frame is recorded
+
+    graph.SetSpec(scene, { 640, 360 });
+    CommandList frame;
+    {
+        CommandList::RecordingScope recording(frame);
+        graph.Execute();
+    }
+    EXPECT_TRUE(RecordingLog::Get().Commands().empty()) << RecordingLog::Get().Dump(0);
+
+    CommandQueue queue;
+    queue.Submit(std::move(frame));
+    queue.Execute();
+
+    std::vector<std::string> targets;
+    for (const RecordedCommand& c : RecordingLog::Get().Commands())
+        if (c.Op == RecordedOp::BindFramebuffer) targets.push_back(c.Name);
+    EXPECT_EQ(targets, (std::vector<std::string>{ "offscreen 640x360", "previous" }));
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "Engine/Renderer/RenderThread.h"
+
+using namespace Engine;
+
+namespace {
+
+    class FakeContext : public GraphicsContext {
+    public:
+        void Init() override {}
+        void SwapBuffers() override {
+            SwapThread = std::this_thread::get_id();
+            while (Hold.load()) std::this_thread::yield();
+            Swaps++;
+        }
+        void MakeCurrent() override { CurrentOn = std::this_thread::get_id(); }
+        void ReleaseCurrent() override { Released = true; }
+
+        std::atomic<bool> Hold{ false };
+        std::atomic<int>  Swaps{ 0 };
+        std::thread::id   CurrentOn, SwapThread;
+        bool              Released = false;
+    };
+
+}
+
+TEST(RenderThread, RendersEveryFrameOnItsOwnThread)
+{
+    FakeContext ctx;
+    RenderThread rt;
+    rt.Start(ctx, 2);
+
+    int overlays = 0;
+    for (int i = 0; i < 10; ++i) {
+        FramePacket& p = rt.BeginFrame();
+        EXPECT_EQ(p.FrameIndex, (uint64_t)i);
+        p.Overlay = [&overlays] { ++overlays; };
+        rt.EndFrame();
+    }
+    rt.Stop();
+
+    EXPECT_EQ(ctx.Swaps.load(), 10);
+    EXPECT_EQ(overlays, 10);
+    EXPECT_NE(ctx.CurrentOn, std::this_thread::get_id());
+    EXPECT_EQ(ctx.SwapThread, ctx.CurrentOn);
+    EXPECT_TRUE(ctx.Released);
+    EXPECT_EQ(rt.GetStats().FramesRendered, 10u);
+}
+
+TEST(RenderThread, MainThreadBlocksWhenFramesInFlightAreFull)
+{
+    FakeContext ctx;
+    ctx.Hold = true; // render thread stalls in the first swap
+    RenderThread rt;
+    rt.Start(ctx, 1);
+
+    rt.BeginFrame(); rt.EndFrame(); // being rendered
+    rt.BeginFrame(); rt.EndFrame(); // queued
+
+    std::atomic<bool> gotThird{ false };
+    std::thread producer([&] { rt.BeginFrame(); gotThird = true; rt.EndFrame(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(gotThird.load());
+
+    ctx.Hold = false;
+    producer.join();
+    EXPECT_TRUE(gotThird.load());
+    rt.Stop();
+    EXPECT_EQ(ctx.Swaps.load(), 3);
+}
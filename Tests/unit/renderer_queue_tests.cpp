@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "Platforms/Software/SoftwareDevice.h"
+
+using namespace Engine;
+
+namespace {
+
+    Shared<VertexArray> MakeSquare() {
+        float vertices[4 * 3] = {
+            -0.5f, -0.5f, 0.0f,
+             0.5f, -0.5f, 0.0f,
+             0.5f,  0.5f, 0.0f,
+            -0.5f,  0.5f, 0.0f,
+        };
+        uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+        auto vb = VertexBuffer::Create(vertices, sizeof(vertices));
+        vb->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
+        auto va = VertexArray::Create();
+        va->AddVertexBuffer(vb);
+        va->SetIndexBuffer(IndexBuffer::Create(indices, 6));
+        return va;
+    }
+
+    glm::mat4 At(float x, float y) {
+        return glm::translate(glm::mat4(1.0f), { x, y, 0.0f });
+    }
+
+    class RendererQueueTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            m_Previous = RendererAPI::GetAPI();
+            RendererAPI::SetAPI(RendererAPI::API::Recording);
+            Renderer::Init();
+            RecordingLog::Get().Reset();
+            Renderer::ResetStats();
+        }
+        void TearDown() override {
+            Renderer::Shutdown();
+            RecordingLog::Get().Reset();
+            RendererAPI::SetAPI(m_Previous);
+        }
+
+        static std::vector<RecordedCommand> Draws() {
+            std::vector<RecordedCommand> draws;
+            for (const RecordedCommand& c : RecordingLog::Get().Commands())
+                if (c.Op == RecordedOp::DrawIndexed || c.Op == RecordedOp::DrawIndexedInstanced)
+                    draws.push_back(c);
+            return draws;
+        }
+
+        OrthographicCamera m_Camera{ -8.0f, 8.0f, -4.5f, 4.5f };
+        RendererAPI::API m_Previous = RendererAPI::API::OpenGL;
+    };
+
+}
+
+TEST_F(RendererQueueTest, InstancedShaderDrawsARunOfOneMeshOnce)
+{
+    auto shader = Shader::Create("assets/shaders/FlatColorInstanced.glsl");
+    auto square = MakeSquare();
+
+    Renderer::BeginScene(m_Camera);
+    for (int i = 0; i < 5; ++i) Renderer::Submit(shader, square, At((float)i, 0.0f));
+    Renderer::EndScene();
+
+    const auto draws = Draws();
+    ASSERT_EQ(draws.size(), 1u);
+    EXPECT_EQ(draws[0].Op, RecordedOp::DrawIndexedInstanced);
+    EXPECT_EQ(draws[0].Instances, 5u);
+    EXPECT_EQ(Renderer::GetStats().DrawCalls, 1u);
+    EXPECT_EQ(Renderer::GetStats().InstancedDraws, 1u);
+}
+
+TEST_F(RendererQueueTest, ShaderWithoutInstanceInputDrawsEachSubmission)
+{
+    auto shader = Shader::Create("assets/shaders/FlatColor.glsl");
+    auto square = MakeSquare();
+
+    Renderer::BeginScene(m_Camera);
+    for (int i = 0; i < 5; ++i) Renderer::Submit(shader, square, At((float)i, 0.0f));
+    Renderer::EndScene();
+
+    const auto draws = Draws();
+    ASSERT_EQ(draws.size(), 5u);
+    for (const RecordedCommand& d : draws) EXPECT_EQ(d.Op, RecordedOp::DrawIndexed);
+    EXPECT_EQ(Renderer::GetStats().InstancedDraws, 0u);
+}
+
+TEST_F(RendererQueueTest, SortsByCreationOrderAndSplitsRunsPerMesh)
+{
+    auto flat = Shader::Create("assets/shaders/FlatColor.glsl");
+    auto instanced = Shader::Create("assets/shaders/FlatColorInstanced.glsl");
+    auto a = MakeSquare();
+    auto b = MakeSquare();
+
+    // Interleaved and in reverse creation order
+    Renderer::BeginScene(m_Camera);
+    Renderer::Submit(instanced, b, At(0.0f, 0.0f));
+    Renderer::Submit(instanced, a, At(1.0f, 0.0f));
+    Renderer::Submit(flat, a, At(2.0f, 0.0f));
+    Renderer::Submit(instanced, a, At(3.0f, 0.0f));
+    Renderer::Submit(flat, a, At(4.0f, 0.0f));
+    Renderer::Submit(instanced, a, At(5.0f, 0.0f));
+    Renderer::EndScene();
+
+    // flat: two plain draws; instanced: a run of three for `a`, then `b`
+    // alone, still through the instance stream since the shader needs it
+    const auto draws = Draws();
+    ASSERT_EQ(draws.size(), 4u);
+    EXPECT_EQ(draws[0].Op, RecordedOp::DrawIndexed);
+    EXPECT_EQ(draws[1].Op, RecordedOp::DrawIndexed);
+    EXPECT_EQ(draws[2].Op, RecordedOp::DrawIndexedInstanced);
+    EXPECT_EQ(draws[2].Instances, 3u);
+    EXPECT_EQ(draws[3].Op, RecordedOp::DrawIndexedInstanced);
+    EXPECT_EQ(draws[3].Instances, 1u);
+
+    std::vector<std::string> binds;
+    for (const RecordedCommand& c : RecordingLog::Get().Commands())
+        if (c.Op == RecordedOp::BindShader) binds.push_back(c.Name);
+    EXPECT_EQ(binds, (std::vector<std::string>{ "FlatColor", "FlatColorInstanced" }));
+}
+
+TEST_F(RendererQueueTest, RunLongerThanTheInstanceStreamIsSplit)
+{
+    auto shader = Shader::Create("assets/shaders/FlatColorInstanced.glsl");
+    auto square = MakeSquare();
+
+    Renderer::BeginScene(m_Camera);
+    for (int i = 0; i < 10001; ++i) Renderer::Submit(shader, square, At(0.0f, 0.0f));
+    Renderer::EndScene();
+
+    const auto draws = Draws();
+    ASSERT_EQ(draws.size(), 2u);
+    EXPECT_EQ(draws[0].Instances, 10000u);
+    EXPECT_EQ(draws[1].Instances, 1u);
+}
+
+TEST_F(RendererQueueTest, UniformChangeBetweenSubmitsSplitsTheRun)
+{
+    auto shader = Shader::Create("assets/shaders/FlatColorInstanced.glsl");
+    auto square = MakeSquare();
+
+    Renderer::BeginScene(m_Camera);
+    shader->SetFloat4("u_Color", { 1.0f, 0.0f, 0.0f, 1.0f });
+    Renderer::Submit(shader, square, At(0.0f, 0.0f));
+    Renderer::Submit(shader, square, At(1.0f, 0.0f));
+    shader->SetFloat4("u_Color", { 0.0f, 0.0f, 1.0f, 1.0f });
+    Renderer::Submit(shader, square, At(2.0f, 0.0f));
+    Renderer::EndScene();
+
+    const auto draws = Draws();
+    ASSERT_EQ(draws.size(), 2u);
+    EXPECT_EQ(draws[0].Instances, 2u);
+    EXPECT_EQ(draws[1].Instances, 1u);
+}
+
+// Each draw keeps the colour that was set before its own Submit.
+TEST(RendererQueue, DrawsKeepTheUniformsSetBeforeTheirSubmitOnSoftware)
+{
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Software);
+    Renderer::Init();
+    RenderCommand::SetViewport(0, 0, 64, 36);
+    auto& device = SoftwareDevice::Get();
+    OrthographicCamera camera(-8.0f, 8.0f, -4.5f, 4.5f);
+    auto shader = Shader::Create("assets/shaders/FlatColor.glsl");
+    auto square = MakeSquare();
+
+    RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+    RenderCommand::Clear();
+    Renderer::BeginScene(camera);
+    shader->SetFloat4("u_Color", { 1.0f, 0.0f, 0.0f, 1.0f });
+    Renderer::Submit(shader, square, glm::scale(At(-4.0f, 0.0f), { 2.0f, 2.0f, 1.0f }));
+    shader->SetFloat4("u_Color", { 0.0f, 0.0f, 1.0f, 1.0f });
+    Renderer::Submit(shader, square, glm::scale(At(4.0f, 0.0f), { 2.0f, 2.0f, 1.0f }));
+    Renderer::EndScene();
+
+    std::vector<uint32_t> colors = device.Framebuffer().Color;
+    std::sort(colors.begin(), colors.end());
+    colors.erase(std::unique(colors.begin(), colors.end()), colors.end());
+    EXPECT_EQ(colors.size(), 3u); // clear colour, red, blue
+
+    Renderer::Shutdown();
+    device.Reset();
+    RendererAPI::SetAPI(previous);
+}
+
+// The instanced and the per-draw shader have to put the same pixels down.
+TEST(RendererQueue, InstancedDrawMatchesPerDrawOutputOnSoftware)
+{
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Software);
+    Renderer::Init();
+    RenderCommand::SetViewport(0, 0, 64, 36);
+    auto& device = SoftwareDevice::Get();
+    OrthographicCamera camera(-8.0f, 8.0f, -4.5f, 4.5f);
+    auto square = MakeSquare();
+
+    auto render = [&](const Shared<Shader>& shader) {
+        shader->SetFloat4("u_Color", { 0.2f, 0.8f, 0.4f, 1.0f });
+        RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+        RenderCommand::Clear();
+        Renderer::ResetStats();
+        Renderer::BeginScene(camera);
+        for (int i = 0; i < 4; ++i)
+            Renderer::Submit(shader, square, glm::scale(At(-6.0f + 4.0f * i, (float)i - 1.5f), { 2.0f, 2.0f, 1.0f }));
+        Renderer::EndScene();
+        return device.Framebuffer().Color;
+    };
+
+    const std::vector<uint32_t> perDraw = render(Shader::Create("assets/shaders/FlatColor.glsl"));
+    EXPECT_EQ(Renderer::GetStats().DrawCalls, 4u);
+    const std::vector<uint32_t> instanced = render(Shader::Create("assets/shaders/FlatColorInstanced.glsl"));
+    EXPECT_EQ(Renderer::GetStats().DrawCalls, 1u);
+    EXPECT_EQ(Renderer::GetStats().InstancedDraws, 1u);
+
+    EXPECT_GT(std::count_if(instanced.begin(), instanced.end(), [](uint32_t c) { return c != 0xff000000u; }), 4 * 4 * 4);
+    EXPECT_TRUE(perDraw == instanced);
+
+    Renderer::Shutdown();
+    device.Reset();
+    RendererAPI::SetAPI(previous);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "Platforms/Software/SoftwareBuffer.h"
+#include "Platforms/Software/SoftwareDevice.h"
+#include "Platforms/Software/SoftwareShader.h"
+#include "Platforms/Software/SoftwareTexture.h"
+#include "Platforms/Software/SoftwareVertexArray.h"
+
+using namespace Engine;
+
+namespace {
+
+    const char* kVertexSrc =
+        "layout(location = 0) in vec3 a_Position;\n"
+        "layout(location = 1) in vec4 a_Color;\n"
+        "layout(location = 2) in vec2 a_TexCoord;\n";
+
+    // Quad in NDC with per-vertex color and 0..1 UVs
+    Shared<VertexArray> MakeQuad(glm::vec2 min, glm::vec2 max, float z, glm::vec4 color) {
+        float v[] = {
+            min.x, min.y, z,  color.r, color.g, color.b, color.a,  0.0f, 0.0f,
+            max.x, min.y, z,  color.r, color.g, color.b, color.a,  1.0f, 0.0f,
+            max.x, max.y, z,  color.r, color.g, color.b, color.a,  1.0f, 1.0f,
+            min.x, max.y, z,  color.r, color.g, color.b, color.a,  0.0f, 1.0f,
+        };
+        uint32_t idx[] = { 0, 1, 2, 2, 3, 0 };
+
+        auto vb = MakeShared<SoftwareVertexBuffer>(v, (uint32_t)sizeof(v));
+        vb->SetLayout({ { ShaderDataType::Float3, "a_Position" },
+                        { ShaderDataType::Float4, "a_Color" },
+                        { ShaderDataType::Float2, "a_TexCoord" } });
+        auto va = MakeShared<SoftwareVertexArray>();
+        va->AddVertexBuffer(vb);
+        va->SetIndexBuffer(MakeShared<SoftwareIndexBuffer>(idx, 6u));
+        return va;
+    }
+
+    struct Rgba { uint32_t r, g, b, a; };
+
+    Rgba PixelAt(const SoftwareFramebuffer& fb, uint32_t x, uint32_t y) {
+        const uint32_t p = fb.Color[(size_t)y * fb.Width + x];
+        return { p & 0xff, (p >> 8) & 0xff, (p >> 16) & 0xff, p >> 24 };
+    }
+
+    class SoftwareRasterizer : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            auto& d = SoftwareDevice::Get();
+            d.Reset();
+            d.SetViewport(0, 0, 64, 64);
+            d.SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+            d.Clear();
+            shader = std::make_unique<SoftwareShader>("test", kVertexSrc, "");
+            shader->Binding();
+        }
+        void TearDown() override {
+            shader.reset();
+            SoftwareDevice::Get().Reset();
+        }
+
+        std::unique_ptr<SoftwareShader> shader;
+    };
+
+}
+
+TEST_F(SoftwareRasterizer, FillsQuadWithoutSeamOnSharedEdge)
+{
+    auto& d = SoftwareDevice::Get();
+    auto quad = MakeQuad({ -1.0f, -1.0f }, { 1.0f, 1.0f }, 0.0f, { 1.0f, 0.0f, 0.0f, 0.5f });
+    d.DrawIndexed(*quad, 0, 1, 0);
+
+    const auto& fb = d.Framebuffer();
+    // Every pixel blended exactly once: the diagonal must not be darker or brighter
+    for (uint32_t y = 0; y < fb.Height; ++y)
+        for (uint32_t x = 0; x < fb.Width; ++x)
+            ASSERT_EQ(PixelAt(fb, x, y).r, 128u) << x << "," << y;
+    EXPECT_EQ(d.GetStats().Fragments, 64u * 64u);
+}
+
+TEST_F(SoftwareRasterizer, DepthTestKeepsNearerSurface)
+{
+    auto& d = SoftwareDevice::Get();
+    auto nearQuad = MakeQuad({ -1.0f, -1.0f }, { 0.0f, 1.0f }, -0.5f, { 0.0f, 1.0f, 0.0f, 1.0f });
+    auto farQuad = MakeQuad({ -1.0f, -1.0f }, { 1.0f, 1.0f }, 0.5f, { 0.0f, 0.0f, 1.0f, 1.0f });
+    d.DrawIndexed(*nearQuad, 0, 1, 0);
+    d.DrawIndexed(*farQuad, 0, 1, 0);
+
+    const auto& fb = d.Framebuffer();
+    EXPECT_EQ(PixelAt(fb, 10, 32).g, 255u);
+    EXPECT_EQ(PixelAt(fb, 10, 32).b, 0u);
+    EXPECT_EQ(PixelAt(fb, 50, 32).b, 255u);
+}
+
+TEST_F(SoftwareRasterizer, SamplesTextureWithTint)
+{
+    auto& d = SoftwareDevice::Get();
+    SoftwareTexture2D tex(2, 2);
+    const uint32_t yellow = 0xff00ffffu;
+    uint32_t pixels[4] = { yellow, yellow, yellow, yellow };
+    tex.SetData(pixels, sizeof(pixels));
+    tex.Bind(0);
+    shader->SetInt("u_Texture", 0);
+    shader->SetFloat4("u_Color", { 0.5f, 1.0f, 1.0f, 1.0f });
+
+    auto quad = MakeQuad({ -1.0f, -1.0f }, { 1.0f, 1.0f }, 0.0f, { 1.0f, 1.0f, 1.0f, 1.0f });
+    d.DrawIndexed(*quad, 0, 1, 0);
+
+    const Rgba p = PixelAt(d.Framebuffer(), 20, 40);
+    EXPECT_EQ(p.r, 128u);
+    EXPECT_EQ(p.g, 255u);
+    EXPECT_EQ(p.b, 0u);
+}
+
+TEST_F(SoftwareRasterizer, ThreadCountDoesNotChangeTheImage)
+{
+    auto& d = SoftwareDevice::Get();
+    auto render = [&](uint32_t threads) {
+        d.SetThreadCount(threads);
+        d.Clear();
+        for (int i = 0; i < 8; ++i) {
+            const float o = -0.9f + 0.2f * (float)i;
+            auto quad = MakeQuad({ o, o }, { o + 0.8f, o + 0.6f }, 0.0f, { 0.2f * (float)i, 0.5f, 1.0f, 0.4f });
+            d.DrawIndexed(*quad, 0, 1, 0);
+        }
+        return d.Framebuffer().Color;
+    };
+
+    const auto single = render(1);
+    EXPECT_EQ(render(4), single);
+    d.SetThreadCount(0);
+}
+
+TEST_F(SoftwareRasterizer, SkipsTrianglesFarOutsideTheViewport)
+{
+    auto& d = SoftwareDevice::Get();
+    // Screen coordinates beyond the int range, above and below the target
+    auto below = MakeQuad({ -1.0f, -2.0e8f }, { 1.0f, -1.0e8f }, 0.0f, { 1.0f, 0.0f, 0.0f, 1.0f });
+    auto above = MakeQuad({ -1.0f, 1.0e8f }, { 1.0f, 2.0e8f }, 0.0f, { 1.0f, 0.0f, 0.0f, 1.0f });
+    d.DrawIndexed(*below, 0, 1, 0);
+    d.DrawIndexed(*above, 0, 1, 0);
+
+    EXPECT_EQ(PixelAt(d.Framebuffer(), 32, 32).r, 0u);
+    EXPECT_EQ(d.GetStats().Fragments, 0u);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "Engine/Physics/SpatialHash.h"
+#include "Engine/Core/Random.h"
+
+using namespace Engine;
+
+TEST(SpatialHash, ContactPointsOutOfTheNearestEdge)
+{
+    SpatialHash world(1.0f, 64);
+    world.AddBox({ 0.0f, 0.0f }, { 4.0f, 2.0f });
+    // Clockwise on purpose: stored counter-clockwise either way
+    world.AddTriangle({ 10.0f, 0.0f }, { 10.0f, 3.0f }, { 13.0f, 0.0f });
+    world.Update();
+
+    Contact c;
+    ASSERT_TRUE(world.Query({ 1.0f, 1.8f }, c));
+    EXPECT_EQ(c.Shape, 0u);
+    EXPECT_NEAR(c.Normal.x, 0.0f, 1e-6f);
+    EXPECT_NEAR(c.Normal.y, 1.0f, 1e-6f);
+    EXPECT_NEAR(c.Depth, 0.2f, 1e-5f);
+
+    ASSERT_TRUE(world.Query({ 10.5f, 1.0f }, c));
+    EXPECT_EQ(c.Shape, 1u);
+    EXPECT_NEAR(c.Normal.x, -1.0f, 1e-6f);
+    EXPECT_NEAR(c.Depth, 0.5f, 1e-5f);
+
+    EXPECT_FALSE(world.Contains({ 5.0f, 1.0f }));
+    EXPECT_FALSE(world.Contains({ 12.5f, 2.0f })); // inside the bounds, outside the hypotenuse
+    EXPECT_FALSE(world.Contains({ -1000.0f, 1.0f }));
+}
+
+TEST(SpatialHash, MovedShapesAreFoundAfterUpdate)
+{
+    SpatialHash world;
+    const glm::vec2 tri[3] = { { 0.0f, 0.0f }, { 2.0f, 0.0f }, { 0.0f, 2.0f } };
+    const uint32_t id = world.Add(tri, 3);
+    world.Update();
+    EXPECT_TRUE(world.Contains({ 0.5f, 0.5f }));
+
+    const glm::vec2 moved[3] = { { 100.0f, 0.0f }, { 102.0f, 0.0f }, { 100.0f, 2.0f } };
+    world.Set(id, moved, 3);
+    world.Update();
+    EXPECT_FALSE(world.Contains({ 0.5f, 0.5f }));
+    EXPECT_TRUE(world.Contains({ 100.5f, 0.5f }));
+}
+
+TEST(SpatialHash, MatchesBruteForceOnManyShapesAndPoints)
+{
+    Random rng(7);
+    SpatialHash world(2.0f, 1024);
+    for (int i = 0; i < 300; ++i) {
+        const glm::vec2 o{ rng.Range(-200.0f, 200.0f), rng.Range(-50.0f, 50.0f) };
+        if (i % 2) world.AddBox(o, o + glm::vec2{ rng.Range(0.5f, 6.0f), rng.Range(0.5f, 6.0f) });
+        else world.AddTriangle(o, o + glm::vec2{ rng.Range(1.0f, 8.0f), 0.0f }, o + glm::vec2{ 0.0f, rng.Range(1.0f, 8.0f) });
+    }
+    world.Update();
+
+    size_t hits = 0;
+    for (int i = 0; i < 20000; ++i) {
+        const glm::vec2 p{ rng.Range(-210.0f, 210.0f), rng.Range(-60.0f, 60.0f) };
+        bool expected = false;
+        Contact c;
+        for (uint32_t s = 0; s < world.GetShapeCount() && !expected; ++s) expected = SpatialHash::Inside(world.GetShape(s), p, c);
+        ASSERT_EQ(world.Contains(p), expected) << p.x << ", " << p.y;
+        hits += expected;
+    }
+    EXPECT_GT(hits, 100u);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/SpriteRegistry.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+
+namespace {
+
+    constexpr uint64_t kQuadBytes = 4 * (12 + 32); // position + attribute streams
+
+    class SpriteRegistryTest : public ::testing::Test {
+    protected:
+        static Shared<Shader> QuadShader() { return TestHelpers::QuadShader(); }
+
+        TestHelpers::BackendGuard m_Backend{ RendererAPI::API::Recording };
+    };
+
+}
+
+TEST_F(SpriteRegistryTest, UploadsOnlyChangedSpritesAndDrawsOnce)
+{
+    SpriteRegistry sprites(1000, QuadShader());
+    std::vector<SpriteHandle> handles;
+    for (int i = 0; i < 1000; ++i)
+        handles.push_back(sprites.CreateSprite({ { (float)i, 0.0f, 0.0f } }));
+
+    OrthographicCamera camera(-10.0f, 10.0f, -10.0f, 10.0f);
+    auto& log = RecordingLog::Get();
+    log.EndFrame();
+
+    sprites.Draw(camera);
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().DrawCalls, 1u);
+    EXPECT_EQ(log.Frames().back().Indices, 6000u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 1000u * kQuadBytes);
+
+    // Static frame: nothing to upload
+    sprites.Draw(camera);
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().DrawCalls, 1u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 0u);
+
+    // Two separate edits plus a run of three: three ranges, five quads
+    SpriteDesc moved = sprites.GetSprite(handles[10]);
+    moved.Position.y = 5.0f;
+    sprites.UpdateSprite(handles[10], moved);
+    sprites.UpdateSprite(handles[500], moved);
+    for (int i = 700; i < 703; ++i) sprites.UpdateSprite(handles[i], moved);
+    sprites.UpdateSprite(handles[701], moved); // queued once
+
+    sprites.ResetStats();
+    sprites.Draw(camera);
+    log.EndFrame();
+    EXPECT_EQ(sprites.GetStats().UploadRanges, 3u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 5u * kQuadBytes);
+    EXPECT_EQ(log.Frames().back().DrawCalls, 1u);
+}
+
+TEST_F(SpriteRegistryTest, DestroyedSlotsAreReusedAndStaleHandlesIgnored)
+{
+    SpriteRegistry sprites(4, QuadShader());
+    SpriteHandle a = sprites.CreateSprite({});
+    SpriteHandle b = sprites.CreateSprite({});
+    EXPECT_EQ(sprites.Count(), 2u);
+
+    sprites.DestroySprite(a);
+    EXPECT_FALSE(sprites.IsAlive(a));
+    EXPECT_TRUE(sprites.IsAlive(b));
+
+    SpriteHandle c = sprites.CreateSprite({});
+    EXPECT_EQ(c.Index, a.Index);
+    EXPECT_TRUE(sprites.IsAlive(c));
+    EXPECT_FALSE(sprites.IsAlive(a)); // same slot, older generation
+
+    sprites.UpdateSprite(a, { glm::vec3(9.0f) }); // no effect on c
+    EXPECT_EQ(sprites.GetSprite(c).Position, glm::vec3(0.0f));
+
+    // Destroying the last sprite shrinks the drawn range
+    sprites.DestroySprite(b);
+    auto& log = RecordingLog::Get();
+    log.EndFrame();
+    sprites.Draw(glm::mat4(1.0f));
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().Indices, 6u);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "Engine/Renderer/Tilemap.h"
+#include "Engine/Renderer/CommandList.h"
+#include "Platforms/Recording/RecordingLog.h"
+#include "RendererTestHelpers.h"
+
+using namespace Engine;
+
+namespace {
+
+    class TilemapTest : public ::testing::Test {
+    protected:
+        static Shared<Shader> QuadShader() { return TestHelpers::QuadShader(); }
+
+        TestHelpers::BackendGuard m_Backend{ RendererAPI::API::Recording };
+    };
+
+}
+
+TEST_F(TilemapTest, DrawsOnlyVisibleChunksAndCachesGeometry)
+{
+    // 256x256 tiles = 16x16 chunks
+    Tilemap map(256, 256, { 1.0f, 1.0f }, glm::vec3(0.0f), QuadShader());
+    map.Fill({ glm::vec4(1.0f) });
+
+    // 20x20 world units around (40, 40): chunks 1..3 on both axes
+    OrthographicCamera camera(-10.0f, 10.0f, -10.0f, 10.0f);
+    camera.SetPosition({ 40.0f, 40.0f, 0.0f });
+
+    auto& log = RecordingLog::Get();
+    log.EndFrame();
+
+    map.Draw(camera);
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().DrawCalls, 9u);
+    EXPECT_EQ(map.GetStats().RebuiltChunks, 9u);
+    EXPECT_GT(log.Frames().back().VertexBytes, 0u);
+
+    // Second frame: cached, nothing uploaded
+    map.Draw(camera);
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().DrawCalls, 9u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 0u);
+    EXPECT_EQ(map.GetStats().RebuiltChunks, 9u);
+
+    // Editing one tile rebuilds only its chunk
+    map.SetTile(40, 40, { { 1.0f, 0.0f, 0.0f, 1.0f } });
+    map.Draw(camera);
+    log.EndFrame();
+    EXPECT_EQ(map.GetStats().RebuiltChunks, 10u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 16u * 16u * 4u * (12u + 32u));
+}
+
+TEST_F(TilemapTest, EmptyChunksAndOffscreenViewsIssueNoDraws)
+{
+    Tilemap map(64, 64, { 2.0f, 2.0f }, glm::vec3(0.0f), QuadShader());
+    map.SetTile(0, 0, { glm::vec4(1.0f) });
+
+    OrthographicCamera camera(-40.0f, 40.0f, -40.0f, 40.0f);
+    camera.SetPosition({ 64.0f, 64.0f, 0.0f }); // whole map visible
+    map.Draw(camera);
+    EXPECT_EQ(map.GetStats().DrawCalls, 1u);
+    EXPECT_EQ(map.GetStats().VisibleChunks, 16u);
+
+    map.ResetStats();
+    camera.SetPosition({ -500.0f, 0.0f, 0.0f });
+    map.Draw(camera);
+    EXPECT_EQ(map.GetStats().VisibleChunks, 0u);
+}
+
+// Render-thread mode: the frame is recorded on the main thread and replayed
+// later, so drawing a dirty chunk must not touch the backend while recording.
+TEST_F(TilemapTest, DirtyChunksDrawnWhileRecordingReachTheBackendOnReplay)
+{
+    Tilemap map(32, 32, { 1.0f, 1.0f }, glm::vec3(0.0f), QuadShader());
+    map.Fill({ glm::vec4(1.0f) });
+    OrthographicCamera camera(-20.0f, 20.0f, -20.0f, 20.0f);
+    camera.SetPosition({ 16.0f, 16.0f, 0.0f }); // all 2x2 chunks
+
+    map.Reserve(4);
+
+    auto& log = RecordingLog::Get();
+    log.EndFrame();
+    const uint32_t createdBefore = VertexArray::Create()->GetSortID();
+
+    CommandList list;
+    {
+        CommandList::RecordingScope scope(list);
+        map.Draw(camera);
+    }
+    EXPECT_EQ(map.GetStats().RebuiltChunks, 4u);
+    EXPECT_EQ(VertexArray::Create()->GetSortID(), createdBefore + 1) << "no vertex arrays created while recording";
+    EXPECT_EQ(log.CurrentFrame().DrawCalls, 0u);
+    EXPECT_EQ(log.CurrentFrame().VertexBytes, 0u);
+
+    CommandQueue queue;
+    queue.Submit(std::move(list));
+    queue.Execute();
+    log.EndFrame();
+    EXPECT_EQ(log.Frames().back().DrawCalls, 4u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 4u * 16u * 16u * 4u * (12u + 32u));
+
+    // An edit recorded later refills just its chunk
+    map.SetTile(3, 3, { { 0.0f, 1.0f, 0.0f, 1.0f } });
+    CommandList edit;
+    {
+        CommandList::RecordingScope scope(edit);
+        map.Draw(camera);
+    }
+    queue.Submit(std::move(edit));
+    queue.Execute();
+    log.EndFrame();
+    EXPECT_EQ(map.GetStats().RebuiltChunks, 5u);
+    EXPECT_EQ(log.Frames().back().VertexBytes, 16u * 16u * 4u * (12u + 32u));
+}
+
+TEST_F(TilemapTest, AllocatesChunkBuffersOnlyForChunksWithTiles)
+{
+    Tilemap map(64, 64, { 1.0f, 1.0f }, glm::vec3(0.0f), QuadShader());
+    EXPECT_EQ(map.GetAllocatedChunks(), 0u);
+
+    map.SetTile(0, 0, { glm::vec4(1.0f) });
+    OrthographicCamera camera(-40.0f, 40.0f, -40.0f, 40.0f);
+    camera.SetPosition({ 32.0f, 32.0f, 0.0f }); // all 4x4 chunks
+    map.Draw(camera);
+    EXPECT_EQ(map.GetStats().VisibleChunks, 16u);
+    EXPECT_EQ(map.GetAllocatedChunks(), 1u);
+
+    // Emptied again: the buffers go back to the pool and are reused
+    map.SetTile(0, 0, {});
+    map.SetTile(63, 63, { glm::vec4(1.0f) });
+    map.Draw(camera);
+    EXPECT_EQ(map.GetStats().DrawCalls, 2u);
+    EXPECT_EQ(map.GetAllocatedChunks(), 1u);
+}
+
+// While recording, chunks that come into view take over the buffers of
+// chunks that left it instead of allocating.
+TEST_F(TilemapTest, RecordedDrawsReuseReservedBuffersOfChunksOffScreen)
+{
+    Tilemap map(64, 64, { 1.0f, 1.0f }, glm::vec3(0.0f), QuadShader());
+    map.Fill({ glm::vec4(1.0f) });
+    map.Reserve(4);
+    OrthographicCamera camera(-15.0f, 15.0f, -15.0f, 15.0f);
+
+    auto& log = RecordingLog::Get();
+    CommandQueue queue;
+    for (const glm::vec3& at : { glm::vec3(16.0f, 16.0f, 0.0f), glm::vec3(48.0f, 48.0f, 0.0f) }) {
+        camera.SetPosition(at); // 2x2 chunks
+        CommandList list;
+        {
+            CommandList::RecordingScope scope(list);
+            map.Draw(camera);
+        }
+        queue.Submit(std::move(list));
+        queue.Execute();
+        log.EndFrame();
+        EXPECT_EQ(log.Frames().back().DrawCalls, 4u);
+    }
+    EXPECT_EQ(map.GetAllocatedChunks(), 4u);
+    EXPECT_EQ(map.GetStats().EvictedChunks, 4u);
+    EXPECT_EQ(map.GetStats().RebuiltChunks, 8u);
+}
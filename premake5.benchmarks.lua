@@ -0,0 +1,71 @@
+-- premake5.benchmarks.lua
+local outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
+
+group "Tests"
+project "GameEngineBenchmarks"
+    location "Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+    staticruntime "off"
+
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+    objdir    ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files {
+        "Benchmarks/**.h",
+        "Benchmarks/**.cpp"
+    }
+
+    includedirs {
+        "Benchmarks",
+        "GameEngine/src",
+        "GameEngine/vendor/spdlog/include",
+        "%{IncludeDir.glm}"
+    }
+
+    links {
+        "GameEngine",
+        "GLFW",
+        "Glad",
+        "ImGui",
+        "opengl32.lib",
+        "Shell32.lib"
+    }
+    dependson { "GameEngine", "GLFW", "Glad", "ImGui" }
+
+    filter "system:windows"
+        systemversion "latest"
+        defines {
+            "EG_PLATFORM_WINDOWS",
+            "GLFW_INCLUDE_NONE",
+            "_CRT_SECURE_NO_WARNINGS",
+            "NOMINMAX",
+            "EG_STATIC"
+        }
+        linkoptions { "/SUBSYSTEM:CONSOLE" }
+
+    -- Numbers from Debug builds are not comparable; run Release or Dist
+    filter "configurations:Debug"
+        defines "EG_DEBUG"
+        runtime "Debug"
+        symbols "on"
+
+    filter "configurations:Release"
+        defines "EG_RELEASE"
+        runtime "Release"
+        optimize "on"
+
+    filter "configurations:Dist"
+        defines "EG_DIST"
+        runtime "Release"
+        optimize "on"
+
+    filter {}
+
+    -- The recording backend still loads the Renderer2D shader sources
+    debugdir "%{cfg.targetdir}"
+    postbuildcommands {
+        '{MKDIR} "%{cfg.targetdir}/assets"',
+        '{COPYDIR} "%{path.getabsolute(' .. "'" .. 'Sandbox/assets' .. "'" .. ')}" "%{cfg.targetdir}/assets"'
+    }
@@ -17,6 +17,7 @@ include "GameEngine/vendor/GLFW"
 include "GameEngine/vendor/Glad"
 include "GameEngine/vendor/imgui"
 include "premake5.tests.lua"
+include "premake5.benchmarks.lua"
 
 project "GameEngine"
     location "GameEngine"
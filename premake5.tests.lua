@@ -19,6 +19,12 @@ project "GameEngineTests"
         "Tests/main.cpp",
         "Tests/TestPch.h",
 
+        -- Sandbox gameplay rendered headlessly by the integration tests
+        "Sandbox/src/Course.cpp",
+        "Sandbox/src/PlaySceneFrame.cpp",
+        "Sandbox/src/Ship.cpp",
+        "Sandbox/src/RNG.cpp",
+
         -- GoogleTest (kompilujemy do EXE, bez agregatów)
         "Tests/third_party/googletest/googletest/src/*.cc",
         "Tests/third_party/googletest/googletest/src/**.h",
@@ -35,6 +41,8 @@ project "GameEngineTests"
         "Tests/helpers",       -- TestPch.h
         "GameEngine/src",
         "GameEngine/src/Engine",      -- pozwala #include "Application.h"
+        "GameEngine/vendor",          -- <imgui/imgui.h> w Sandbox/src
+        "Sandbox/src",
         "GameEngine/vendor/spdlog/include",
         "%{IncludeDir.GLFW}",
         "%{IncludeDir.Glad}",